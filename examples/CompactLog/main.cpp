@@ -0,0 +1,103 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <filesystem>
+#include <vector>
+
+#include "HAL/File.hpp"
+
+#include "CompactLog.hpp"
+
+using namespace VN;
+namespace fs = std::filesystem;
+
+std::string usage = "[path] [chunkSize]\n";
+
+int main(int argc, char* argv[])
+{
+    // Pass in a raw log and the number of bytes SimpleLogger hands the encoder at a time, or edit them here
+    const std::string filePath = (argc > 1) ? argv[1] : (fs::path(__FILE__).parent_path() / "../DataExport/FromFile/DataExportFromFile.bin").string();
+    const size_t chunkSize = (argc > 2) ? std::stoul(argv[2]) : 1024 * 3 / Config::DataExport::wakeFillDivisor;
+
+    const size_t rawSize = fs::file_size(filePath);
+    std::vector<uint8_t> raw(rawSize);
+    InputFile inputFile(Filesystem::FilePath(filePath.c_str()));
+    if (rawSize == 0 || inputFile.read(reinterpret_cast<char*>(raw.data()), rawSize))
+    {
+        std::cout << "Error: Failed to read " << filePath << std::endl;
+        return 1;
+    }
+
+    // Repeat small logs so each timing covers at least 64 MB
+    const size_t numRepeats = std::max<size_t>(1, (64 * 1024 * 1024) / rawSize);
+    std::vector<uint8_t> compact;
+    std::vector<uint8_t> decoded;
+
+    const auto encodeStart = std::chrono::steady_clock::now();
+    for (size_t repeat = 0; repeat < numRepeats; ++repeat)
+    {
+        compact.clear();
+        CompactLogEncoder encoder;
+        for (size_t offset = 0; offset < rawSize; offset += chunkSize)
+        {
+            const auto& encoded = encoder.consume(raw.data() + offset, std::min(chunkSize, rawSize - offset));
+            compact.insert(compact.end(), encoded.begin(), encoded.end());
+        }
+        const auto& encoded = encoder.finish();
+        compact.insert(compact.end(), encoded.begin(), encoded.end());
+    }
+    const std::chrono::duration<double> encodeTime = std::chrono::steady_clock::now() - encodeStart;
+
+    const auto decodeStart = std::chrono::steady_clock::now();
+    for (size_t repeat = 0; repeat < numRepeats; ++repeat)
+    {
+        decoded.clear();
+        if (CompactLogDecoder().decode(compact.data(), compact.size(), decoded))
+        {
+            std::cout << "Error: Failed to decode." << std::endl;
+            return 1;
+        }
+    }
+    const std::chrono::duration<double> decodeTime = std::chrono::steady_clock::now() - decodeStart;
+
+    if (decoded != raw)
+    {
+        std::cout << "Error: Decoded log differs from " << filePath << std::endl;
+        return 1;
+    }
+
+    const double numMegabytes = static_cast<double>(rawSize) * numRepeats / (1024 * 1024);
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::setw(16) << std::left << "Raw size: " << rawSize << " bytes\n";
+    std::cout << std::setw(16) << std::left << "Compact size: " << compact.size() << " bytes (" << static_cast<double>(rawSize) / compact.size()
+              << ":1)\n";
+    std::cout << std::setw(16) << std::left << "Encode: " << numMegabytes / encodeTime.count() << " MB/s of raw log\n";
+    std::cout << std::setw(16) << std::left << "Decode: " << numMegabytes / decodeTime.count() << " MB/s of raw log\n";
+
+    std::cout << "CompactLog benchmark complete." << std::endl;
+}
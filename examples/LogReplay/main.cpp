@@ -0,0 +1,114 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <filesystem>
+#include <thread>
+
+#include "Interface/Sensor.hpp"
+#include "Interface/Registers.hpp"
+
+#include "SerialReplay.hpp"
+
+using namespace VN;
+namespace fs = std::filesystem;
+
+std::string usage = "[path] [speed]\n";
+
+int main(int argc, char* argv[])
+{
+    // Pass in a log and a replay speed, or edit them here. A speed of 0 replays as fast as the Sensor can take the bytes.
+    const std::string filePath = (argc > 1) ? argv[1] : (fs::path(__FILE__).parent_path() / "../DataExport/FromFile/DataExportFromFile.bin").string();
+    const double speed = (argc > 2) ? std::stod(argv[2]) : 1.0;
+
+    // An unpaced replay keeps the main buffer full, so give it room for a split packet behind a whole read.
+    Sensor sensor(Sensor::BufferConfig{2 * Config::Serial::numBytesToReadPerGetData, Config::PacketDispatchers::compositeDataQueueCapacity, false});
+    SerialReplay* replay = sensor.useSerial<SerialReplay>(Filesystem::FilePath(filePath.c_str()),
+                                                          (speed > 0) ? SerialReplay::Pacing::Recorded : SerialReplay::Pacing::Unpaced, speed);
+    replay->addResponse("RRG,01", "VNRRG,01,VN-100 Replay");
+
+    Error latestError = sensor.connect("Replay", Sensor::BaudRate::Baud921600);
+    if (latestError != Error::None)
+    {
+        std::cout << "Error " << latestError << " encountered when opening " << filePath << ".\t" << std::endl;
+        return static_cast<int>(latestError);
+    }
+
+    // Commands are answered from the replay's canned responses
+    Registers::System::Model modelRegister;
+    latestError = sensor.readRegister(&modelRegister);
+    if (latestError != Error::None)
+    {
+        std::cout << "Error" << latestError << " encountered when reading register " << modelRegister.id() << " (" << modelRegister.name() << ")" << std::endl;
+        return static_cast<int>(latestError);
+    }
+    std::cout << "Replaying " << filePath << " as " << modelRegister.model << std::endl;
+
+    // Latency is from the packet being found in the main buffer to it being read here
+    uint64_t numMeasurements = 0;
+    uint64_t numAsyncErrors = 0;  // Dropped bytes or measurements, if the pipeline cannot keep up
+    Nanoseconds totalLatency{0};
+    Nanoseconds maxLatency{0};
+    const auto startTime = now();
+    auto lastMeasurementTime = startTime;
+    const auto recordMeasurement = [&](const CompositeData& compositeData)
+    {
+        lastMeasurementTime = now();
+        const Nanoseconds latency = lastMeasurementTime - compositeData.timestamp;
+        totalLatency += latency;
+        maxLatency = std::max(maxLatency, latency);
+        ++numMeasurements;
+    };
+
+    while (!replay->isFinished() || (now() - lastMeasurementTime) < 100ms)
+    {
+#if (!THREADING_ENABLE)
+        sensor.loadMainBufferFromSerial();
+        // Drain after each packet, as a whole read can hold more packets than the measurement queue
+        while (!sensor.processNextPacket()) { sensor.drainMeasurements(recordMeasurement); };
+#endif
+        while (sensor.getAsynchronousError().has_value()) { ++numAsyncErrors; }
+        if (sensor.drainMeasurements(recordMeasurement) == 0) { std::this_thread::sleep_for(100us); }
+    }
+    const std::chrono::duration<double> duration = lastMeasurementTime - startTime;
+    sensor.disconnect();
+
+    std::cout << "Replayed " << replay->numBytesReplayed() << " bytes in " << duration.count() << " s." << std::endl;
+    std::cout << "Measurements: " << numMeasurements << " (" << numMeasurements / duration.count() << " /s), " << numAsyncErrors << " async errors"
+              << std::endl;
+    if (numMeasurements != 0)
+    {
+        std::cout << "Latency: " << (totalLatency.count() / numMeasurements) / 1000.0 << " us mean, " << maxLatency.count() / 1000.0 << " us max" << std::endl;
+    }
+    const LinkStats linkStats = sensor.linkStats();
+    std::cout << "FA packets: " << linkStats.faPackets << " (" << linkStats.invalidFaPackets << " invalid), ASCII packets: " << linkStats.asciiPackets
+              << ", skipped bytes: " << linkStats.skippedBytes << std::endl;
+    std::cout << "Main buffer high watermark: " << linkStats.mainBufferHighWatermark << " bytes, measurement queue high watermark: "
+              << linkStats.measurementQueueHighWatermark << std::endl;
+
+    std::cout << "LogReplay example complete.\n";
+}
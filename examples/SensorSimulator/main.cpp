@@ -0,0 +1,146 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "Interface/Sensor.hpp"
+#include "Interface/Registers.hpp"
+#include "Interface/BandwidthPlanner.hpp"
+
+#include "SensorSimulator.hpp"
+
+using namespace VN;
+
+std::string usage = "[bitErrorRate] [secondsPerStep]\n";
+
+int main(int argc, char* argv[])
+{
+    // Pass in a bit error rate and how long to measure each step for, or edit them here
+    const double bitErrorRate = (argc > 1) ? std::stod(argv[1]) : 0.0;
+    const std::chrono::duration<double> stepDuration((argc > 2) ? std::stod(argv[2]) : 2.0);
+
+    // [1] Start a simulator at 921600 baud and connect to it through the host's serial port code
+    SensorSimulator::LinkConfig linkConfig;
+    linkConfig.bitErrorRate = bitErrorRate;
+    SensorSimulator simulator(linkConfig);
+    Error latestError = simulator.open();
+    if (latestError != Error::None)
+    {
+        std::cout << "Error " << latestError << " encountered when opening a pty." << std::endl;
+        return static_cast<int>(latestError);
+    }
+
+    Sensor sensor;
+    latestError = sensor.connect(simulator.portName().c_str(), Sensor::BaudRate::Baud921600);
+    if (latestError != Error::None)
+    {
+        std::cout << "Error " << latestError << " encountered when connecting to " << simulator.portName() << ".\t" << std::endl;
+        return static_cast<int>(latestError);
+    }
+
+    Registers::System::Model modelRegister;
+    latestError = sensor.readRegister(&modelRegister);
+    if (latestError != Error::None)
+    {
+        std::cout << "Error" << latestError << " encountered when reading register " << modelRegister.id() << " (" << modelRegister.name() << ")" << std::endl;
+        return static_cast<int>(latestError);
+    }
+    std::cout << "Connected to " << modelRegister.model << " on " << simulator.portName() << std::endl;
+
+    // [2] Configure the stream as on a unit, at the full IMU rate
+    Registers::System::BinaryOutput1 binaryOutput1Register;
+    binaryOutput1Register.rateDivisor = 1;
+    binaryOutput1Register.asyncMode.serial1 = true;
+    binaryOutput1Register.common.timeStartup = true;
+    binaryOutput1Register.common.ypr = true;
+    binaryOutput1Register.common.angularRate = true;
+    binaryOutput1Register.common.accel = true;
+    latestError = sensor.writeRegister(&binaryOutput1Register);
+    if (latestError != Error::None)
+    {
+        std::cout << "Error" << latestError << " encountered when configuring register " << binaryOutput1Register.id() << " (" << binaryOutput1Register.name()
+                  << ")" << std::endl;
+        return static_cast<int>(latestError);
+    }
+
+    // Counts what reaches the measurement queue, and what the simulator and the link saw, over one step
+    const auto measure = [&](SensorSimulator& source)
+    {
+        const SensorSimulator::Stats simulatorBefore = source.stats();
+        const LinkStats linkBefore = sensor.linkStats();
+        uint64_t numMeasurements = 0;
+        const auto startTime = std::chrono::steady_clock::now();
+        while (std::chrono::steady_clock::now() - startTime < stepDuration)
+        {
+#if (!THREADING_ENABLE)
+            sensor.loadMainBufferFromSerial();
+            while (!sensor.processNextPacket()) { numMeasurements += sensor.drainMeasurements([](const CompositeData&) {}); };
+#endif
+            while (sensor.getAsynchronousError().has_value()) {}
+            numMeasurements += sensor.drainMeasurements([](const CompositeData&) {});
+        }
+        const SensorSimulator::Stats simulatorAfter = source.stats();
+        const LinkStats linkAfter = sensor.linkStats();
+        const uint64_t numPacketsSent = simulatorAfter.packetsSent - simulatorBefore.packetsSent;
+        const uint64_t numPacketsDropped = simulatorAfter.packetsDropped - simulatorBefore.packetsDropped;
+        std::cout << std::setw(10) << numPacketsSent / stepDuration.count() << std::setw(10)
+                  << (simulatorAfter.bytesSent - simulatorBefore.bytesSent) / stepDuration.count() / 1e3 << std::setw(12)
+                  << numMeasurements / stepDuration.count() << std::setw(10) << numPacketsDropped << std::setw(10)
+                  << linkAfter.invalidFaPackets - linkBefore.invalidFaPackets << std::setw(10) << linkAfter.skippedBytes - linkBefore.skippedBytes << std::endl;
+        // Packets the simulator dropped were offered, but the host did not read them off the link in time
+        const uint64_t numPacketsOffered = numPacketsSent + numPacketsDropped;
+        return (numPacketsOffered == 0) ? 0.0 : static_cast<double>(numMeasurements) / numPacketsOffered;
+    };
+    std::cout << std::fixed << std::setprecision(1) << std::setw(10) << "sent/s" << std::setw(10) << "kB/s" << std::setw(12) << "received/s" << std::setw(10)
+              << "dropped" << std::setw(10) << "bad crc" << std::setw(10) << "skipped" << std::endl;
+    measure(simulator);
+
+    // [3] Raise the rate on an unpaced link until the host stops keeping up. The pty carries bytes as fast as the host reads them, whatever baud rate
+    // the host opened it at.
+    sensor.disconnect();
+    linkConfig.baudRate = 0;
+    SensorSimulator unpacedSimulator(linkConfig);
+    if ((unpacedSimulator.open() != Error::None) || (sensor.connect(unpacedSimulator.portName().c_str(), Sensor::BaudRate::Baud921600) != Error::None))
+    {
+        std::cout << "Error encountered when reconnecting." << std::endl;
+        return static_cast<int>(Error::UnexpectedSerialError);
+    }
+    std::cout << "Unpaced, " << BandwidthPlanner::worstCasePacketLength(binaryOutput1Register) << " byte packets:" << std::endl;
+    for (double rateHz = 800; rateHz <= 800 * 1024; rateHz *= 2)
+    {
+        unpacedSimulator.setBinaryOutput(0, binaryOutput1Register, rateHz);
+        if (measure(unpacedSimulator) < 0.99)
+        {
+            std::cout << "Saturated at " << rateHz << " packets/s." << std::endl;
+            break;
+        }
+    }
+    sensor.disconnect();
+
+    std::cout << "SensorSimulator example complete.\n";
+}
@@ -73,6 +73,30 @@ namespace VN
 #define THREADING_ENABLE true
 #endif
 
+// If true, the listening thread only frames and validates FA packets, queueing them raw. They are parsed into CompositeData by the consumer, when measurements
+// are requested from the Sensor, keeping parsing off the listening thread.
+#ifndef DEFERRED_PARSING_ENABLE
+#define DEFERRED_PARSING_ENABLE false
+#endif
+
+// If true, the Sensor keeps the most recent measurement, and the most recent sample of each measurement group, readable at any time without popping the
+// measurement queue. See Sensor::latestMeasurements.
+#ifndef LATEST_MEASUREMENT_ENABLE
+#define LATEST_MEASUREMENT_ENABLE false
+#endif
+
+// If true, FA measurements are queued as CompactCompositeData, with GNSS SatInfo and RawMeas held out-of-line in a shared slab, rather than on the
+// CompositeData measurement queue. See Sensor::getNextCompactMeasurement. ASCII measurements remain on the measurement queue.
+#ifndef COMPACT_MEASUREMENT_QUEUE_ENABLE
+#define COMPACT_MEASUREMENT_QUEUE_ENABLE false
+#endif
+
+// If true, OutputFile on Linux copies writes into double-buffered blocks which a writer thread per file flushes with pwrite, so exporters never wait on the
+// filesystem unless both blocks are full. See Config::Files.
+#ifndef ASYNC_FILE_WRITE_ENABLE
+#define ASYNC_FILE_WRITE_ENABLE false
+#endif
+
 namespace Config
 {
 
@@ -105,6 +129,9 @@ namespace PacketDispatchers
 constexpr EnabledMeasurements cdEnabledMeasTypes = {
     TIME_GROUP_ENABLE, IMU_GROUP_ENABLE, GNSS_GROUP_ENABLE, ATTITUDE_GROUP_ENABLE, INS_GROUP_ENABLE, GNSS2_GROUP_ENABLE, 0, 0, 0, 0, 0, GNSS3_GROUP_ENABLE};
 constexpr uint8_t compositeDataQueueCapacity = 20;
+constexpr uint8_t deferredPacketQueueCapacity = compositeDataQueueCapacity;  // Only used if DEFERRED_PARSING_ENABLE
+constexpr uint16_t latestPacketMaxLength = PacketFinders::asciiPacketMaxLength;  // Only used if LATEST_MEASUREMENT_ENABLE. Longer packets are not published.
+constexpr uint8_t compactGnssSlabCapacity = compositeDataQueueCapacity;  // Only used if COMPACT_MEASUREMENT_QUEUE_ENABLE. One SatInfo and one RawMeas per queue entry.
 
 // Fa
 constexpr uint8_t faPacketSubscriberCapacity = 5;
@@ -113,6 +140,13 @@ constexpr uint8_t faPacketSubscriberCapacity = 5;
 constexpr uint8_t asciiPacketSubscriberCapacity = 5;
 }  // namespace PacketDispatchers
 
+namespace PacketQueues
+{
+// Packet buffers for each PacketQueue are allocated as one arena. These are only honored on Linux.
+constexpr bool arenaUseHugePages = false;
+constexpr bool arenaLockPages = false;  // Requires CAP_IPC_LOCK or a sufficient RLIMIT_MEMLOCK; skipped otherwise
+}  // namespace PacketQueues
+
 namespace Serial
 {
 constexpr uint64_t numBytesToReadPerGetData = 2000;
@@ -135,8 +169,39 @@ constexpr Microseconds commandSendSleepDuration = 100us;
 // Retries
 constexpr uint8_t commandSendRetriesAllowed = 2;
 constexpr bool retryVerifyConnectivity = true;
+
+// Buffer auto-tuning, only used if enabled in Sensor::BufferConfig
+constexpr Microseconds bufferAutoTuneWindow = 2000ms;           // How long to observe the link after connecting, and between later checks for growth
+constexpr Microseconds mainBufferStallTolerance = 50ms;         // How long the listening thread may stall before the main buffer overflows
+constexpr Microseconds measurementQueueStallTolerance = 100ms;  // How long the consumer may stall before measurements are dropped
+
+// Link statistics
+constexpr Microseconds linkStatsWindow = 1000ms;  // The sliding window over which Sensor::linkStats rates are averaged
+constexpr uint8_t linkStatsBuckets = 10;          // Statistics are republished each linkStatsWindow / linkStatsBuckets
+constexpr uint8_t linkStatsMessageTypes = 8;      // Distinct binary outputs and ASCII message types broken out in Sensor::linkStats
 }  // namespace Sensor
 
+namespace Files
+{
+// Only used if ASYNC_FILE_WRITE_ENABLE
+constexpr size_t asyncBlockSize = 1024 * 1024;             // Size of each of the two blocks per file, a multiple of 4096
+constexpr size_t asyncPreallocateSize = 64 * 1024 * 1024;  // Disk space reserved ahead of the write head with fallocate, 0 to disable
+constexpr bool asyncDirectIo = false;                      // Open with O_DIRECT, bypassing the page cache. Ignored where unsupported.
+}  // namespace Files
+
+namespace DataExport
+{
+constexpr size_t fileBufferCapacity = 64 * 1024;  // Text exporters hand formatted output to each file in blocks of this size
+constexpr size_t maxOpenFiles = 32;               // Per exporter. Beyond this, the least recently used file is closed until it is next written to.
+constexpr uint32_t columnarRowGroupRows = 16384;  // Rows ExporterColumnar buffers per message type before writing them out as a row group
+
+// Exporter and logger threads sleep until their queue is 1 / wakeFillDivisor full, or wakeMaxLatency after its first item, whichever is sooner
+constexpr uint8_t wakeFillDivisor = 4;
+constexpr Microseconds wakeMaxLatency = 5ms;
+
+constexpr Microseconds logIndexInterval = 100ms;  // SimpleLogger's sidecar index gains an entry each time this much host or sensor startup time passes
+}  // namespace DataExport
+
 namespace CommandProcessor
 {
 constexpr Microseconds commandRemovalTimeoutLength = Sensor::commandSendTimeoutLength * 2;
@@ -155,6 +220,7 @@ static_assert(CommandProcessor::messageMaxLength >= PacketFinders::asciiPacketMa
 static_assert(PacketFinders::asciiPacketMaxLength > PacketFinders::asciiFieldMaxLength);
 static_assert(PacketFinders::asciiPacketMaxLength > PacketFinders::asciiHeaderMaxLength);
 static_assert(PacketFinders::mainBufferCapacity >= Serial::numBytesToReadPerGetData);
+static_assert(Files::asyncBlockSize != 0 && Files::asyncBlockSize % 4096 == 0);  // Required for O_DIRECT
 
 }  // namespace Config
 
@@ -0,0 +1,55 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef HAL_EVENT_BASE_HPP
+#define HAL_EVENT_BASE_HPP
+
+#include "HAL/Duration.hpp"
+
+namespace VN
+{
+
+/// @brief A flag raised by one thread to wake another which is blocked on it. It resets when a waiter returns, and a notification raised before
+/// anyone waits is not lost.
+class Event_Base
+{
+public:
+    Event_Base() {}
+
+    Event_Base(const Event_Base&) = delete;
+    Event_Base& operator=(const Event_Base&) = delete;
+
+    virtual void notify() = 0;
+
+    /// @brief Blocks until notified.
+    virtual void wait() = 0;
+
+    /// @brief Blocks until notified or until timeout elapses.
+    /// @return Timed out without being notified.
+    virtual bool waitFor(const Microseconds timeout) = 0;
+};
+
+}  // namespace VN
+
+#endif  // HAL_EVENT_BASE_HPP
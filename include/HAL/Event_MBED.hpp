@@ -0,0 +1,66 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef HAL_EVENT_TEENSY_HPP
+#define HAL_EVENT_TEENSY_HPP
+
+#include <Arduino.h>
+#include <atomic>
+#include "HAL/Event_Base.hpp"
+
+namespace VN
+{
+
+/// @brief TeensyThreads has no condition variable, so a waiter yields to the other threads until the flag is raised, as Mutex does while locked.
+class Event : public Event_Base
+{
+public:
+    Event() {}
+
+    void notify() override final { _raised.store(true, std::memory_order_release); }
+
+    void wait() override final
+    {
+        while (!_raised.exchange(false, std::memory_order_acquire)) { yield(); }
+    }
+
+    bool waitFor(const Microseconds timeout) override final
+    {
+        const uint32_t start = micros();
+        const uint32_t timeoutUs = static_cast<uint32_t>(timeout.count());
+        while (!_raised.exchange(false, std::memory_order_acquire))
+        {
+            if (static_cast<uint32_t>(micros() - start) >= timeoutUs) { return true; }
+            yield();
+        }
+        return false;
+    }
+
+private:
+    std::atomic<bool> _raised = false;
+};
+
+}  // namespace VN
+
+#endif  // HAL_EVENT_TEENSY_HPP
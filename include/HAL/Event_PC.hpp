@@ -0,0 +1,72 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef HAL_EVENT_PC_HPP
+#define HAL_EVENT_PC_HPP
+
+#include <condition_variable>
+#include <mutex>
+#include "HAL/Event_Base.hpp"
+
+namespace VN
+{
+
+class Event : public Event_Base
+{
+public:
+    Event() {}
+
+    void notify() override final
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _raised = true;
+        }
+        _cv.notify_one();
+    }
+
+    void wait() override final
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] { return _raised; });
+        _raised = false;
+    }
+
+    bool waitFor(const Microseconds timeout) override final
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_cv.wait_for(lock, timeout, [this] { return _raised; })) { return true; }
+        _raised = false;
+        return false;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _raised = false;
+};
+
+}  // namespace VN
+
+#endif  // HAL_EVENT_PC_HPP
@@ -65,6 +65,10 @@ public:
 
     /// @brief Resets the file head to the beginning of the file, clearing any error flags.
     virtual void reset() = 0;
+
+    /// @brief Moves the file head to the passed byte offset from the beginning of the file, clearing any error flags.
+    /// @return An error occurred.
+    virtual bool seek(const size_t position) = 0;
 };
 
 /// @brief SDK object of a file to write to.
@@ -78,6 +82,11 @@ public:
     /// @return An error occurred.
     virtual bool open(const Filesystem::FilePath& filePath) = 0;
 
+    /// @brief Opens the specified file for writing after its existing contents, creating it if it does not exist.
+    /// @param filePath The file to open.
+    /// @return An error occurred.
+    virtual bool openAppend(const Filesystem::FilePath& filePath) = 0;
+
     /// @brief Closes the file.
     virtual void close() = 0;
 
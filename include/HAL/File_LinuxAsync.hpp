@@ -0,0 +1,337 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef HAL_FILE_LINUXASYNC_HPP
+#define HAL_FILE_LINUXASYNC_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Config.hpp"
+#include "HAL/File_Base.hpp"
+
+namespace VN
+{
+
+/// @brief Owns a file descriptor and a writer thread. Callers append into one of two blocks while the writer thread flushes the other with pwrite, so a
+/// write only costs a memcpy unless the writer has fallen a full block behind.
+class AsyncFileWriter
+{
+public:
+    static constexpr size_t blockSize = Config::Files::asyncBlockSize;
+    static constexpr size_t blockAlignment = 4096;
+
+    AsyncFileWriter() = default;
+
+    ~AsyncFileWriter()
+    {
+        close();
+        for (auto& block : _blocks) { ::operator delete(block.data, std::align_val_t{blockAlignment}); }
+    }
+
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    /// @param append Writes after the file's existing contents rather than truncating it.
+    /// @return An error occurred.
+    bool open(const char* filePath, const bool append = false) noexcept
+    {
+        close();
+        const int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (append ? 0 : O_TRUNC);
+        // Appending starts at an arbitrary offset, which O_DIRECT cannot write to
+        if (Config::Files::asyncDirectIo && !append) { _fd = ::open(filePath, flags | O_DIRECT, 0644); }
+        if (_fd < 0) { _fd = ::open(filePath, flags, 0644); }  // O_DIRECT is refused by some filesystems, such as tmpfs
+        if (_fd < 0) { return true; }
+
+        const off_t existingSize = append ? ::lseek(_fd, 0, SEEK_END) : 0;
+        if (existingSize < 0)
+        {
+            ::close(_fd);
+            _fd = -1;
+            return true;
+        }
+
+        for (auto& block : _blocks)
+        {
+            if (block.data == nullptr) { block.data = static_cast<char*>(::operator new(blockSize, std::align_val_t{blockAlignment}, std::nothrow)); }
+            if (block.data == nullptr)
+            {
+                ::close(_fd);
+                _fd = -1;
+                return true;
+            }
+            block.size = 0;
+        }
+        _active = 0;
+        _inFlight = nullptr;
+        _offset = static_cast<uint64_t>(existingSize);
+        _end = _offset;
+        _allocated = _offset;
+        _error = false;
+        _stop = false;
+        _writer = std::thread(&AsyncFileWriter::_run, this);
+        return false;
+    }
+
+    /// @brief Writes out everything appended so far, then closes the file and stops the writer thread.
+    void close() noexcept
+    {
+        if (_fd < 0) { return; }
+        _submit();
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+        _writer.join();
+        if (_allocated > _end) { [[maybe_unused]] const int ret = ::ftruncate(_fd, static_cast<off_t>(_end)); }  // Releases space preallocated past the end
+        ::close(_fd);
+        _fd = -1;
+    }
+
+    /// @return An error occurred, now or in an earlier flush by the writer thread.
+    bool write(const char* buffer, size_t count) noexcept
+    {
+        if (_fd < 0 || _error) { return true; }
+        while (count > 0)
+        {
+            Block& block = _blocks[_active];
+            const size_t toCopy = std::min(count, blockSize - block.size);
+            std::memcpy(block.data + block.size, buffer, toCopy);
+            block.size += toCopy;
+            buffer += toCopy;
+            count -= toCopy;
+            if (block.size == blockSize) { _submit(); }
+        }
+        return _error;
+    }
+
+    /// @brief Waits for all appended bytes to reach the file, then moves the write head back to the start of the file and clears any error.
+    void rewind() noexcept
+    {
+        if (_fd < 0) { return; }
+        _submit();
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] { return _inFlight == nullptr; });
+        _offset = 0;
+        _error = false;
+    }
+
+    bool is_open() const noexcept { return _fd >= 0; }
+
+    /// @brief The writer thread is still flushing the previous block and the current block is over half full, so writes may soon wait on the filesystem.
+    /// Call from the thread which writes.
+    bool isBackPressured() const noexcept { return _inFlightFlag.load(std::memory_order_relaxed) && _blocks[_active].size > blockSize / 2; }
+
+    /// @brief A write of count bytes would wait for the writer thread rather than only copy into a block, so a producer can drop or defer it instead.
+    /// Call from the thread which writes.
+    bool wouldBlock(const size_t count) const noexcept
+    {
+        const size_t pending = _blocks[_active].size + count;
+        if (pending >= 2 * blockSize) { return true; }  // Fills both blocks
+        return pending >= blockSize && _inFlightFlag.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Block
+    {
+        char* data = nullptr;
+        size_t size = 0;
+    };
+
+    /// @brief Hands the active block to the writer thread, first waiting for it to finish the other one.
+    void _submit() noexcept
+    {
+        Block& block = _blocks[_active];
+        if (block.size == 0) { return; }
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this] { return _inFlight == nullptr; });
+            _inFlight = &block;
+            _inFlightFlag.store(true, std::memory_order_relaxed);
+        }
+        _cv.notify_all();
+        _active ^= 1;
+    }
+
+    void _run() noexcept
+    {
+        while (true)
+        {
+            Block* block;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this] { return _inFlight != nullptr || _stop; });
+                if (_inFlight == nullptr) { return; }
+                block = _inFlight;
+            }
+
+            _preallocate(block->size);
+            if (block->size % blockAlignment != 0 && Config::Files::asyncDirectIo)
+            {
+                // Only the final block is partial. O_DIRECT cannot write it, so it goes through the page cache.
+                const int flags = ::fcntl(_fd, F_GETFL);
+                if (flags >= 0 && (flags & O_DIRECT)) { ::fcntl(_fd, F_SETFL, flags & ~O_DIRECT); }
+            }
+            if (_pwriteAll(block->data, block->size)) { _error = true; }
+
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                block->size = 0;
+                _inFlight = nullptr;
+                _inFlightFlag.store(false, std::memory_order_relaxed);
+            }
+            _cv.notify_all();
+        }
+    }
+
+    bool _pwriteAll(const char* data, size_t count) noexcept
+    {
+        while (count > 0)
+        {
+            const ssize_t written = ::pwrite(_fd, data, count, static_cast<off_t>(_offset));
+            if (written < 0)
+            {
+                if (errno == EINTR) { continue; }
+                return true;
+            }
+            data += written;
+            count -= written;
+            _offset += written;
+        }
+        _end = std::max(_end, _offset);
+        return false;
+    }
+
+    void _preallocate(const size_t count) noexcept
+    {
+        if (Config::Files::asyncPreallocateSize == 0 || _offset + count <= _allocated) { return; }
+        if (::fallocate(_fd, FALLOC_FL_KEEP_SIZE, static_cast<off_t>(_allocated), Config::Files::asyncPreallocateSize) == 0)
+        {
+            _allocated += Config::Files::asyncPreallocateSize;
+        }
+        else { _allocated = UINT64_MAX; }  // Unsupported here, so stop trying
+    }
+
+    int _fd = -1;
+    std::array<Block, 2> _blocks;
+    uint8_t _active = 0;  // Block being appended to by the caller
+
+    std::thread _writer;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    Block* _inFlight = nullptr;  // Block being flushed by the writer thread, guarded by _mutex
+    std::atomic<bool> _inFlightFlag = false;
+    bool _stop = false;
+
+    // Owned by the writer thread while it runs
+    uint64_t _offset = 0;
+    uint64_t _end = 0;  // Furthest byte written, which differs from _offset after rewind()
+    uint64_t _allocated = 0;
+    std::atomic<bool> _error = false;
+};
+
+class OutputFile : public OutputFile_Base
+{
+public:
+    OutputFile() {};
+    OutputFile(const Filesystem::FilePath& filePath) { open(filePath); };
+
+    virtual ~OutputFile() {};
+
+    OutputFile(const OutputFile&) = delete;
+    OutputFile operator=(const OutputFile&) = delete;
+
+    OutputFile(OutputFile&& rhs) : _writer(std::move(rhs._writer)) {}
+
+    OutputFile& operator=(OutputFile&& rhs) noexcept
+    {
+        if (this != &rhs) { _writer = std::move(rhs._writer); }
+        return *this;
+    }
+
+    virtual bool open(const Filesystem::FilePath& filePath) override final
+    {
+        if (_writer == nullptr) { _writer = std::make_unique<AsyncFileWriter>(); }
+        return _writer->open(filePath.c_str());
+    }
+
+    virtual bool openAppend(const Filesystem::FilePath& filePath) override final
+    {
+        if (_writer == nullptr) { _writer = std::make_unique<AsyncFileWriter>(); }
+        return _writer->open(filePath.c_str(), true);
+    }
+
+    virtual void close() override final
+    {
+        if (_writer) { _writer->close(); }
+    };
+
+    virtual bool write(const char* buffer, const size_t count) override final
+    {
+        if (_writer == nullptr) { return true; }
+        return _writer->write(buffer, count);
+    }
+
+    virtual bool write(const char* buffer) override final { return write(buffer, std::strlen(buffer)); }
+
+    virtual bool writeLine(const char* buffer, const size_t count) override final
+    {
+        if (write(buffer, count)) { return true; }
+        return write("\n", 1);
+    }
+
+    virtual bool writeLine(const char* buffer) override final { return writeLine(buffer, std::strlen(buffer)); }
+
+    virtual bool is_open() const override final { return _writer && _writer->is_open(); }
+
+    virtual void reset() override final
+    {
+        if (_writer) { _writer->rewind(); }
+    }
+
+    /// @brief Writes are outpacing the filesystem and may soon block. Memory use stays bounded at two blocks per file regardless.
+    bool isBackPressured() const noexcept { return _writer && _writer->isBackPressured(); }
+
+    /// @brief A write of count bytes would block on the filesystem. Never blocks itself, so writers can shed load instead of stalling.
+    bool wouldBlock(const size_t count) const noexcept { return _writer && _writer->wouldBlock(count); }
+
+private:
+    std::unique_ptr<AsyncFileWriter> _writer = nullptr;
+};
+
+}  // namespace VN
+
+#endif  // HAL_FILE_LINUXASYNC_HPP
@@ -160,6 +160,13 @@ public:
         }
     }
 
+    virtual bool seek(const size_t position) override final
+    {
+        if (_file == nullptr) { return true; }
+        clearerr(_file);
+        return (fseek(_file, static_cast<long>(position), SEEK_SET) != 0);
+    }
+
 private:
     FILE* _file;
     bool _nullTerminateRead;
@@ -209,6 +216,17 @@ public:
         return (_file == nullptr);
     }
 
+    virtual bool openAppend(const Filesystem::FilePath& filePath) override final
+    {
+        if (_file != nullptr)
+        {
+            close();
+        }
+
+        _file = fopen(filePath.c_str(), "ab");
+        return (_file == nullptr);
+    }
+
     virtual void close() override final
     {
         if (_file != nullptr)
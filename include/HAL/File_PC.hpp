@@ -27,9 +27,14 @@
 #include <fstream>
 #include <ios>
 #include <filesystem>
+#include "Config.hpp"
 #include "HAL/File_Base.hpp"
 #include "TemplateLibrary/String.hpp"
 
+#if ASYNC_FILE_WRITE_ENABLE && defined(__linux__)
+#include "HAL/File_LinuxAsync.hpp"
+#endif
+
 namespace VN
 {
 
@@ -104,11 +109,19 @@ public:
         _file.seekg(0, std::ios::beg);
     }
 
+    virtual bool seek(const size_t position) override final
+    {
+        _file.clear();
+        _file.seekg(position, std::ios::beg);
+        return !_file.good();
+    }
+
 private:
     std::ifstream _file;
     bool _nullTerminateRead;
 };
 
+#if !(ASYNC_FILE_WRITE_ENABLE && defined(__linux__))
 class OutputFile : public OutputFile_Base
 {
 public:
@@ -134,6 +147,12 @@ public:
         return !_file.good();
     }
 
+    virtual bool openAppend(const Filesystem::FilePath& filePath) override final
+    {
+        _file.open(filePath.c_str(), std::ios_base::binary | std::ios_base::app);
+        return !_file.good();
+    }
+
     virtual void close() override final { _file.close(); };
 
     virtual bool write(const char* buffer, const size_t count) override final
@@ -161,9 +180,16 @@ public:
         _file.seekp(0, std::ios::beg);
     }
 
+    /// @brief Writes are outpacing the filesystem and may soon block. Always false, as writes here are synchronous.
+    bool isBackPressured() const noexcept { return false; }
+
+    /// @brief A write of count bytes would block on the filesystem. Always false, as writes here are synchronous.
+    bool wouldBlock([[maybe_unused]] const size_t count) const noexcept { return false; }
+
 private:
     std::ofstream _file;
 };
+#endif
 
 }  // namespace VN
 
@@ -28,7 +28,11 @@
 
 #if (THREADING_ENABLE)
 
+#if defined(__linux__) && !defined(ARDUINO)
+#include "HAL/Mutex_PC.hpp"  // Host builds, e.g. the tests
+#else
 #include "HAL/Mutex_MBED.hpp"
+#endif
 
 #else  // THREADING_ENABLE
 
@@ -24,6 +24,10 @@
 #ifndef HAL_SERIAL_HPP
 #define HAL_SERIAL_HPP
 
+#if defined(__linux__) && !defined(ARDUINO)
+#include "HAL/Serial_Linux.hpp"  // Host builds, e.g. against SensorSimulator
+#else
 #include "HAL/Serial_Mbed.hpp"
+#endif
 
 #endif  // HAL_SERIAL_HPP
@@ -81,7 +81,7 @@ public:
 
 protected:
     ByteBuffer& _byteBuffer;
-    static const size_t _numBytesToReadPerGetData = Config::Serial::numBytesToReadPerGetData;
+    static constexpr size_t _numBytesToReadPerGetData = Config::Serial::numBytesToReadPerGetData;
     bool _isOpen = false;
     PortName _portName;
     uint32_t _baudRate = 0;
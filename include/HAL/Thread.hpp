@@ -24,6 +24,10 @@
 #ifndef HAL_THREAD_HPP
 #define HAL_THREAD_HPP
 
+#if defined(__linux__) && !defined(ARDUINO)
+#include "HAL/Thread_PC.hpp"  // Host builds, e.g. the tests
+#else
 #include "HAL/Thread_Mbed.hpp"
+#endif
 
 #endif  // HAL_THREAD_HPP
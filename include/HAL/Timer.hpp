@@ -24,6 +24,10 @@
 #ifndef HAL_TIMER_HPP
 #define HAL_TIMER_HPP
 
+#if defined(__linux__) && !defined(ARDUINO)
+#include "HAL/Timer_PC.hpp"  // Host builds, e.g. the tests
+#else
 #include "HAL/Timer_Mbed.hpp"
+#endif
 
 #endif  // HAL_TIMER_HPP
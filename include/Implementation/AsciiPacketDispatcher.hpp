@@ -33,6 +33,8 @@
 #include "Implementation/CommandProcessor.hpp"
 #include "Implementation/AsciiPacketProtocol.hpp"
 #include "Implementation/QueueDefinitions.hpp"
+#include "Implementation/LatestMeasurements.hpp"
+#include "Implementation/LinkMonitor.hpp"
 #include "Config.hpp"
 
 namespace VN
@@ -40,8 +42,15 @@ namespace VN
 class AsciiPacketDispatcher : public PacketDispatcher
 {
 public:
-    AsciiPacketDispatcher(MeasurementQueue* measurementQueue, EnabledMeasurements enabledMeasurements, CommandProcessor* commandProcessor)
-        : PacketDispatcher{{'$'}}, _compositeDataQueue(measurementQueue), _enabledMeasurements(enabledMeasurements), _commandProcessor(commandProcessor)
+    /// @param deferredPacketQueue If passed, measurements for the measurement queue are pushed here raw rather than parsed, to be parsed later by
+    /// parseDeferredPacket on the consumer's thread. Share it with the FaPacketDispatcher so both kinds of measurement keep their arrival order.
+    AsciiPacketDispatcher(MeasurementQueue* measurementQueue, EnabledMeasurements enabledMeasurements, CommandProcessor* commandProcessor,
+                          PacketQueue_Interface* deferredPacketQueue = nullptr)
+        : PacketDispatcher{{'$'}},
+          _compositeDataQueue(measurementQueue),
+          _enabledMeasurements(enabledMeasurements),
+          _commandProcessor(commandProcessor),
+          _deferredPacketQueue(deferredPacketQueue)
     {
     }
 
@@ -49,6 +58,17 @@ public:
 
     void dispatchPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept override;
 
+    /// @brief Sets where each measurement is published as the latest, in addition to the measurement queue. Pass nullptr to stop publishing. Deferred
+    /// measurements are published too; publishing only copies the packet, so nothing more is parsed on the listening thread.
+    void setLatestMeasurements(LatestMeasurements* const latestMeasurements) noexcept { _latestMeasurements = latestMeasurements; }
+
+    /// @brief Sets the monitor to which each packet's message type is reported. Pass nullptr to stop reporting.
+    void setLinkMonitor(LinkMonitor* const linkMonitor) noexcept { _linkMonitor = linkMonitor; }
+
+    /// @brief Parses a measurement popped from the deferred packet queue, pushing the result to the measurement queue. Safe to call from any thread.
+    /// @return True if the packet could not be parsed or the measurement queue is full.
+    bool parseDeferredPacket(const Packet& packet) noexcept;
+
     enum class SubscriberFilterType
     {
         StartsWith,
@@ -63,9 +83,12 @@ public:
 private:
     MeasurementQueue* _compositeDataQueue;
     [[maybe_unused]] EnabledMeasurements _enabledMeasurements;
+    LatestMeasurements* _latestMeasurements = nullptr;
+    LinkMonitor* _linkMonitor = nullptr;
 
     AsciiPacketProtocol::Metadata _latestPacketMetadata;
     CommandProcessor* _commandProcessor;
+    PacketQueue_Interface* _deferredPacketQueue;
     struct Subscriber
     {
         PacketQueue_Interface* queueToPush;
@@ -80,8 +103,8 @@ private:
     bool _tryPushToCompositeDataQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata,
                                       AsciiPacketProtocol::AsciiMeasurementHeader measEnum) noexcept;
     void _invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata) noexcept;
-    bool _tryPushToSubscriber(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata,
-                              Subscriber& subscriber) noexcept;
+    bool _tryPushToPacketQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata,
+                               PacketQueue_Interface* packetQueue) noexcept;
 };
 }  // namespace VN
 
@@ -135,11 +135,10 @@ public:
     {
         AsciiPacketProtocol::AsciiParameter asciiParameter;
         if (_delIndex + 1 >= _metadata.delimiterIndices.size()) { return std::nullopt; }
-        if (_buffer.peek(reinterpret_cast<uint8_t*>(asciiParameter.begin()),
-                         _metadata.delimiterIndices[_delIndex + 1] - 1 - _metadata.delimiterIndices[_delIndex], _metadata.delimiterIndices[_delIndex] + 1))
-        {
-            return std::nullopt;
-        }
+        const size_t parameterLength = _metadata.delimiterIndices[_delIndex + 1] - 1 - _metadata.delimiterIndices[_delIndex];
+        if (parameterLength > AsciiPacketProtocol::AsciiParameter::capacity()) { return std::nullopt; }
+        if (_buffer.peek(reinterpret_cast<uint8_t*>(asciiParameter.data()), parameterLength, _metadata.delimiterIndices[_delIndex] + 1)) { return std::nullopt; }
+        asciiParameter.setLength(parameterLength);
         return asciiParameter;
     }
 
@@ -26,6 +26,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include "Implementation/MeasurementDatatypes.hpp"
 #include "TemplateLibrary/Vector.hpp"
 #include "TemplateLibrary/String.hpp"  // Only used for AsciiHeader definition
@@ -162,11 +163,32 @@ template <size_t OutputCapacity>
 String<OutputCapacity> binaryHeaderToString(const BinaryHeader& binaryHeader) noexcept
 {
     String<OutputCapacity> retVal;
-    for (const auto groupByte : binaryHeader.outputGroups) { std::snprintf(retVal.end(), retVal.numAvailable(), ",%02X", groupByte); }
-    for (const auto typeWord : binaryHeader.outputTypes) { std::snprintf(retVal.end(), retVal.numAvailable(), ",%04X", typeWord); }
+    char field[8];  // Formatted aside and appended, so the String's length stays exact
+    for (const auto groupByte : binaryHeader.outputGroups)
+    {
+        std::snprintf(field, sizeof(field), ",%02X", groupByte);
+        retVal.append(field, sizeof(field));
+    }
+    for (const auto typeWord : binaryHeader.outputTypes)
+    {
+        std::snprintf(field, sizeof(field), ",%04X", typeWord);
+        retVal.append(field, sizeof(field));
+    }
     return retVal;
 }
 
 }  // namespace VN
 
+template <>
+struct std::hash<VN::BinaryHeader>
+{
+    size_t operator()(const VN::BinaryHeader& header) const noexcept
+    {
+        size_t hash = 0;
+        for (const auto groupByte : header.outputGroups) { hash ^= static_cast<size_t>(groupByte) + 0x9e3779b9 + (hash << 6) + (hash >> 2); }
+        for (const auto typeWord : header.outputTypes) { hash ^= static_cast<size_t>(typeWord) + 0x9e3779b9 + (hash << 6) + (hash >> 2); }
+        return hash;
+    }
+};
+
 #endif  // IMPLEMENTATION_BINARYHEADER_HPP
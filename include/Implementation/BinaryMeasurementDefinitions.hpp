@@ -260,7 +260,7 @@ namespace VN
     };
     
     /// @brief Return the number of bytes associated with a binary field.
-    inline std::optional<uint8_t> getStaticBinaryTypeSize(const size_t binaryGroup, const size_t binaryField)
+    inline constexpr std::optional<uint8_t> getStaticBinaryTypeSize(const size_t binaryGroup, const size_t binaryField)
     {
         switch(binaryGroup)
         {
@@ -270,63 +270,63 @@ namespace VN
                 {
                     case 0: // TimeStartup
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 1: // TimeGps
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 2: // TimeSyncIn
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 3: // Ypr
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 4: // Quaternion
                     {
-                        return std::make_optional(16);
+                        return std::make_optional<uint8_t>(16);
                     }
                     case 5: // AngularRate
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 6: // PosLla
                     {
-                        return std::make_optional(24);
+                        return std::make_optional<uint8_t>(24);
                     }
                     case 7: // VelNed
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 8: // Accel
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 9: // Imu
                     {
-                        return std::make_optional(24);
+                        return std::make_optional<uint8_t>(24);
                     }
                     case 10: // MagPres
                     {
-                        return std::make_optional(20);
+                        return std::make_optional<uint8_t>(20);
                     }
                     case 11: // Deltas
                     {
-                        return std::make_optional(28);
+                        return std::make_optional<uint8_t>(28);
                     }
                     case 12: // InsStatus
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 13: // SyncInCnt
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 14: // TimeGpsPps
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     default:
                     return std::nullopt;
@@ -338,43 +338,43 @@ namespace VN
                 {
                     case 0: // TimeStartup
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 1: // TimeGps
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 2: // TimeGpsTow
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 3: // TimeGpsWeek
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 4: // TimeSyncIn
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 5: // TimeGpsPps
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 6: // TimeUtc
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 7: // SyncInCnt
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 8: // SyncOutCnt
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 9: // TimeStatus
                     {
-                        return std::make_optional(1);
+                        return std::make_optional<uint8_t>(1);
                     }
                     default:
                     return std::nullopt;
@@ -386,55 +386,55 @@ namespace VN
                 {
                     case 0: // ImuStatus
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 1: // UncompMag
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 2: // UncompAccel
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 3: // UncompGyro
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 4: // Temperature
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 5: // Pressure
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 6: // DeltaTheta
                     {
-                        return std::make_optional(16);
+                        return std::make_optional<uint8_t>(16);
                     }
                     case 7: // DeltaVel
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 8: // Mag
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 9: // Accel
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 10: // AngularRate
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 11: // SensSat
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 12:
                     {
-                        return std::make_optional(40);
+                        return std::make_optional<uint8_t>(40);
                     }
                     default:
                     return std::nullopt;
@@ -446,67 +446,67 @@ namespace VN
                 {
                     case 0: // Gnss1TimeUtc
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 1: // Gps1Tow
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 2: // Gps1Week
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 3: // Gnss1NumSats
                     {
-                        return std::make_optional(1);
+                        return std::make_optional<uint8_t>(1);
                     }
                     case 4: // Gnss1Fix
                     {
-                        return std::make_optional(1);
+                        return std::make_optional<uint8_t>(1);
                     }
                     case 5: // Gnss1PosLla
                     {
-                        return std::make_optional(24);
+                        return std::make_optional<uint8_t>(24);
                     }
                     case 6: // Gnss1PosEcef
                     {
-                        return std::make_optional(24);
+                        return std::make_optional<uint8_t>(24);
                     }
                     case 7: // Gnss1VelNed
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 8: // Gnss1VelEcef
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 9: // Gnss1PosUncertainty
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 10: // Gnss1VelUncertainty
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 11: // Gnss1TimeUncertainty
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 12: // Gnss1TimeInfo
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 13: // Gnss1Dop
                     {
-                        return std::make_optional(28);
+                        return std::make_optional<uint8_t>(28);
                     }
                     case 17: // Gnss1Status
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 18: // Gnss1AltMSL
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     default:
                     return std::nullopt;
@@ -518,59 +518,59 @@ namespace VN
                 {
                     case 0:
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 1: // Ypr
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 2: // Quaternion
                     {
-                        return std::make_optional(16);
+                        return std::make_optional<uint8_t>(16);
                     }
                     case 3: // Dcm
                     {
-                        return std::make_optional(36);
+                        return std::make_optional<uint8_t>(36);
                     }
                     case 4: // MagNed
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 5: // AccelNed
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 6: // LinBodyAcc
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 7: // LinAccelNed
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 8: // YprU
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 9:
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 10:
                     {
-                        return std::make_optional(28);
+                        return std::make_optional<uint8_t>(28);
                     }
                     case 11:
                     {
-                        return std::make_optional(24);
+                        return std::make_optional<uint8_t>(24);
                     }
                     case 12: // Heave
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 13: // AttU
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     default:
                     return std::nullopt;
@@ -582,55 +582,55 @@ namespace VN
                 {
                     case 0: // InsStatus
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 1: // PosLla
                     {
-                        return std::make_optional(24);
+                        return std::make_optional<uint8_t>(24);
                     }
                     case 2: // PosEcef
                     {
-                        return std::make_optional(24);
+                        return std::make_optional<uint8_t>(24);
                     }
                     case 3: // VelBody
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 4: // VelNed
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 5: // VelEcef
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 6: // MagEcef
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 7: // AccelEcef
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 8: // LinAccelEcef
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 9: // PosU
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 10: // VelU
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 11:
                     {
-                        return std::make_optional(68);
+                        return std::make_optional<uint8_t>(68);
                     }
                     case 12:
                     {
-                        return std::make_optional(64);
+                        return std::make_optional<uint8_t>(64);
                     }
                     default:
                     return std::nullopt;
@@ -642,67 +642,67 @@ namespace VN
                 {
                     case 0: // Gnss2TimeUtc
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 1: // Gps2Tow
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 2: // Gps2Week
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 3: // Gnss2NumSats
                     {
-                        return std::make_optional(1);
+                        return std::make_optional<uint8_t>(1);
                     }
                     case 4: // Gnss2Fix
                     {
-                        return std::make_optional(1);
+                        return std::make_optional<uint8_t>(1);
                     }
                     case 5: // Gnss2PosLla
                     {
-                        return std::make_optional(24);
+                        return std::make_optional<uint8_t>(24);
                     }
                     case 6: // Gnss2PosEcef
                     {
-                        return std::make_optional(24);
+                        return std::make_optional<uint8_t>(24);
                     }
                     case 7: // Gnss2VelNed
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 8: // Gnss2VelEcef
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 9: // Gnss2PosUncertainty
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 10: // Gnss2VelUncertainty
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 11: // Gnss2TimeUncertainty
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 12: // Gnss2TimeInfo
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 13: // Gnss2Dop
                     {
-                        return std::make_optional(28);
+                        return std::make_optional<uint8_t>(28);
                     }
                     case 17: // Gnss2Status
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 18: // Gnss2AltMSL
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     default:
                     return std::nullopt;
@@ -714,67 +714,67 @@ namespace VN
                 {
                     case 0: // Gnss3TimeUtc
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 1: // Gps3Tow
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 2: // Gps3Week
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 3: // Gnss3NumSats
                     {
-                        return std::make_optional(1);
+                        return std::make_optional<uint8_t>(1);
                     }
                     case 4: // Gnss3Fix
                     {
-                        return std::make_optional(1);
+                        return std::make_optional<uint8_t>(1);
                     }
                     case 5: // Gnss3PosLla
                     {
-                        return std::make_optional(24);
+                        return std::make_optional<uint8_t>(24);
                     }
                     case 6: // Gnss3PosEcef
                     {
-                        return std::make_optional(24);
+                        return std::make_optional<uint8_t>(24);
                     }
                     case 7: // Gnss3VelNed
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 8: // Gnss3VelEcef
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 9: // Gnss3PosUncertainty
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 10: // Gnss3VelUncertainty
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 11: // Gnss3TimeUncertainty
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 12: // Gnss3TimeInfo
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 13: // Gnss3Dop
                     {
-                        return std::make_optional(28);
+                        return std::make_optional<uint8_t>(28);
                     }
                     case 17: // Gnss3Status
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 18: // Gnss3AltMSL
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     default:
                     return std::nullopt;
@@ -786,51 +786,51 @@ namespace VN
                 {
                     case 0:
                     {
-                        return std::make_optional(48);
+                        return std::make_optional<uint8_t>(48);
                     }
                     case 1:
                     {
-                        return std::make_optional(48);
+                        return std::make_optional<uint8_t>(48);
                     }
                     case 2:
                     {
-                        return std::make_optional(48);
+                        return std::make_optional<uint8_t>(48);
                     }
                     case 3:
                     {
-                        return std::make_optional(92);
+                        return std::make_optional<uint8_t>(92);
                     }
                     case 4:
                     {
-                        return std::make_optional(80);
+                        return std::make_optional<uint8_t>(80);
                     }
                     case 5:
                     {
-                        return std::make_optional(76);
+                        return std::make_optional<uint8_t>(76);
                     }
                     case 6:
                     {
-                        return std::make_optional(68);
+                        return std::make_optional<uint8_t>(68);
                     }
                     case 7:
                     {
-                        return std::make_optional(20);
+                        return std::make_optional<uint8_t>(20);
                     }
                     case 8:
                     {
-                        return std::make_optional(40);
+                        return std::make_optional<uint8_t>(40);
                     }
                     case 9:
                     {
-                        return std::make_optional(60);
+                        return std::make_optional<uint8_t>(60);
                     }
                     case 10:
                     {
-                        return std::make_optional(320);
+                        return std::make_optional<uint8_t>(320);
                     }
                     case 11:
                     {
-                        return std::make_optional(192);
+                        return std::make_optional<uint8_t>(192);
                     }
                     default:
                     return std::nullopt;
@@ -842,63 +842,63 @@ namespace VN
                 {
                     case 0:
                     {
-                        return std::make_optional(8);
+                        return std::make_optional<uint8_t>(8);
                     }
                     case 1:
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 2:
                     {
-                        return std::make_optional(2);
+                        return std::make_optional<uint8_t>(2);
                     }
                     case 3:
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 4:
                     {
-                        return std::make_optional(36);
+                        return std::make_optional<uint8_t>(36);
                     }
                     case 5:
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 6:
                     {
-                        return std::make_optional(36);
+                        return std::make_optional<uint8_t>(36);
                     }
                     case 7:
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 8:
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 9:
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 10:
                     {
-                        return std::make_optional(4);
+                        return std::make_optional<uint8_t>(4);
                     }
                     case 11:
                     {
-                        return std::make_optional(40);
+                        return std::make_optional<uint8_t>(40);
                     }
                     case 12:
                     {
-                        return std::make_optional(144);
+                        return std::make_optional<uint8_t>(144);
                     }
                     case 13:
                     {
-                        return std::make_optional(12);
+                        return std::make_optional<uint8_t>(12);
                     }
                     case 14:
                     {
-                        return std::make_optional(36);
+                        return std::make_optional<uint8_t>(36);
                     }
                     default:
                     return std::nullopt;
@@ -910,15 +910,15 @@ namespace VN
                 {
                     case 0:
                     {
-                        return std::make_optional(143);
+                        return std::make_optional<uint8_t>(143);
                     }
                     case 1:
                     {
-                        return std::make_optional(144);
+                        return std::make_optional<uint8_t>(144);
                     }
                     case 2:
                     {
-                        return std::make_optional(78);
+                        return std::make_optional<uint8_t>(78);
                     }
                     default:
                     return std::nullopt;
@@ -0,0 +1,76 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef IMPLEMENTATION_BUFFERAUTOTUNER_HPP
+#define IMPLEMENTATION_BUFFERAUTOTUNER_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+
+#include "HAL/Timer.hpp"
+#include "Config.hpp"
+
+namespace VN
+{
+
+/// @brief Observes the serial link for Config::Sensor::bufferAutoTuneWindow after connecting, then recommends main buffer and measurement queue capacities
+/// for the observed data rate. The main buffer is sized to absorb a stall of the listening thread, and the queue a stall of the consumer. Observation then
+/// continues in windows of the same length, so that a data rate raised after the first window (e.g. by a register write) is caught; those later
+/// recommendations are only meant to grow the buffers, never to shrink them below the first.
+class BufferAutoTuner
+{
+public:
+    struct Recommendation
+    {
+        size_t mainBufferCapacity;
+        uint16_t measurementQueueCapacity;
+        bool isInitial;  // From the first window after start(). Later recommendations should only be applied where larger than the current capacities.
+    };
+
+    /// @brief Begins (or restarts) an observation window.
+    /// @param baudRate The host baud rate, which bounds the data rate from below if the unit is quieter during the window than it will be later.
+    void start(const uint32_t baudRate) noexcept;
+
+    /// @brief Records one read from the serial port. Must be called after each read, whether or not data arrived.
+    /// @param numBytesRead The number of bytes the read added to the main buffer.
+    /// @param numPacketsTotal The running total of valid measurement packets found.
+    /// @return A recommendation, each time an observation window has elapsed.
+    std::optional<Recommendation> observe(const size_t numBytesRead, const size_t numPacketsTotal) noexcept;
+
+    bool isTuning() const noexcept { return _isTuning; }
+
+private:
+    bool _isTuning = false;
+    bool _hasBaseline = false;
+    bool _isInitialWindow = false;
+    uint32_t _baudRate = 0;
+    time_point _startTime;
+    size_t _startPacketCount = 0;
+    size_t _numBytesRead = 0;
+    size_t _maxBytesPerRead = 0;
+};
+
+}  // namespace VN
+
+#endif  // IMPLEMENTATION_BUFFERAUTOTUNER_HPP
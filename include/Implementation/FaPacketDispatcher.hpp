@@ -26,6 +26,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <limits>
 
@@ -35,6 +36,10 @@
 #include "Implementation/FaPacketProtocol.hpp"
 #include "Implementation/QueueDefinitions.hpp"
 #include "Implementation/BinaryHeader.hpp"
+#include "Implementation/LatestMeasurements.hpp"
+#include "Implementation/LinkMonitor.hpp"
+#include "Interface/CompactCompositeData.hpp"
+#include "Interface/CompositeDataView.hpp"
 #include "Config.hpp"
 
 namespace VN
@@ -43,15 +48,62 @@ namespace VN
 class FaPacketDispatcher : public PacketDispatcher
 {
 public:
-    FaPacketDispatcher(MeasurementQueue* measurementQueue, EnabledMeasurements enabledMeasurements)
-        : PacketDispatcher({0xFA}), _compositeDataQueue(measurementQueue), _enabledMeasurements(enabledMeasurements)
+    /// @param deferredPacketQueue If passed, packets for the measurement queue are pushed here raw rather than parsed, to be parsed later by
+    /// parseDeferredPacket on the consumer's thread.
+    FaPacketDispatcher(MeasurementQueue* measurementQueue, EnabledMeasurements enabledMeasurements, PacketQueue_Interface* deferredPacketQueue = nullptr)
+        : PacketDispatcher({0xFA}), _compositeDataQueue(measurementQueue), _enabledMeasurements(enabledMeasurements), _deferredPacketQueue(deferredPacketQueue)
     {
     }
 
+    /// @brief A handler for a single, fixed binary header which bypasses the generic header parsing and CompositeData parsing. Packets it matches are
+    /// handed to it in place of the measurement queue; all other packets fall back to the generic path. See FixedLayoutFastPath.
+    class FastPath
+    {
+    public:
+        virtual ~FastPath() = default;
+
+        /// @brief Whether the packet at syncByteIndex has this handler's header and a valid crc. Only called once length() bytes are available.
+        virtual bool matches(const ByteBuffer& byteBuffer, const size_t syncByteIndex) const noexcept = 0;
+
+        /// @brief Handles a matched packet.
+        /// @return True if the packet could not be handled.
+        virtual bool dispatch(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const time_point timestamp) noexcept = 0;
+
+        virtual size_t length() const noexcept = 0;
+        virtual const BinaryHeader& header() const noexcept = 0;
+    };
+
+    void registerFastPath(FastPath* const fastPath) noexcept { _fastPath = fastPath; }
+    void deregisterFastPath() noexcept { _fastPath = nullptr; }
+
+    /// @brief Sets where each measurement is published as the latest, in addition to the measurement queue. Pass nullptr to stop publishing. Packets taken
+    /// by a FastPath or deferred for later parsing are published too; publishing only copies the packet, so nothing more is parsed on the listening thread.
+    void setLatestMeasurements(LatestMeasurements* const latestMeasurements) noexcept { _latestMeasurements = latestMeasurements; }
+
+    /// @brief Sets the monitor to which each packet's binary output, and TimeStartup or else SyncOutCnt for gap detection, is reported. Pass nullptr to stop
+    /// reporting.
+    void setLinkMonitor(LinkMonitor* const linkMonitor) noexcept { _linkMonitor = linkMonitor; }
+
+    /// @brief Sets a queue to which measurements are pushed as CompactCompositeData, in place of the measurement queue. GNSS SatInfo and RawMeas are held in
+    /// gnssSlab, which should hold one block of each per queue entry. Deferred packets are populated into it by parseDeferredPacket. Pass nullptr to push
+    /// to the measurement queue again.
+    /// @return True if the buffer used to linearize packets which wrap the end of the byte buffer could not be allocated.
+    bool setCompactMeasurementQueue(DirectAccessQueue_Interface<CompactCompositeData>* const compactMeasurementQueue, CompactGnssSlab* const gnssSlab) noexcept;
+
     PacketDispatcher::FindPacketRetVal findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept override;
 
     void dispatchPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept override;
 
+    /// @brief Parses a packet popped from the deferred packet queue, pushing the result to the measurement queue, or the compact measurement queue if set.
+    /// Safe to call from any thread.
+    /// @return True if the packet could not be parsed or the measurement queue is full.
+    bool parseDeferredPacket(const Packet& packet) noexcept;
+
+    /// @brief Dispatches a complete packet that starts at the head of byteBuffer and whose CRC is already known to be valid, as for packets
+    /// reassembled from FB fragments. Only the header is read to frame it; the CRC is not recomputed.
+    /// @return True if the header does not describe a packet of exactly byteBuffer.size() bytes.
+    bool dispatchReassembledPacket(const ByteBuffer& byteBuffer) noexcept;
+
     enum class SubscriberFilterType
     {
         ExactMatch,
@@ -78,10 +130,33 @@ protected:
 
     MeasurementQueue* _compositeDataQueue;
     EnabledMeasurements _enabledMeasurements;
+    PacketQueue_Interface* _deferredPacketQueue;
+    LatestMeasurements* _latestMeasurements = nullptr;
+    LinkMonitor* _linkMonitor = nullptr;
     FaPacketProtocol::Metadata _latestPacketMetadata;
 
+    FastPath* _fastPath = nullptr;
+    bool _latestPacketIsFastPath = false;
+
+    DirectAccessQueue_Interface<CompactCompositeData>* _compactMeasurementQueue = nullptr;
+    CompactGnssSlab* _compactGnssSlab = nullptr;
+    CompositeDataView::OffsetTable _compactOffsetTable;
+    std::unique_ptr<uint8_t[]> _compactLinearBuffer;  // Holds a packet which wraps the end of the byte buffer, as CompactCompositeData needs linear bytes
+
+    BinaryHeader _syncOutCntHeader;            // The binary output _syncOutCntOffset was found for
+    std::optional<uint16_t> _syncOutCntOffset;  // The payload offset of SyncOutCnt in _syncOutCntHeader, if it outputs it
+
+    bool _findFastPathPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept;
+    void _reportToLinkMonitor(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept;
+    static std::optional<uint16_t> _findSyncOutCntOffset(const BinaryHeader& header) noexcept;
+
     bool _tryPushToCompositeDataQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails) noexcept;
+    bool _tryPushToCompactMeasurementQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails) noexcept;
+    bool _tryPushToCompactMeasurementQueue(const uint8_t* packet, const FaPacketProtocol::Metadata& packetDetails) noexcept;
+    void _publishLatestMeasurements(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails) noexcept;
     void _invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails) noexcept;
+    bool _tryPushToPacketQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
+                               PacketQueue_Interface* packetQueue) noexcept;
     bool _tryPushToSubscriber(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
                               Subscriber& subscriber) noexcept;
 };
@@ -55,7 +55,8 @@ struct FindPacketReturn
     Metadata metadata;
 };
 
-FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept;
+/// @param validateCrc May be false only when the packet's CRC is already known to be correct, e.g. when it was computed while reassembling it.
+FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const bool validateCrc = true) noexcept;
 
 std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata,
                                          const EnabledMeasurements& measurementsToParse) noexcept;
@@ -59,6 +59,7 @@ private:
     ByteBuffer _fbByteBuffer;
     FbPacketProtocol::Metadata _latestPacketMetadata{};
     FbPacketProtocol::Metadata _previousPacketMetadata{};
+    uint16_t _runningCrc = 0;  // CRC of the FA packet reassembled so far, excluding its sync byte
 
     void _resetFbBuffer() noexcept;
     void _addFaPacketCrc() noexcept;
@@ -0,0 +1,204 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef IMPLEMENTATION_LATESTMEASUREMENTS_HPP
+#define IMPLEMENTATION_LATESTMEASUREMENTS_HPP
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+#include "TemplateLibrary/ByteBuffer.hpp"
+#include "TemplateLibrary/SeqLock.hpp"
+#include "Interface/CompositeData.hpp"
+#include "Implementation/AsciiPacketProtocol.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "Implementation/MeasurementDatatypes.hpp"
+#include "Implementation/Packet.hpp"
+#include "Config.hpp"
+
+namespace VN
+{
+
+/// @brief The most recent measurement received, and the most recent sample of each measurement group, for consumers which only need the newest state
+/// rather than every measurement. Written by the packet dispatchers as each measurement is dispatched, regardless of whether the measurement queue has room.
+/// The listening thread only copies each packet's bytes into its slots; a measurement is parsed when it is read, on the reader's thread, so publishing costs
+/// the same whether the packet is parsed on the listening thread, deferred, or taken by a fast path.
+/// Reads are lock-free, never block the listening thread, and may be made from any number of threads.
+class LatestMeasurements
+{
+public:
+    /// @brief A single measurement group, as it was in the most recent measurement to contain it.
+    template <class GroupType>
+    struct GroupSample
+    {
+        time_point timestamp;
+        GroupType group;
+    };
+
+    /// @brief Packets longer than this are not published, e.g. binary outputs with GNSS SatInfo or RawMeas.
+    static constexpr uint16_t packetMaxLength = Config::PacketDispatchers::latestPacketMaxLength;
+
+    /// @brief Publishes an FA packet. Only the groups present in its header are updated, so that e.g. a GNSS-only output does not clear the attitude seen
+    /// in another output.
+    /// @param metadata The packet's metadata, whose timestamp stamps the samples.
+    void publish(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& metadata) noexcept
+    {
+        if (metadata.length > packetMaxLength) { return; }
+        _RawPacket packet;
+        packet.details.syncByte = PacketDetails::SyncByte::FA;
+        packet.details.faMetadata = metadata;
+        byteBuffer.peek_unchecked(packet.bytes.data(), metadata.length, syncByteIndex);
+        _store(packet, metadata.header.toMeasurementHeader());
+    }
+
+    /// @brief Publishes an ASCII measurement, updating the groups its header maps to.
+    void publish(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata,
+                 const AsciiPacketProtocol::AsciiMeasurementHeader measEnum) noexcept
+    {
+        if (metadata.length > packetMaxLength) { return; }
+        _RawPacket packet;
+        packet.details.syncByte = PacketDetails::SyncByte::Ascii;
+        packet.details.asciiMetadata = metadata;
+        byteBuffer.peek_unchecked(packet.bytes.data(), metadata.length, syncByteIndex);
+        _store(packet, AsciiPacketProtocol::asciiHeaderToMeasHeader(measEnum));
+    }
+
+    /// @brief The most recent measurement, or nullopt if none has been received.
+    std::optional<CompositeData> measurement() const noexcept { return _parse(_packet); }
+
+    /// @brief Incremented by each measurement received. Polling consumers can compare against a previous value to check for new data without copying it.
+    uint32_t version() const noexcept { return _packet.version(); }
+
+#if (TIME_GROUP_ENABLE)
+    std::optional<GroupSample<CompositeData::TimeGroup>> time() const noexcept { return _parseGroup(_time, &CompositeData::time); }
+#endif
+#if (IMU_GROUP_ENABLE)
+    std::optional<GroupSample<CompositeData::ImuGroup>> imu() const noexcept { return _parseGroup(_imu, &CompositeData::imu); }
+#endif
+#if (GNSS_GROUP_ENABLE)
+    std::optional<GroupSample<CompositeData::GnssGroup>> gnss() const noexcept { return _parseGroup(_gnss, &CompositeData::gnss); }
+#endif
+#if (ATTITUDE_GROUP_ENABLE)
+    std::optional<GroupSample<CompositeData::AttitudeGroup>> attitude() const noexcept { return _parseGroup(_attitude, &CompositeData::attitude); }
+#endif
+#if (INS_GROUP_ENABLE)
+    std::optional<GroupSample<CompositeData::InsGroup>> ins() const noexcept { return _parseGroup(_ins, &CompositeData::ins); }
+#endif
+#if (GNSS2_GROUP_ENABLE)
+    std::optional<GroupSample<CompositeData::Gnss2Group>> gnss2() const noexcept { return _parseGroup(_gnss2, &CompositeData::gnss2); }
+#endif
+#if (GNSS3_GROUP_ENABLE)
+    std::optional<GroupSample<CompositeData::Gnss3Group>> gnss3() const noexcept { return _parseGroup(_gnss3, &CompositeData::gnss3); }
+#endif
+
+private:
+    struct _RawPacket
+    {
+        PacketDetails details;
+        std::array<uint8_t, packetMaxLength> bytes;
+    };
+
+    void _store(const _RawPacket& packet, [[maybe_unused]] const EnabledMeasurements& measurementHeader) noexcept
+    {
+        _packet.store(packet);
+#if (TIME_GROUP_ENABLE)
+        if (measurementHeader[0] & TIME_GROUP_ENABLE) { _time.store(packet); }
+#endif
+#if (IMU_GROUP_ENABLE)
+        if (measurementHeader[1] & IMU_GROUP_ENABLE) { _imu.store(packet); }
+#endif
+#if (GNSS_GROUP_ENABLE)
+        if (measurementHeader[2] & GNSS_GROUP_ENABLE) { _gnss.store(packet); }
+#endif
+#if (ATTITUDE_GROUP_ENABLE)
+        if (measurementHeader[3] & ATTITUDE_GROUP_ENABLE) { _attitude.store(packet); }
+#endif
+#if (INS_GROUP_ENABLE)
+        if (measurementHeader[4] & INS_GROUP_ENABLE) { _ins.store(packet); }
+#endif
+#if (GNSS2_GROUP_ENABLE)
+        if (measurementHeader[5] & GNSS2_GROUP_ENABLE) { _gnss2.store(packet); }
+#endif
+#if (GNSS3_GROUP_ENABLE)
+        if (measurementHeader[11] & GNSS3_GROUP_ENABLE) { _gnss3.store(packet); }
+#endif
+    }
+
+    static std::optional<CompositeData> _parse(const SeqLock<_RawPacket>& slot) noexcept
+    {
+        if (slot.version() == 0) { return std::nullopt; }
+        _RawPacket packet = slot.load();
+        std::optional<CompositeData> retVal;
+        if (packet.details.syncByte == PacketDetails::SyncByte::FA)
+        {
+            const FaPacketProtocol::Metadata& metadata = packet.details.faMetadata;
+            const ByteBuffer byteBuffer(packet.bytes.data(), metadata.length, metadata.length);
+            retVal = FaPacketProtocol::parsePacket(byteBuffer, 0, metadata, Config::PacketDispatchers::cdEnabledMeasTypes);
+            if (retVal.has_value()) { retVal->timestamp = metadata.timestamp; }
+        }
+        else
+        {
+            const AsciiPacketProtocol::Metadata& metadata = packet.details.asciiMetadata;
+            const ByteBuffer byteBuffer(packet.bytes.data(), metadata.length, metadata.length);
+            retVal = AsciiPacketProtocol::parsePacket(byteBuffer, 0, metadata, AsciiPacketProtocol::getMeasHeader(metadata.header));
+            if (retVal.has_value()) { retVal->timestamp = metadata.timestamp; }
+        }
+        return retVal;
+    }
+
+    template <class GroupType>
+    static std::optional<GroupSample<GroupType>> _parseGroup(const SeqLock<_RawPacket>& slot, GroupType CompositeData::*group) noexcept
+    {
+        const std::optional<CompositeData> compositeData = _parse(slot);
+        if (!compositeData.has_value()) { return std::nullopt; }
+        return GroupSample<GroupType>{compositeData->timestamp, (*compositeData).*group};
+    }
+
+    SeqLock<_RawPacket> _packet;
+#if (TIME_GROUP_ENABLE)
+    SeqLock<_RawPacket> _time;
+#endif
+#if (IMU_GROUP_ENABLE)
+    SeqLock<_RawPacket> _imu;
+#endif
+#if (GNSS_GROUP_ENABLE)
+    SeqLock<_RawPacket> _gnss;
+#endif
+#if (ATTITUDE_GROUP_ENABLE)
+    SeqLock<_RawPacket> _attitude;
+#endif
+#if (INS_GROUP_ENABLE)
+    SeqLock<_RawPacket> _ins;
+#endif
+#if (GNSS2_GROUP_ENABLE)
+    SeqLock<_RawPacket> _gnss2;
+#endif
+#if (GNSS3_GROUP_ENABLE)
+    SeqLock<_RawPacket> _gnss3;
+#endif
+};
+
+}  // namespace VN
+
+#endif  // IMPLEMENTATION_LATESTMEASUREMENTS_HPP
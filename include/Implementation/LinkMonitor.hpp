@@ -0,0 +1,145 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef IMPLEMENTATION_LINKMONITOR_HPP
+#define IMPLEMENTATION_LINKMONITOR_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+
+#include "HAL/Timer.hpp"
+#include "Implementation/AsciiHeader.hpp"
+#include "Implementation/BinaryHeader.hpp"
+#include "Implementation/PacketSynchronizer.hpp"
+#include "TemplateLibrary/SeqLock.hpp"
+#include "TemplateLibrary/Vector.hpp"
+#include "Config.hpp"
+
+namespace VN
+{
+
+/// @brief Link statistics for a single binary output or ASCII message type.
+struct MessageTypeStats
+{
+    uint8_t syncByte = 0;       // 0xFA for a binary output, '$' for an ASCII message
+    BinaryHeader binaryHeader;  // Identifies a binary output
+    AsciiHeader asciiHeader;    // Identifies an ASCII message, e.g. "VNYPR"
+
+    double packetsPerSecond = 0;
+    uint64_t packets = 0;
+    uint64_t missedPackets = 0;  // Estimated from jumps in the unit's TimeStartup, or else SyncOutCnt, for binary outputs which include either
+};
+
+/// @brief A snapshot of the serial link's health. Rates are averaged over the most recent Config::Sensor::linkStatsWindow; totals are since connecting.
+struct LinkStats
+{
+    double windowSeconds = 0;  // The span the rates were actually measured over, shorter than the window just after connecting
+
+    double receivedBytesPerSecond = 0;
+    double skippedBytesPerSecond = 0;
+    double faPacketsPerSecond = 0;
+    double asciiPacketsPerSecond = 0;
+    double fbPacketsPerSecond = 0;
+    double invalidFaPacketsPerSecond = 0;  // Almost always CRC failures
+    double invalidAsciiPacketsPerSecond = 0;
+    double faCrcFailureRatio = 0;  // Invalid FA packets as a fraction of all FA packets found, over the window
+
+    uint64_t receivedBytes = 0;
+    uint64_t skippedBytes = 0;
+    uint64_t faPackets = 0;
+    uint64_t invalidFaPackets = 0;
+    uint64_t asciiPackets = 0;
+    uint64_t invalidAsciiPackets = 0;
+    uint64_t fbPackets = 0;
+
+    uint64_t missedFaPackets = 0;  // Estimated from jumps in the unit's TimeStartup, or else SyncOutCnt, for FA outputs which include either
+
+    size_t mainBufferHighWatermark = 0;
+    uint16_t measurementQueueHighWatermark = 0;
+
+    // Valid packets by message type, in the order first seen. Types beyond Config::Sensor::linkStatsMessageTypes are only counted in the totals above.
+    Vector<MessageTypeStats, Config::Sensor::linkStatsMessageTypes> messageTypes;
+};
+
+/// @brief Accumulates link statistics on the listening thread and publishes them for any thread to read. The listening thread only increments plain
+/// counters and, once per bucket, publishes a snapshot through a SeqLock, so the monitor is cheap enough to leave on at full data rate.
+class LinkMonitor
+{
+public:
+    /// @brief Counts a valid FA packet against its binary output and, if the output includes it, records its TimeStartup to detect packets lost upstream
+    /// of the parser. Outputs without TimeStartup are checked with SyncOutCnt instead, which only detects gaps if SyncOut is triggered at least as often
+    /// as the output. Called on the listening thread.
+    void onFaPacket(const BinaryHeader& header, const std::optional<uint64_t> timeStartup, const std::optional<uint32_t> syncOutCnt) noexcept;
+
+    /// @brief Counts a valid ASCII packet against its message type. Called on the listening thread.
+    void onAsciiPacket(const AsciiHeader& header) noexcept;
+
+    /// @brief Samples the packet synchronizer's counters and publishes new statistics at most once per bucket. Called on the listening thread after
+    /// each read from the serial port.
+    void update(const PacketSynchronizer& packetSynchronizer, const size_t mainBufferSize, const uint16_t measurementQueueHighWatermark) noexcept;
+
+    /// @brief Discards every sample, message type and counter, e.g. after reconnecting. Only call while the listening thread is stopped.
+    void reset() noexcept;
+
+    LinkStats stats() const noexcept { return _stats.load(); }
+
+private:
+    struct Sample
+    {
+        time_point time;
+        uint64_t receivedBytes;
+        uint64_t skippedBytes;
+        uint64_t faPackets;
+        uint64_t invalidFaPackets;
+        uint64_t asciiPackets;
+        uint64_t invalidAsciiPackets;
+        uint64_t fbPackets;
+        std::array<uint64_t, Config::Sensor::linkStatsMessageTypes> messageTypePackets;  // Indexed as _messageTypes; zero for types not yet seen
+    };
+
+    struct MessageTypeCounter
+    {
+        MessageTypeStats stats;
+        uint64_t lastCount = 0;  // The last TimeStartup or SyncOutCnt, whichever the output includes
+        uint64_t period = 0;     // Smoothed interval between consecutive packets, in ns for TimeStartup or in triggers for SyncOutCnt
+    };
+
+    static constexpr uint8_t _numBuckets = Config::Sensor::linkStatsBuckets;
+    std::array<Sample, _numBuckets + 1> _samples{};  // Ring of the most recent samples; the oldest bounds the window
+    uint8_t _newestSample = 0;
+    uint8_t _numSamples = 0;
+
+    Vector<MessageTypeCounter, Config::Sensor::linkStatsMessageTypes> _messageTypes;
+    uint64_t _missedFaPackets = 0;
+    size_t _mainBufferHighWatermark = 0;
+
+    SeqLock<LinkStats> _stats;
+
+    void _trackGap(MessageTypeCounter& counter, const uint64_t count) noexcept;
+};
+
+}  // namespace VN
+
+#endif  // IMPLEMENTATION_LINKMONITOR_HPP
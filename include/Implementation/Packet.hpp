@@ -54,6 +54,8 @@ struct Packet
 {
     Packet(size_t length) : buffer(new uint8_t[length]), size(length) {}
 
+    Packet(uint8_t* externalBuffer, const size_t length) : buffer(externalBuffer), size(length), _autoAllocated(false) {}
+
     template <size_t Capacity>
     Packet(std::array<uint8_t, Capacity>& externalBuffer) : buffer(externalBuffer.data()), size(Capacity), _autoAllocated(false)
     {
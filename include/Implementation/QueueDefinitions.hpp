@@ -27,6 +27,7 @@
 #include <memory>
 
 #include "TemplateLibrary/DirectAccessQueue.hpp"
+#include "TemplateLibrary/Arena.hpp"
 #include "Implementation/Packet.hpp"
 #include "Interface/CompositeData.hpp"
 #include "Config.hpp"
@@ -37,8 +38,24 @@ using MeasurementQueue = DirectAccessQueue<CompositeData, Config::PacketDispatch
 
 using PacketQueue_Interface = DirectAccessQueue_Interface<Packet>;
 
+/// @brief Holds a PacketQueue's arena in a base listed before the queue, so it is constructed first, without Arena's members becoming PacketQueue's.
+struct PacketQueueArena
+{
+    Arena arena;
+};
+
+/// @brief A queue of packets whose buffers are all carved from a single arena, each starting on its own cache line, rather than allocated one by one.
 template <uint16_t Capacity>
-using PacketQueue = DirectAccessQueue<Packet, Capacity>;
+class PacketQueue : private PacketQueueArena, public DirectAccessQueue<Packet, Capacity>
+{
+public:
+    PacketQueue(const size_t packetCapacity)
+        : PacketQueueArena{Arena(Arena::slotStride(packetCapacity) * Capacity,
+                                 Arena::Options{Config::PacketQueues::arenaUseHugePages, Config::PacketQueues::arenaLockPages})},
+          DirectAccessQueue<Packet, Capacity>(ContiguousStorage{arena.data(), Arena::slotStride(packetCapacity), packetCapacity})
+    {
+    }
+};
 }  // namespace VN
 
 #endif  // IMPLEMENTATION_QUEUEDEFINITIONS_HPP
@@ -0,0 +1,89 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef INTERFACE_BANDWIDTHPLANNER_HPP
+#define INTERFACE_BANDWIDTHPLANNER_HPP
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+#include "Interface/Errors.hpp"
+#include "Interface/Registers.hpp"
+
+namespace VN
+{
+namespace BandwidthPlanner
+{
+
+using BaudRate = Registers::System::BaudRate::BaudRates;
+using SerialPort = Registers::System::BaudRate::SerialPort;
+
+constexpr uint8_t maxNumOutputs = 3;
+
+/// @brief The load a single binary output places on the link.
+struct OutputLoad
+{
+    uint16_t packetLength = 0;  // Worst case, including sync byte, header and crc
+    double packetsPerSecond = 0;
+    double bytesPerSecond = 0;
+    uint16_t suggestedRateDivisor = 0;  // The smallest rate divisor at which the link fits, holding the other outputs fixed. 0 if none does.
+};
+
+/// @brief The load a set of binary outputs places on a serial link, and what would make it fit.
+struct Plan
+{
+    std::array<OutputLoad, maxNumOutputs> outputs{};
+    uint8_t numOutputs = 0;
+    double bytesPerSecond = 0;
+    double linkBytesPerSecond = 0;  // The link's capacity, at 10 bits per byte including start and stop bits
+    double utilization = 0;
+    bool fits = false;                          // Whether utilization is within the requested maximum
+    std::optional<BaudRate> suggestedBaudRate;  // The lowest baud rate at which the outputs fit as configured, if any
+};
+
+/// @brief Computes the worst-case length of a binary output's packets, from sync byte to crc. GNSS SatInfo and RawMeas are assumed to carry
+/// Config::PacketFinders::gnssSatInfoMaxCount and gnssRawMeasMaxCount satellites, the most the SDK will parse.
+/// @return The packet length, or 0 if nothing is enabled.
+uint16_t worstCasePacketLength(const Registers::System::BinaryOutputMeasurements& measurements) noexcept;
+
+/// @brief Plans a proposed set of binary output configurations against a serial link. Nothing is sent to the unit, so this can be called before
+/// writeRegister to check a configuration.
+/// @param outputs The binary output registers (e.g. BinaryOutput1..3) as they are to be written. Null entries are skipped.
+/// @param numOutputs The number of entries in outputs, at most maxNumOutputs.
+/// @param baudRate The baud rate of the serial port.
+/// @param serialPort Which port's load to plan. Outputs whose asyncMode does not include the port are not counted; ActiveSerial counts every output sent
+/// to either port.
+/// @param imuRateHz The unit's IMU rate, which each output's rate divisor divides. 800 Hz for most units.
+/// @param maxUtilization The largest fraction of the link the outputs may use, leaving room for command responses and ASCII outputs.
+Plan plan(const Registers::System::BinaryOutput* const* outputs, const uint8_t numOutputs, const BaudRate baudRate,
+          const SerialPort serialPort = SerialPort::ActiveSerial, const uint16_t imuRateHz = 800, const double maxUtilization = 0.8) noexcept;
+
+/// @brief Refuses a plan which does not fit.
+/// @return Error::InsufficientBaudRate if the plan's utilization exceeds its maximum, otherwise Error::None.
+inline Error check(const Plan& plan) noexcept { return plan.fits ? Error::None : Error::InsufficientBaudRate; }
+
+}  // namespace BandwidthPlanner
+}  // namespace VN
+
+#endif  // INTERFACE_BANDWIDTHPLANNER_HPP
@@ -116,10 +116,12 @@ public:
     {
         std::snprintf(_commandString.begin(), _commandString.capacity(), "SIH");
 
+        char field[48];
         for (const auto& param : params)
         {
             // Print however many params exist
-            std::snprintf(_commandString.end(), _commandString.capacity() - _commandString.length(), ",%+08.3f", param);
+            std::snprintf(field, sizeof(field), ",%+08.3f", param);
+            _commandString.append(field, sizeof(field));
         }
 
         return _commandString;
@@ -257,7 +259,8 @@ public:
     Command toWriteCommand()
     {
         AsciiMessage responseMatch;
-        std::snprintf(responseMatch.begin(), responseMatch.capacity(), "WRG,%02d,%s", _id, toString().c_str());
+        std::snprintf(responseMatch.begin(), responseMatch.capacity(), "WRG,%02d,", _id);
+        responseMatch.append(toString());
         return Command{responseMatch, static_cast<uint8_t>((_id > 99) ? 7 : 6)};
     }
 
@@ -0,0 +1,1061 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef INTERFACE_COMPACTCOMPOSITEDATA_HPP
+#define INTERFACE_COMPACTCOMPOSITEDATA_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+#include "Config.hpp"
+#include "HAL/Timer.hpp"
+#include "Implementation/BinaryHeader.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "Implementation/MeasurementDatatypes.hpp"
+#include "Implementation/Packet.hpp"
+#include "Interface/CompositeData.hpp"
+#include "Interface/CompositeDataView.hpp"
+#include "Interface/Registers.hpp"
+#include "TemplateLibrary/DirectAccessQueue.hpp"
+#include "TemplateLibrary/Slab.hpp"
+
+namespace VN
+{
+
+/// @brief Out-of-line storage for the variable-length GNSS measurements referenced by CompactCompositeData. Shared by every CompactCompositeData populated
+/// with it, and must outlive them. Sized to hold one block of each kind per composite data queue entry.
+struct CompactGnssSlab
+{
+    Slab<GnssSatInfo, Config::PacketDispatchers::compactGnssSlabCapacity> satInfo;
+    Slab<GnssRawMeas, Config::PacketDispatchers::compactGnssSlabCapacity> rawMeas;
+    std::atomic<uint32_t> numDropped{0};  ///< GNSS blocks which could not be stored because the slab was exhausted.
+};
+
+/// @brief A compact, owning alternative to CompositeData for binary measurements.
+/// Rather than a std::optional per measurement, presence is held in a single bitmask and the measurements are packed back-to-back without padding. GNSS
+/// SatInfo and RawMeas, which would otherwise dominate the object size, are stored in a CompactGnssSlab and referenced by a one-byte slot index. If no slab is
+/// provided, or it is exhausted, those measurements are dropped; drops due to exhaustion are counted in CompactGnssSlab::numDropped.
+/// Measurements disabled in Config.hpp occupy no space and have no accessor, as in CompositeData.
+class CompactCompositeData
+{
+public:
+    struct Field
+    {
+        uint8_t group;
+        uint8_t field;
+        uint8_t size;  // Bytes occupied in the packed storage; 0 if disabled.
+    };
+
+    static constexpr uint8_t numFields = 97;
+    static constexpr std::array<Field, numFields> fields = {{
+        {1, 0, (TIME_GROUP_ENABLE & TIME_TIMESTARTUP_BIT) ? sizeof(Time) : 0},  // time.timeStartup
+        {1, 1, (TIME_GROUP_ENABLE & TIME_TIMEGPS_BIT) ? sizeof(Time) : 0},  // time.timeGps
+        {1, 2, (TIME_GROUP_ENABLE & TIME_TIMEGPSTOW_BIT) ? sizeof(Time) : 0},  // time.timeGpsTow
+        {1, 3, (TIME_GROUP_ENABLE & TIME_TIMEGPSWEEK_BIT) ? sizeof(uint16_t) : 0},  // time.timeGpsWeek
+        {1, 4, (TIME_GROUP_ENABLE & TIME_TIMESYNCIN_BIT) ? sizeof(Time) : 0},  // time.timeSyncIn
+        {1, 5, (TIME_GROUP_ENABLE & TIME_TIMEGPSPPS_BIT) ? sizeof(Time) : 0},  // time.timeGpsPps
+        {1, 6, (TIME_GROUP_ENABLE & TIME_TIMEUTC_BIT) ? sizeof(TimeUtc) : 0},  // time.timeUtc
+        {1, 7, (TIME_GROUP_ENABLE & TIME_SYNCINCNT_BIT) ? sizeof(uint32_t) : 0},  // time.syncInCnt
+        {1, 8, (TIME_GROUP_ENABLE & TIME_SYNCOUTCNT_BIT) ? sizeof(uint32_t) : 0},  // time.syncOutCnt
+        {1, 9, (TIME_GROUP_ENABLE & TIME_TIMESTATUS_BIT) ? sizeof(TimeStatus) : 0},  // time.timeStatus
+        {2, 0, (IMU_GROUP_ENABLE & IMU_IMUSTATUS_BIT) ? sizeof(ImuStatus) : 0},  // imu.imuStatus
+        {2, 1, (IMU_GROUP_ENABLE & IMU_UNCOMPMAG_BIT) ? sizeof(Vec3f) : 0},  // imu.uncompMag
+        {2, 2, (IMU_GROUP_ENABLE & IMU_UNCOMPACCEL_BIT) ? sizeof(Vec3f) : 0},  // imu.uncompAccel
+        {2, 3, (IMU_GROUP_ENABLE & IMU_UNCOMPGYRO_BIT) ? sizeof(Vec3f) : 0},  // imu.uncompGyro
+        {2, 4, (IMU_GROUP_ENABLE & IMU_TEMPERATURE_BIT) ? sizeof(float) : 0},  // imu.temperature
+        {2, 5, (IMU_GROUP_ENABLE & IMU_PRESSURE_BIT) ? sizeof(float) : 0},  // imu.pressure
+        {2, 6, (IMU_GROUP_ENABLE & IMU_DELTATHETA_BIT) ? sizeof(DeltaTheta) : 0},  // imu.deltaTheta
+        {2, 7, (IMU_GROUP_ENABLE & IMU_DELTAVEL_BIT) ? sizeof(Vec3f) : 0},  // imu.deltaVel
+        {2, 8, (IMU_GROUP_ENABLE & IMU_MAG_BIT) ? sizeof(Vec3f) : 0},  // imu.mag
+        {2, 9, (IMU_GROUP_ENABLE & IMU_ACCEL_BIT) ? sizeof(Vec3f) : 0},  // imu.accel
+        {2, 10, (IMU_GROUP_ENABLE & IMU_ANGULARRATE_BIT) ? sizeof(Vec3f) : 0},  // imu.angularRate
+        {2, 11, (IMU_GROUP_ENABLE & IMU_SENSSAT_BIT) ? sizeof(uint16_t) : 0},  // imu.sensSat
+        {3, 0, (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEUTC_BIT) ? sizeof(TimeUtc) : 0},  // gnss.gnss1TimeUtc
+        {3, 1, (GNSS_GROUP_ENABLE & GNSS_GPS1TOW_BIT) ? sizeof(Time) : 0},  // gnss.gps1Tow
+        {3, 2, (GNSS_GROUP_ENABLE & GNSS_GPS1WEEK_BIT) ? sizeof(uint16_t) : 0},  // gnss.gps1Week
+        {3, 3, (GNSS_GROUP_ENABLE & GNSS_GNSS1NUMSATS_BIT) ? sizeof(uint8_t) : 0},  // gnss.gnss1NumSats
+        {3, 4, (GNSS_GROUP_ENABLE & GNSS_GNSS1FIX_BIT) ? sizeof(uint8_t) : 0},  // gnss.gnss1Fix
+        {3, 5, (GNSS_GROUP_ENABLE & GNSS_GNSS1POSLLA_BIT) ? sizeof(Lla) : 0},  // gnss.gnss1PosLla
+        {3, 6, (GNSS_GROUP_ENABLE & GNSS_GNSS1POSECEF_BIT) ? sizeof(Vec3d) : 0},  // gnss.gnss1PosEcef
+        {3, 7, (GNSS_GROUP_ENABLE & GNSS_GNSS1VELNED_BIT) ? sizeof(Vec3f) : 0},  // gnss.gnss1VelNed
+        {3, 8, (GNSS_GROUP_ENABLE & GNSS_GNSS1VELECEF_BIT) ? sizeof(Vec3f) : 0},  // gnss.gnss1VelEcef
+        {3, 9, (GNSS_GROUP_ENABLE & GNSS_GNSS1POSUNCERTAINTY_BIT) ? sizeof(Vec3f) : 0},  // gnss.gnss1PosUncertainty
+        {3, 10, (GNSS_GROUP_ENABLE & GNSS_GNSS1VELUNCERTAINTY_BIT) ? sizeof(float) : 0},  // gnss.gnss1VelUncertainty
+        {3, 11, (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEUNCERTAINTY_BIT) ? sizeof(float) : 0},  // gnss.gnss1TimeUncertainty
+        {3, 12, (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEINFO_BIT) ? sizeof(GnssTimeInfo) : 0},  // gnss.gnss1TimeInfo
+        {3, 13, (GNSS_GROUP_ENABLE & GNSS_GNSS1DOP_BIT) ? sizeof(GnssDop) : 0},  // gnss.gnss1Dop
+        {3, 14, (GNSS_GROUP_ENABLE & GNSS_GNSS1SATINFO_BIT) ? sizeof(uint8_t) : 0},  // gnss.gnss1SatInfo
+        {3, 16, (GNSS_GROUP_ENABLE & GNSS_GNSS1RAWMEAS_BIT) ? sizeof(uint8_t) : 0},  // gnss.gnss1RawMeas
+        {3, 17, (GNSS_GROUP_ENABLE & GNSS_GNSS1STATUS_BIT) ? sizeof(GnssStatus) : 0},  // gnss.gnss1Status
+        {3, 18, (GNSS_GROUP_ENABLE & GNSS_GNSS1ALTMSL_BIT) ? sizeof(double) : 0},  // gnss.gnss1AltMSL
+        {4, 1, (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPR_BIT) ? sizeof(Ypr) : 0},  // attitude.ypr
+        {4, 2, (ATTITUDE_GROUP_ENABLE & ATTITUDE_QUATERNION_BIT) ? sizeof(Quat) : 0},  // attitude.quaternion
+        {4, 3, (ATTITUDE_GROUP_ENABLE & ATTITUDE_DCM_BIT) ? sizeof(Mat3f) : 0},  // attitude.dcm
+        {4, 4, (ATTITUDE_GROUP_ENABLE & ATTITUDE_MAGNED_BIT) ? sizeof(Vec3f) : 0},  // attitude.magNed
+        {4, 5, (ATTITUDE_GROUP_ENABLE & ATTITUDE_ACCELNED_BIT) ? sizeof(Vec3f) : 0},  // attitude.accelNed
+        {4, 6, (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINBODYACC_BIT) ? sizeof(Vec3f) : 0},  // attitude.linBodyAcc
+        {4, 7, (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINACCELNED_BIT) ? sizeof(Vec3f) : 0},  // attitude.linAccelNed
+        {4, 8, (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPRU_BIT) ? sizeof(Vec3f) : 0},  // attitude.yprU
+        {4, 12, (ATTITUDE_GROUP_ENABLE & ATTITUDE_HEAVE_BIT) ? sizeof(Vec3f) : 0},  // attitude.heave
+        {4, 13, (ATTITUDE_GROUP_ENABLE & ATTITUDE_ATTU_BIT) ? sizeof(float) : 0},  // attitude.attU
+        {5, 0, (INS_GROUP_ENABLE & INS_INSSTATUS_BIT) ? sizeof(InsStatus) : 0},  // ins.insStatus
+        {5, 1, (INS_GROUP_ENABLE & INS_POSLLA_BIT) ? sizeof(Lla) : 0},  // ins.posLla
+        {5, 2, (INS_GROUP_ENABLE & INS_POSECEF_BIT) ? sizeof(Vec3d) : 0},  // ins.posEcef
+        {5, 3, (INS_GROUP_ENABLE & INS_VELBODY_BIT) ? sizeof(Vec3f) : 0},  // ins.velBody
+        {5, 4, (INS_GROUP_ENABLE & INS_VELNED_BIT) ? sizeof(Vec3f) : 0},  // ins.velNed
+        {5, 5, (INS_GROUP_ENABLE & INS_VELECEF_BIT) ? sizeof(Vec3f) : 0},  // ins.velEcef
+        {5, 6, (INS_GROUP_ENABLE & INS_MAGECEF_BIT) ? sizeof(Vec3f) : 0},  // ins.magEcef
+        {5, 7, (INS_GROUP_ENABLE & INS_ACCELECEF_BIT) ? sizeof(Vec3f) : 0},  // ins.accelEcef
+        {5, 8, (INS_GROUP_ENABLE & INS_LINACCELECEF_BIT) ? sizeof(Vec3f) : 0},  // ins.linAccelEcef
+        {5, 9, (INS_GROUP_ENABLE & INS_POSU_BIT) ? sizeof(float) : 0},  // ins.posU
+        {5, 10, (INS_GROUP_ENABLE & INS_VELU_BIT) ? sizeof(float) : 0},  // ins.velU
+        {6, 0, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEUTC_BIT) ? sizeof(TimeUtc) : 0},  // gnss2.gnss2TimeUtc
+        {6, 1, (GNSS2_GROUP_ENABLE & GNSS2_GPS2TOW_BIT) ? sizeof(Time) : 0},  // gnss2.gps2Tow
+        {6, 2, (GNSS2_GROUP_ENABLE & GNSS2_GPS2WEEK_BIT) ? sizeof(uint16_t) : 0},  // gnss2.gps2Week
+        {6, 3, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2NUMSATS_BIT) ? sizeof(uint8_t) : 0},  // gnss2.gnss2NumSats
+        {6, 4, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2FIX_BIT) ? sizeof(uint8_t) : 0},  // gnss2.gnss2Fix
+        {6, 5, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSLLA_BIT) ? sizeof(Lla) : 0},  // gnss2.gnss2PosLla
+        {6, 6, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSECEF_BIT) ? sizeof(Vec3d) : 0},  // gnss2.gnss2PosEcef
+        {6, 7, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELNED_BIT) ? sizeof(Vec3f) : 0},  // gnss2.gnss2VelNed
+        {6, 8, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELECEF_BIT) ? sizeof(Vec3f) : 0},  // gnss2.gnss2VelEcef
+        {6, 9, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSUNCERTAINTY_BIT) ? sizeof(Vec3f) : 0},  // gnss2.gnss2PosUncertainty
+        {6, 10, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELUNCERTAINTY_BIT) ? sizeof(float) : 0},  // gnss2.gnss2VelUncertainty
+        {6, 11, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEUNCERTAINTY_BIT) ? sizeof(float) : 0},  // gnss2.gnss2TimeUncertainty
+        {6, 12, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEINFO_BIT) ? sizeof(GnssTimeInfo) : 0},  // gnss2.gnss2TimeInfo
+        {6, 13, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2DOP_BIT) ? sizeof(GnssDop) : 0},  // gnss2.gnss2Dop
+        {6, 14, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2SATINFO_BIT) ? sizeof(uint8_t) : 0},  // gnss2.gnss2SatInfo
+        {6, 16, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2RAWMEAS_BIT) ? sizeof(uint8_t) : 0},  // gnss2.gnss2RawMeas
+        {6, 17, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2STATUS_BIT) ? sizeof(GnssStatus) : 0},  // gnss2.gnss2Status
+        {6, 18, (GNSS2_GROUP_ENABLE & GNSS2_GNSS2ALTMSL_BIT) ? sizeof(double) : 0},  // gnss2.gnss2AltMSL
+        {12, 0, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEUTC_BIT) ? sizeof(TimeUtc) : 0},  // gnss3.gnss3TimeUtc
+        {12, 1, (GNSS3_GROUP_ENABLE & GNSS3_GPS3TOW_BIT) ? sizeof(Time) : 0},  // gnss3.gps3Tow
+        {12, 2, (GNSS3_GROUP_ENABLE & GNSS3_GPS3WEEK_BIT) ? sizeof(uint16_t) : 0},  // gnss3.gps3Week
+        {12, 3, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3NUMSATS_BIT) ? sizeof(uint8_t) : 0},  // gnss3.gnss3NumSats
+        {12, 4, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3FIX_BIT) ? sizeof(uint8_t) : 0},  // gnss3.gnss3Fix
+        {12, 5, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSLLA_BIT) ? sizeof(Lla) : 0},  // gnss3.gnss3PosLla
+        {12, 6, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSECEF_BIT) ? sizeof(Vec3d) : 0},  // gnss3.gnss3PosEcef
+        {12, 7, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELNED_BIT) ? sizeof(Vec3f) : 0},  // gnss3.gnss3VelNed
+        {12, 8, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELECEF_BIT) ? sizeof(Vec3f) : 0},  // gnss3.gnss3VelEcef
+        {12, 9, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSUNCERTAINTY_BIT) ? sizeof(Vec3f) : 0},  // gnss3.gnss3PosUncertainty
+        {12, 10, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELUNCERTAINTY_BIT) ? sizeof(float) : 0},  // gnss3.gnss3VelUncertainty
+        {12, 11, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEUNCERTAINTY_BIT) ? sizeof(float) : 0},  // gnss3.gnss3TimeUncertainty
+        {12, 12, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEINFO_BIT) ? sizeof(GnssTimeInfo) : 0},  // gnss3.gnss3TimeInfo
+        {12, 13, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3DOP_BIT) ? sizeof(GnssDop) : 0},  // gnss3.gnss3Dop
+        {12, 14, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3SATINFO_BIT) ? sizeof(uint8_t) : 0},  // gnss3.gnss3SatInfo
+        {12, 16, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3RAWMEAS_BIT) ? sizeof(uint8_t) : 0},  // gnss3.gnss3RawMeas
+        {12, 17, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3STATUS_BIT) ? sizeof(GnssStatus) : 0},  // gnss3.gnss3Status
+        {12, 18, (GNSS3_GROUP_ENABLE & GNSS3_GNSS3ALTMSL_BIT) ? sizeof(double) : 0},  // gnss3.gnss3AltMSL
+    }};
+
+    CompactCompositeData() = default;
+    explicit CompactCompositeData(CompactGnssSlab* gnssSlab) noexcept : _gnssSlab(gnssSlab) {}
+    ~CompactCompositeData() { _releaseGnssBlocks(); }
+
+    CompactCompositeData(const CompactCompositeData& other) noexcept { _copyFrom(other); }
+    CompactCompositeData& operator=(const CompactCompositeData& other) noexcept
+    {
+        if (this != &other)
+        {
+            _releaseGnssBlocks();
+            _copyFrom(other);
+        }
+        return *this;
+    }
+
+    CompactCompositeData(CompactCompositeData&& other) noexcept { _moveFrom(other); }
+    CompactCompositeData& operator=(CompactCompositeData&& other) noexcept
+    {
+        if (this != &other)
+        {
+            _releaseGnssBlocks();
+            _moveFrom(other);
+        }
+        return *this;
+    }
+
+    /// @brief Fills the object from a linear FA packet, replacing any previous contents.
+    /// @param packet The linear packet bytes, starting at the sync byte.
+    /// @param metadata The metadata found for the packet.
+    /// @param offsetTable The table to populate, or reuse if it already describes this header. Typically held by the consumer across packets.
+    /// @return True if the packet contents do not match its header.
+    bool populate(const uint8_t* packet, const FaPacketProtocol::Metadata& metadata, CompositeDataView::OffsetTable& offsetTable) noexcept;
+
+    /// @brief Fills the object from a packet popped from a subscribed PacketQueue. The packet must be an FA packet.
+    bool populate(const Packet& packet, CompositeDataView::OffsetTable& offsetTable) noexcept
+    {
+        if (packet.details.syncByte != PacketDetails::SyncByte::FA) { return true; }
+        return populate(packet.buffer, packet.details.faMetadata, offsetTable);
+    }
+
+    /// @brief Removes every measurement, returning any GNSS blocks to the slab.
+    void clear() noexcept
+    {
+        _releaseGnssBlocks();
+        _presence.fill(0);
+        _header = BinaryHeader();
+    }
+
+    /// @brief Checks whether the passed header matches the header of the held message.
+    bool matchesMessage(const BinaryHeader& binaryHeader) const noexcept { return binaryHeader == _header; }
+
+    /// @brief Checks whether the passed register matches the header of the held message.
+    bool matchesMessage(const Registers::System::BinaryOutput& binaryOutputRegister) const noexcept
+    {
+        return matchesMessage(binaryOutputRegister.toBinaryHeader());
+    }
+
+    const BinaryHeader& header() const noexcept { return _header; }
+
+    /// @brief Expands to a CompositeData, for consumers of the existing interface.
+    CompositeData toCompositeData() const noexcept;
+
+    time_point timestamp;
+
+    struct TimeGroup
+    {
+        #if (TIME_GROUP_ENABLE & TIME_TIMESTARTUP_BIT)
+        std::optional<Time> timeStartup() const noexcept { return _data._get<Time>(0); } /// < The system time since startup measured in nano seconds.  The time since startup is based upon the internal TXCO oscillator for the MCU.  The accuracy of the internal TXCO is plus minus 20ppm (-40C to 85C).
+        #endif
+        #if (TIME_GROUP_ENABLE & TIME_TIMEGPS_BIT)
+        std::optional<Time> timeGps() const noexcept { return _data._get<Time>(1); } /// < The absolute GPS time since start of GPS epoch 1980 expressed in nano seconds.
+        #endif
+        #if (TIME_GROUP_ENABLE & TIME_TIMEGPSTOW_BIT)
+        std::optional<Time> timeGpsTow() const noexcept { return _data._get<Time>(2); } /// < The time since the start of the current GPS time week expressed in nano seconds.
+        #endif
+        #if (TIME_GROUP_ENABLE & TIME_TIMEGPSWEEK_BIT)
+        std::optional<uint16_t> timeGpsWeek() const noexcept { return _data._get<uint16_t>(3); } /// < The current GPS week.
+        #endif
+        #if (TIME_GROUP_ENABLE & TIME_TIMESYNCIN_BIT)
+        std::optional<Time> timeSyncIn() const noexcept { return _data._get<Time>(4); } /// < The time since the last SyncIn event trigger expressed in nano seconds.
+        #endif
+        #if (TIME_GROUP_ENABLE & TIME_TIMEGPSPPS_BIT)
+        std::optional<Time> timeGpsPps() const noexcept { return _data._get<Time>(5); } /// < The time since the last GPS PPS trigger event expressed in nano seconds.
+        #endif
+        #if (TIME_GROUP_ENABLE & TIME_TIMEUTC_BIT)
+        std::optional<TimeUtc> timeUtc() const noexcept { return _data._get<TimeUtc>(6); } /// < The current UTC time.  The year is given as a signed byte year offset from the year 2000.  For example the year 2013 would be given as year 13.
+        #endif
+        #if (TIME_GROUP_ENABLE & TIME_SYNCINCNT_BIT)
+        std::optional<uint32_t> syncInCnt() const noexcept { return _data._get<uint32_t>(7); } /// < The number of SyncIn trigger events that have occurred.
+        #endif
+        #if (TIME_GROUP_ENABLE & TIME_SYNCOUTCNT_BIT)
+        std::optional<uint32_t> syncOutCnt() const noexcept { return _data._get<uint32_t>(8); } /// < The number of SyncOut trigger events that have occurred.
+        #endif
+        #if (TIME_GROUP_ENABLE & TIME_TIMESTATUS_BIT)
+        std::optional<TimeStatus> timeStatus() const noexcept { return _data._get<TimeStatus>(9); } /// < Time valid status flags.
+        #endif
+
+        const CompactCompositeData& _data;
+    };
+
+    struct ImuGroup
+    {
+        #if (IMU_GROUP_ENABLE & IMU_IMUSTATUS_BIT)
+        std::optional<ImuStatus> imuStatus() const noexcept { return _data._get<ImuStatus>(10); } /// < Reports various statuses of the IMU sensors.
+        #endif
+        #if (IMU_GROUP_ENABLE & IMU_UNCOMPMAG_BIT)
+        std::optional<Vec3f> uncompMag() const noexcept { return _data._get<Vec3f>(11); } /// < The IMU magnetic field given in the body-frame.  This measurement is compensated by the static calibration (individual factory calibration stored in flash), and the user compensation, however it is not compensated by the onboard Hard/Soft Iron estimator.
+        #endif
+        #if (IMU_GROUP_ENABLE & IMU_UNCOMPACCEL_BIT)
+        std::optional<Vec3f> uncompAccel() const noexcept { return _data._get<Vec3f>(12); } /// < The IMU acceleration given in the body-frame.  This measurement is compensated by the static calibration (individual factory calibration stored in flash), however it is not compensated by any bias compensation from the onboard Kalman filter.
+        #endif
+        #if (IMU_GROUP_ENABLE & IMU_UNCOMPGYRO_BIT)
+        std::optional<Vec3f> uncompGyro() const noexcept { return _data._get<Vec3f>(13); } /// < The IMU angular rate given in the body-frame.  This measurement is compensated by the static calibration (individual factory calibration stored in flash), however it is not compensated by any bias compensation from the onboard Kalman filter.
+        #endif
+        #if (IMU_GROUP_ENABLE & IMU_TEMPERATURE_BIT)
+        std::optional<float> temperature() const noexcept { return _data._get<float>(14); } /// < The IMU temperature.
+        #endif
+        #if (IMU_GROUP_ENABLE & IMU_PRESSURE_BIT)
+        std::optional<float> pressure() const noexcept { return _data._get<float>(15); } /// < The IMU pressure.  This is an absolute pressure measurement.  Typical pressure at sea level would be around 100 kPa.
+        #endif
+        #if (IMU_GROUP_ENABLE & IMU_DELTATHETA_BIT)
+        std::optional<DeltaTheta> deltaTheta() const noexcept { return _data._get<DeltaTheta>(16); } /// < The delta theta is the delta rotation angles incurred due to rotation, since the last time the values were output by the device. The delta angles are calculated based upon the onboard conning and sculling integration performed onboard the sensor at the IMU sampling rate. The delta time is the time interval that the delta angle and velocities are integrated over. The integration for the delta angles are reset each time the values are either polled or sent out due to a scheduled asynchronous ASCII or binary output.
+        #endif
+        #if (IMU_GROUP_ENABLE & IMU_DELTAVEL_BIT)
+        std::optional<Vec3f> deltaVel() const noexcept { return _data._get<Vec3f>(17); } /// < The delta velocity is the delta velocity incurred due to motion, since the last time the values were output by the device. The delta velocities are calculated based upon the onboard conning and sculling integration performed onboard the sensor at the IMU sampling rate. The integration for the delta velocities are reset each time the values are either polled or sent out due to a scheduled asynchronous ASCII or binary output.
+        #endif
+        #if (IMU_GROUP_ENABLE & IMU_MAG_BIT)
+        std::optional<Vec3f> mag() const noexcept { return _data._get<Vec3f>(18); } /// < The IMU compensated magnetic field given in the body-frame.  This measurement is compensated by the static calibration (individual factory calibration stored in flash), the user compensation, and the dynamic calibration from the onboard Hard/Soft Iron estimator.
+        #endif
+        #if (IMU_GROUP_ENABLE & IMU_ACCEL_BIT)
+        std::optional<Vec3f> accel() const noexcept { return _data._get<Vec3f>(19); } /// < The bias-compensated acceleration measured in the body-frame. This measurement is compensated by the static calibration (individual factory calibration stored in flash), the user compensation, and the dynamic bias compensation from the onboard Kalman filter (if applicable).
+        #endif
+        #if (IMU_GROUP_ENABLE & IMU_ANGULARRATE_BIT)
+        std::optional<Vec3f> angularRate() const noexcept { return _data._get<Vec3f>(20); } /// < The bias-compensated angular rate measured in the body-frame.  This measurement is compensated by the static calibration (individual factory calibration stored in flash), the user compensation, and the dynamic bias compensation from the onboard Kalman filter.
+        #endif
+        #if (IMU_GROUP_ENABLE & IMU_SENSSAT_BIT)
+        std::optional<uint16_t> sensSat() const noexcept { return _data._get<uint16_t>(21); } /// < This field provides flags identifying whether any of the measurements are currently saturated.
+        #endif
+
+        const CompactCompositeData& _data;
+    };
+
+    struct GnssGroup
+    {
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEUTC_BIT)
+        std::optional<TimeUtc> gnss1TimeUtc() const noexcept { return _data._get<TimeUtc>(22); } /// < The current UTC time.  The year is given as a signed byte year offset from the year 2000.  For example the year 2013 would be given as year 13.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GPS1TOW_BIT)
+        std::optional<Time> gps1Tow() const noexcept { return _data._get<Time>(23); } /// < The GPS time of week given in nano seconds.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GPS1WEEK_BIT)
+        std::optional<uint16_t> gps1Week() const noexcept { return _data._get<uint16_t>(24); } /// < The current GPS week.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1NUMSATS_BIT)
+        std::optional<uint8_t> gnss1NumSats() const noexcept { return _data._get<uint8_t>(25); } /// < The number of tracked GNSS satellites.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1FIX_BIT)
+        std::optional<uint8_t> gnss1Fix() const noexcept { return _data._get<uint8_t>(26); } /// < The current GNSS fix.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSLLA_BIT)
+        std::optional<Lla> gnss1PosLla() const noexcept { return _data._get<Lla>(27); } /// < The current GNSS position measurement given as the geodetic latitude, longitude and altitude above the ellipsoid.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSECEF_BIT)
+        std::optional<Vec3d> gnss1PosEcef() const noexcept { return _data._get<Vec3d>(28); } /// < The current GNSS position given in the Earth centered Earth fixed (ECEF) reference frame.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELNED_BIT)
+        std::optional<Vec3f> gnss1VelNed() const noexcept { return _data._get<Vec3f>(29); } /// < The current GNSS velocity in the North East Down (NED) reference frame.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELECEF_BIT)
+        std::optional<Vec3f> gnss1VelEcef() const noexcept { return _data._get<Vec3f>(30); } /// < The current GNSS velocity in the Earth centered Earth fixed (ECEF) reference frame.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSUNCERTAINTY_BIT)
+        std::optional<Vec3f> gnss1PosUncertainty() const noexcept { return _data._get<Vec3f>(31); } /// < The current GNSS position uncertainty in the North East Down (NED) reference frame.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELUNCERTAINTY_BIT)
+        std::optional<float> gnss1VelUncertainty() const noexcept { return _data._get<float>(32); } /// < The current GNSS velocity uncertainty.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEUNCERTAINTY_BIT)
+        std::optional<float> gnss1TimeUncertainty() const noexcept { return _data._get<float>(33); } /// < The current GPS time uncertainty.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEINFO_BIT)
+        std::optional<GnssTimeInfo> gnss1TimeInfo() const noexcept { return _data._get<GnssTimeInfo>(34); } /// < Flags for valid GPS TOW, week number and UTC and current leap seconds.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1DOP_BIT)
+        std::optional<GnssDop> gnss1Dop() const noexcept { return _data._get<GnssDop>(35); } /// < Dilution of precision.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1SATINFO_BIT)
+        std::optional<GnssSatInfo> gnss1SatInfo() const noexcept { return _data._getSatInfo(36); } /// < Information and measurements pertaining to each GNSS satellite in view.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1RAWMEAS_BIT)
+        std::optional<GnssRawMeas> gnss1RawMeas() const noexcept { return _data._getRawMeas(37); } /// < Raw measurements pertaining to each GNSS satellite in view.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1STATUS_BIT)
+        std::optional<GnssStatus> gnss1Status() const noexcept { return _data._get<GnssStatus>(38); } /// < GNSS Status info flags.
+        #endif
+        #if (GNSS_GROUP_ENABLE & GNSS_GNSS1ALTMSL_BIT)
+        std::optional<double> gnss1AltMSL() const noexcept { return _data._get<double>(39); } /// < Altitude (Mean Sea Level).
+        #endif
+
+        const CompactCompositeData& _data;
+    };
+
+    struct AttitudeGroup
+    {
+        #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPR_BIT)
+        std::optional<Ypr> ypr() const noexcept { return _data._get<Ypr>(40); } /// < The estimated attitude describing the body frame with respect to the local North-East-Down (NED) frame given as the (3-2-1) set of Euler angles corresponding to Yaw-Pitch-Roll.
+        #endif
+        #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_QUATERNION_BIT)
+        std::optional<Quat> quaternion() const noexcept { return _data._get<Quat>(41); } /// < The estimated attitude describing the body frame with respect to the local North-East-Down (NED) frame given as the quaternion.
+        #endif
+        #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_DCM_BIT)
+        std::optional<Mat3f> dcm() const noexcept { return _data._get<Mat3f>(42); } /// < The estimated attitude given as the directional cosine matrix (DCM) in column major order mapping the local North-East-Down (NED) frame into the body frame.
+        #endif
+        #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_MAGNED_BIT)
+        std::optional<Vec3f> magNed() const noexcept { return _data._get<Vec3f>(43); } /// < The current estimated magnetic field given in the local North-East-Down (NED) frame.
+        #endif
+        #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ACCELNED_BIT)
+        std::optional<Vec3f> accelNed() const noexcept { return _data._get<Vec3f>(44); } /// < The estimated acceleration (with gravity) given in the local North-East-Down (NED) frame.
+        #endif
+        #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINBODYACC_BIT)
+        std::optional<Vec3f> linBodyAcc() const noexcept { return _data._get<Vec3f>(45); } /// < The estimated linear acceleration (without gravity) given in the body frame.
+        #endif
+        #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINACCELNED_BIT)
+        std::optional<Vec3f> linAccelNed() const noexcept { return _data._get<Vec3f>(46); } /// < The estimated linear acceleration (without gravity) given in the local North-East-Down (NED) frame.
+        #endif
+        #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPRU_BIT)
+        std::optional<Vec3f> yprU() const noexcept { return _data._get<Vec3f>(47); } /// < The estimated attitude (Yaw, Pitch, Roll) uncertainty (1 Sigma), reported in degrees.
+        #endif
+        #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_HEAVE_BIT)
+        std::optional<Vec3f> heave() const noexcept { return _data._get<Vec3f>(48); } /// < Real-time heave and heave-rate estimates, plus a delayed-heave estimate.
+        #endif
+        #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ATTU_BIT)
+        std::optional<float> attU() const noexcept { return _data._get<float>(49); } /// < The estimated uncertainty (1 Sigma) in the current attitude estimate.
+        #endif
+
+        const CompactCompositeData& _data;
+    };
+
+    struct InsGroup
+    {
+        #if (INS_GROUP_ENABLE & INS_INSSTATUS_BIT)
+        std::optional<InsStatus> insStatus() const noexcept { return _data._get<InsStatus>(50); } /// < The INS status bitfield.
+        #endif
+        #if (INS_GROUP_ENABLE & INS_POSLLA_BIT)
+        std::optional<Lla> posLla() const noexcept { return _data._get<Lla>(51); } /// < The estimated position given as latitude, longitude, and altitude.
+        #endif
+        #if (INS_GROUP_ENABLE & INS_POSECEF_BIT)
+        std::optional<Vec3d> posEcef() const noexcept { return _data._get<Vec3d>(52); } /// < The estimate position given in the Earth centered Earth fixed (ECEF) frame.
+        #endif
+        #if (INS_GROUP_ENABLE & INS_VELBODY_BIT)
+        std::optional<Vec3f> velBody() const noexcept { return _data._get<Vec3f>(53); } /// < The estimated velocity in the body-frame.
+        #endif
+        #if (INS_GROUP_ENABLE & INS_VELNED_BIT)
+        std::optional<Vec3f> velNed() const noexcept { return _data._get<Vec3f>(54); } /// < The estimated velocity in the North East Down (NED) frame.  
+        #endif
+        #if (INS_GROUP_ENABLE & INS_VELECEF_BIT)
+        std::optional<Vec3f> velEcef() const noexcept { return _data._get<Vec3f>(55); } /// < The estimated velocity in the Earth centered Earth fixed (ECEF) frame. 
+        #endif
+        #if (INS_GROUP_ENABLE & INS_MAGECEF_BIT)
+        std::optional<Vec3f> magEcef() const noexcept { return _data._get<Vec3f>(56); } /// < The compensated magnetic measurement in the Earth centered Earth fixed (ECEF) frame.
+        #endif
+        #if (INS_GROUP_ENABLE & INS_ACCELECEF_BIT)
+        std::optional<Vec3f> accelEcef() const noexcept { return _data._get<Vec3f>(57); } /// < The estimated acceleration (with gravity) given in the Earth centered Earth fixed (ECEF) frame. The acceleration measurement has been bias compensated by the onboard INS filter. This measurement is attitude dependent because the attitude is used to map the measurement from the body-frame into the inertial (ECEF) frame. If the device is stationary and the INS filter is tracking, the measurement should be nominally equivalent to the gravity reference vector in the inertial frame (ECEF).
+        #endif
+        #if (INS_GROUP_ENABLE & INS_LINACCELECEF_BIT)
+        std::optional<Vec3f> linAccelEcef() const noexcept { return _data._get<Vec3f>(58); } /// < The estimated linear acceleration (without gravity) and given in the Earth centered Earth fixed (ECEF) frame. This measurement is attitude dependent as the attitude solution is used to map the measurement from the body-frame into the inertial (ECEF) frame. This acceleration measurement has been bias compensated by the onboard INS filter, and the gravity component has been removed using the current gravity reference vector estimate. If the device is stationary and the onboard INS filter is tracking, the measurement will nominally read 0 on all three axes.
+        #endif
+        #if (INS_GROUP_ENABLE & INS_POSU_BIT)
+        std::optional<float> posU() const noexcept { return _data._get<float>(59); } /// < The estimated uncertainty (1 Sigma) in the current position estimate.
+        #endif
+        #if (INS_GROUP_ENABLE & INS_VELU_BIT)
+        std::optional<float> velU() const noexcept { return _data._get<float>(60); } /// < The estimated uncertainty (1 Sigma) in the current velocity estimate.
+        #endif
+
+        const CompactCompositeData& _data;
+    };
+
+    struct Gnss2Group
+    {
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEUTC_BIT)
+        std::optional<TimeUtc> gnss2TimeUtc() const noexcept { return _data._get<TimeUtc>(61); } /// < The current UTC time.  The year is given as a signed byte year offset from the year 2000.  For example the year 2013 would be given as year 13.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GPS2TOW_BIT)
+        std::optional<Time> gps2Tow() const noexcept { return _data._get<Time>(62); } /// < The GPS time of week given in nano seconds.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GPS2WEEK_BIT)
+        std::optional<uint16_t> gps2Week() const noexcept { return _data._get<uint16_t>(63); } /// < The current GPS week.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2NUMSATS_BIT)
+        std::optional<uint8_t> gnss2NumSats() const noexcept { return _data._get<uint8_t>(64); } /// < The number of tracked GNSS satellites.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2FIX_BIT)
+        std::optional<uint8_t> gnss2Fix() const noexcept { return _data._get<uint8_t>(65); } /// < The current GNSS fix.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSLLA_BIT)
+        std::optional<Lla> gnss2PosLla() const noexcept { return _data._get<Lla>(66); } /// < The current GNSS position measurement given as the geodetic latitude, longitude and altitude above the ellipsoid.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSECEF_BIT)
+        std::optional<Vec3d> gnss2PosEcef() const noexcept { return _data._get<Vec3d>(67); } /// < The current GNSS position given in the Earth centered Earth fixed (ECEF) reference frame.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELNED_BIT)
+        std::optional<Vec3f> gnss2VelNed() const noexcept { return _data._get<Vec3f>(68); } /// < The current GNSS velocity in the North East Down (NED) reference frame.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELECEF_BIT)
+        std::optional<Vec3f> gnss2VelEcef() const noexcept { return _data._get<Vec3f>(69); } /// < The current GNSS velocity in the Earth centered Earth fixed (ECEF) reference frame.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSUNCERTAINTY_BIT)
+        std::optional<Vec3f> gnss2PosUncertainty() const noexcept { return _data._get<Vec3f>(70); } /// < The current GNSS position uncertainty in the North East Down (NED) reference frame.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELUNCERTAINTY_BIT)
+        std::optional<float> gnss2VelUncertainty() const noexcept { return _data._get<float>(71); } /// < The current GNSS velocity uncertainty.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEUNCERTAINTY_BIT)
+        std::optional<float> gnss2TimeUncertainty() const noexcept { return _data._get<float>(72); } /// < The current GPS time uncertainty.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEINFO_BIT)
+        std::optional<GnssTimeInfo> gnss2TimeInfo() const noexcept { return _data._get<GnssTimeInfo>(73); } /// < Flags for valid GPS TOW, week number and UTC and current leap seconds.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2DOP_BIT)
+        std::optional<GnssDop> gnss2Dop() const noexcept { return _data._get<GnssDop>(74); } /// < Dilution of precision.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2SATINFO_BIT)
+        std::optional<GnssSatInfo> gnss2SatInfo() const noexcept { return _data._getSatInfo(75); } /// < Information and measurements pertaining to each GNSS satellite in view.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2RAWMEAS_BIT)
+        std::optional<GnssRawMeas> gnss2RawMeas() const noexcept { return _data._getRawMeas(76); } /// < Raw measurements pertaining to each GNSS satellite in view.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2STATUS_BIT)
+        std::optional<GnssStatus> gnss2Status() const noexcept { return _data._get<GnssStatus>(77); } /// < GNSS Status info flags.
+        #endif
+        #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2ALTMSL_BIT)
+        std::optional<double> gnss2AltMSL() const noexcept { return _data._get<double>(78); } /// < Altitude (Mean Sea Level).
+        #endif
+
+        const CompactCompositeData& _data;
+    };
+
+    struct Gnss3Group
+    {
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEUTC_BIT)
+        std::optional<TimeUtc> gnss3TimeUtc() const noexcept { return _data._get<TimeUtc>(79); } /// < The current UTC time.  The year is given as a signed byte year offset from the year 2000.  For example the year 2013 would be given as year 13.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GPS3TOW_BIT)
+        std::optional<Time> gps3Tow() const noexcept { return _data._get<Time>(80); } /// < The GPS time of week given in nano seconds.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GPS3WEEK_BIT)
+        std::optional<uint16_t> gps3Week() const noexcept { return _data._get<uint16_t>(81); } /// < The current GPS week.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3NUMSATS_BIT)
+        std::optional<uint8_t> gnss3NumSats() const noexcept { return _data._get<uint8_t>(82); } /// < The number of tracked GNSS satellites.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3FIX_BIT)
+        std::optional<uint8_t> gnss3Fix() const noexcept { return _data._get<uint8_t>(83); } /// < The current GNSS fix.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSLLA_BIT)
+        std::optional<Lla> gnss3PosLla() const noexcept { return _data._get<Lla>(84); } /// < The current GNSS position measurement given as the geodetic latitude, longitude and altitude above the ellipsoid.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSECEF_BIT)
+        std::optional<Vec3d> gnss3PosEcef() const noexcept { return _data._get<Vec3d>(85); } /// < The current GNSS position given in the Earth centered Earth fixed (ECEF) reference frame.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELNED_BIT)
+        std::optional<Vec3f> gnss3VelNed() const noexcept { return _data._get<Vec3f>(86); } /// < The current GNSS velocity in the North East Down (NED) reference frame.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELECEF_BIT)
+        std::optional<Vec3f> gnss3VelEcef() const noexcept { return _data._get<Vec3f>(87); } /// < The current GNSS velocity in the Earth centered Earth fixed (ECEF) reference frame.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSUNCERTAINTY_BIT)
+        std::optional<Vec3f> gnss3PosUncertainty() const noexcept { return _data._get<Vec3f>(88); } /// < The current GNSS position uncertainty in the North East Down (NED) reference frame.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELUNCERTAINTY_BIT)
+        std::optional<float> gnss3VelUncertainty() const noexcept { return _data._get<float>(89); } /// < The current GNSS velocity uncertainty.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEUNCERTAINTY_BIT)
+        std::optional<float> gnss3TimeUncertainty() const noexcept { return _data._get<float>(90); } /// < The current GPS time uncertainty.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEINFO_BIT)
+        std::optional<GnssTimeInfo> gnss3TimeInfo() const noexcept { return _data._get<GnssTimeInfo>(91); } /// < Flags for valid GPS TOW, week number and UTC and current leap seconds.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3DOP_BIT)
+        std::optional<GnssDop> gnss3Dop() const noexcept { return _data._get<GnssDop>(92); } /// < Dilution of precision.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3SATINFO_BIT)
+        std::optional<GnssSatInfo> gnss3SatInfo() const noexcept { return _data._getSatInfo(93); } /// < Information and measurements pertaining to each GNSS satellite in view.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3RAWMEAS_BIT)
+        std::optional<GnssRawMeas> gnss3RawMeas() const noexcept { return _data._getRawMeas(94); } /// < Raw measurements pertaining to each GNSS satellite in view.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3STATUS_BIT)
+        std::optional<GnssStatus> gnss3Status() const noexcept { return _data._get<GnssStatus>(95); } /// < GNSS Status info flags.
+        #endif
+        #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3ALTMSL_BIT)
+        std::optional<double> gnss3AltMSL() const noexcept { return _data._get<double>(96); } /// < Altitude (Mean Sea Level).
+        #endif
+
+        const CompactCompositeData& _data;
+    };
+
+    #if (TIME_GROUP_ENABLE)
+    TimeGroup time() const noexcept { return {*this}; }
+    #endif
+    #if (IMU_GROUP_ENABLE)
+    ImuGroup imu() const noexcept { return {*this}; }
+    #endif
+    #if (GNSS_GROUP_ENABLE)
+    GnssGroup gnss() const noexcept { return {*this}; }
+    #endif
+    #if (ATTITUDE_GROUP_ENABLE)
+    AttitudeGroup attitude() const noexcept { return {*this}; }
+    #endif
+    #if (INS_GROUP_ENABLE)
+    InsGroup ins() const noexcept { return {*this}; }
+    #endif
+    #if (GNSS2_GROUP_ENABLE)
+    Gnss2Group gnss2() const noexcept { return {*this}; }
+    #endif
+    #if (GNSS3_GROUP_ENABLE)
+    Gnss3Group gnss3() const noexcept { return {*this}; }
+    #endif
+
+private:
+    static constexpr std::array<uint16_t, numFields> _offsets = []()
+    {
+        std::array<uint16_t, numFields> retVal{};
+        uint16_t offset = 0;
+        for (uint8_t i = 0; i < numFields; ++i)
+        {
+            retVal[i] = offset;
+            offset += fields[i].size;
+        }
+        return retVal;
+    }();
+    static constexpr uint16_t _payloadSize = _offsets[numFields - 1] + fields[numFields - 1].size;
+
+    std::array<uint32_t, (numFields + 31) / 32> _presence{};
+    std::array<uint8_t, (_payloadSize > 0) ? _payloadSize : 1> _payload{};
+    BinaryHeader _header;
+    CompactGnssSlab* _gnssSlab = nullptr;
+
+    bool _isPresent(const uint8_t index) const noexcept { return (_presence[index / 32] >> (index % 32)) & 1U; }
+    void _setPresent(const uint8_t index) noexcept { _presence[index / 32] |= (1U << (index % 32)); }
+    void _clearPresent(const uint8_t index) noexcept { _presence[index / 32] &= ~(1U << (index % 32)); }
+
+    static bool _isSatInfo(const Field& field) noexcept { return field.field == 14 && (field.group == 3 || field.group == 6 || field.group == 12); }
+    static bool _isRawMeas(const Field& field) noexcept { return field.field == 16 && (field.group == 3 || field.group == 6 || field.group == 12); }
+
+    uint8_t _slot(const uint8_t index) const noexcept { return _payload[_offsets[index]]; }
+
+    template <class T>
+    std::optional<T> _get(const uint8_t index) const noexcept
+    {
+        if (!_isPresent(index)) { return std::nullopt; }
+        T retVal;
+        std::memcpy(reinterpret_cast<uint8_t*>(&retVal), _payload.data() + _offsets[index], sizeof(T));
+        return retVal;
+    }
+
+    std::optional<GnssSatInfo> _getSatInfo(const uint8_t index) const noexcept
+    {
+        if (!_isPresent(index)) { return std::nullopt; }
+        return _gnssSlab->satInfo[_slot(index)];
+    }
+
+    std::optional<GnssRawMeas> _getRawMeas(const uint8_t index) const noexcept
+    {
+        if (!_isPresent(index)) { return std::nullopt; }
+        return _gnssSlab->rawMeas[_slot(index)];
+    }
+
+    void _releaseGnssBlocks() noexcept;
+    void _copyFrom(const CompactCompositeData& other) noexcept;
+    void _moveFrom(CompactCompositeData& other) noexcept;
+};
+
+inline bool CompactCompositeData::populate(const uint8_t* packet, const FaPacketProtocol::Metadata& metadata,
+                                           CompositeDataView::OffsetTable& offsetTable) noexcept
+{
+    clear();
+    if (offsetTable.update(packet, metadata)) { return true; }
+    _header = metadata.header;
+    timestamp = metadata.timestamp;
+    for (uint8_t i = 0; i < numFields; ++i)
+    {
+        const Field& field = fields[i];
+        if (field.size == 0) { continue; }
+        const auto offset = offsetTable.offset(field.group, field.field);
+        if (!offset.has_value()) { continue; }
+
+        if (_isSatInfo(field) || _isRawMeas(field))
+        {
+            if (_gnssSlab == nullptr) { continue; }
+            uint8_t slot;
+            if (_isSatInfo(field))
+            {
+                slot = _gnssSlab->satInfo.allocate();
+                if (slot == decltype(_gnssSlab->satInfo)::invalidIndex)
+                {
+                    _gnssSlab->numDropped.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                CompositeDataView::_copy(packet + *offset, _gnssSlab->satInfo[slot]);
+            }
+            else
+            {
+                slot = _gnssSlab->rawMeas.allocate();
+                if (slot == decltype(_gnssSlab->rawMeas)::invalidIndex)
+                {
+                    _gnssSlab->numDropped.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                CompositeDataView::_copy(packet + *offset, _gnssSlab->rawMeas[slot]);
+            }
+            _payload[_offsets[i]] = slot;
+        }
+        else { std::memcpy(_payload.data() + _offsets[i], packet + *offset, field.size); }
+        _setPresent(i);
+    }
+    return false;
+}
+
+inline void CompactCompositeData::_releaseGnssBlocks() noexcept
+{
+    if (_gnssSlab == nullptr) { return; }
+    for (uint8_t i = 0; i < numFields; ++i)
+    {
+        if (!_isPresent(i)) { continue; }
+        if (_isSatInfo(fields[i])) { _gnssSlab->satInfo.release(_slot(i)); }
+        else if (_isRawMeas(fields[i])) { _gnssSlab->rawMeas.release(_slot(i)); }
+        else { continue; }
+        _clearPresent(i);
+    }
+}
+
+inline void CompactCompositeData::_copyFrom(const CompactCompositeData& other) noexcept
+{
+    timestamp = other.timestamp;
+    _presence = other._presence;
+    _payload = other._payload;
+    _header = other._header;
+    _gnssSlab = other._gnssSlab;
+    if (_gnssSlab == nullptr) { return; }
+    // GNSS blocks are deep-copied into slots of their own, so each copy can be released independently.
+    for (uint8_t i = 0; i < numFields; ++i)
+    {
+        if (!_isPresent(i)) { continue; }
+        if (_isSatInfo(fields[i]))
+        {
+            const uint8_t slot = _gnssSlab->satInfo.allocate();
+            if (slot == decltype(_gnssSlab->satInfo)::invalidIndex)
+            {
+                _gnssSlab->numDropped.fetch_add(1, std::memory_order_relaxed);
+                _clearPresent(i);
+            }
+            else
+            {
+                _gnssSlab->satInfo[slot] = _gnssSlab->satInfo[other._slot(i)];
+                _payload[_offsets[i]] = slot;
+            }
+        }
+        else if (_isRawMeas(fields[i]))
+        {
+            const uint8_t slot = _gnssSlab->rawMeas.allocate();
+            if (slot == decltype(_gnssSlab->rawMeas)::invalidIndex)
+            {
+                _gnssSlab->numDropped.fetch_add(1, std::memory_order_relaxed);
+                _clearPresent(i);
+            }
+            else
+            {
+                _gnssSlab->rawMeas[slot] = _gnssSlab->rawMeas[other._slot(i)];
+                _payload[_offsets[i]] = slot;
+            }
+        }
+    }
+}
+
+inline void CompactCompositeData::_moveFrom(CompactCompositeData& other) noexcept
+{
+    timestamp = other.timestamp;
+    _presence = other._presence;
+    _payload = other._payload;
+    _header = other._header;
+    _gnssSlab = other._gnssSlab;
+    // The slots now belong to this object.
+    other._presence.fill(0);
+}
+
+inline CompositeData CompactCompositeData::toCompositeData() const noexcept
+{
+    CompositeData retVal(_header);
+    retVal.timestamp = timestamp;
+    #if (TIME_GROUP_ENABLE & TIME_TIMESTARTUP_BIT)
+    retVal.time.timeStartup = time().timeStartup();
+    #endif
+    #if (TIME_GROUP_ENABLE & TIME_TIMEGPS_BIT)
+    retVal.time.timeGps = time().timeGps();
+    #endif
+    #if (TIME_GROUP_ENABLE & TIME_TIMEGPSTOW_BIT)
+    retVal.time.timeGpsTow = time().timeGpsTow();
+    #endif
+    #if (TIME_GROUP_ENABLE & TIME_TIMEGPSWEEK_BIT)
+    retVal.time.timeGpsWeek = time().timeGpsWeek();
+    #endif
+    #if (TIME_GROUP_ENABLE & TIME_TIMESYNCIN_BIT)
+    retVal.time.timeSyncIn = time().timeSyncIn();
+    #endif
+    #if (TIME_GROUP_ENABLE & TIME_TIMEGPSPPS_BIT)
+    retVal.time.timeGpsPps = time().timeGpsPps();
+    #endif
+    #if (TIME_GROUP_ENABLE & TIME_TIMEUTC_BIT)
+    retVal.time.timeUtc = time().timeUtc();
+    #endif
+    #if (TIME_GROUP_ENABLE & TIME_SYNCINCNT_BIT)
+    retVal.time.syncInCnt = time().syncInCnt();
+    #endif
+    #if (TIME_GROUP_ENABLE & TIME_SYNCOUTCNT_BIT)
+    retVal.time.syncOutCnt = time().syncOutCnt();
+    #endif
+    #if (TIME_GROUP_ENABLE & TIME_TIMESTATUS_BIT)
+    retVal.time.timeStatus = time().timeStatus();
+    #endif
+    #if (IMU_GROUP_ENABLE & IMU_IMUSTATUS_BIT)
+    retVal.imu.imuStatus = imu().imuStatus();
+    #endif
+    #if (IMU_GROUP_ENABLE & IMU_UNCOMPMAG_BIT)
+    retVal.imu.uncompMag = imu().uncompMag();
+    #endif
+    #if (IMU_GROUP_ENABLE & IMU_UNCOMPACCEL_BIT)
+    retVal.imu.uncompAccel = imu().uncompAccel();
+    #endif
+    #if (IMU_GROUP_ENABLE & IMU_UNCOMPGYRO_BIT)
+    retVal.imu.uncompGyro = imu().uncompGyro();
+    #endif
+    #if (IMU_GROUP_ENABLE & IMU_TEMPERATURE_BIT)
+    retVal.imu.temperature = imu().temperature();
+    #endif
+    #if (IMU_GROUP_ENABLE & IMU_PRESSURE_BIT)
+    retVal.imu.pressure = imu().pressure();
+    #endif
+    #if (IMU_GROUP_ENABLE & IMU_DELTATHETA_BIT)
+    retVal.imu.deltaTheta = imu().deltaTheta();
+    #endif
+    #if (IMU_GROUP_ENABLE & IMU_DELTAVEL_BIT)
+    retVal.imu.deltaVel = imu().deltaVel();
+    #endif
+    #if (IMU_GROUP_ENABLE & IMU_MAG_BIT)
+    retVal.imu.mag = imu().mag();
+    #endif
+    #if (IMU_GROUP_ENABLE & IMU_ACCEL_BIT)
+    retVal.imu.accel = imu().accel();
+    #endif
+    #if (IMU_GROUP_ENABLE & IMU_ANGULARRATE_BIT)
+    retVal.imu.angularRate = imu().angularRate();
+    #endif
+    #if (IMU_GROUP_ENABLE & IMU_SENSSAT_BIT)
+    retVal.imu.sensSat = imu().sensSat();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEUTC_BIT)
+    retVal.gnss.gnss1TimeUtc = gnss().gnss1TimeUtc();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GPS1TOW_BIT)
+    retVal.gnss.gps1Tow = gnss().gps1Tow();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GPS1WEEK_BIT)
+    retVal.gnss.gps1Week = gnss().gps1Week();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1NUMSATS_BIT)
+    retVal.gnss.gnss1NumSats = gnss().gnss1NumSats();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1FIX_BIT)
+    retVal.gnss.gnss1Fix = gnss().gnss1Fix();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSLLA_BIT)
+    retVal.gnss.gnss1PosLla = gnss().gnss1PosLla();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSECEF_BIT)
+    retVal.gnss.gnss1PosEcef = gnss().gnss1PosEcef();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELNED_BIT)
+    retVal.gnss.gnss1VelNed = gnss().gnss1VelNed();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELECEF_BIT)
+    retVal.gnss.gnss1VelEcef = gnss().gnss1VelEcef();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSUNCERTAINTY_BIT)
+    retVal.gnss.gnss1PosUncertainty = gnss().gnss1PosUncertainty();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELUNCERTAINTY_BIT)
+    retVal.gnss.gnss1VelUncertainty = gnss().gnss1VelUncertainty();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEUNCERTAINTY_BIT)
+    retVal.gnss.gnss1TimeUncertainty = gnss().gnss1TimeUncertainty();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEINFO_BIT)
+    retVal.gnss.gnss1TimeInfo = gnss().gnss1TimeInfo();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1DOP_BIT)
+    retVal.gnss.gnss1Dop = gnss().gnss1Dop();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1SATINFO_BIT)
+    retVal.gnss.gnss1SatInfo = gnss().gnss1SatInfo();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1RAWMEAS_BIT)
+    retVal.gnss.gnss1RawMeas = gnss().gnss1RawMeas();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1STATUS_BIT)
+    retVal.gnss.gnss1Status = gnss().gnss1Status();
+    #endif
+    #if (GNSS_GROUP_ENABLE & GNSS_GNSS1ALTMSL_BIT)
+    retVal.gnss.gnss1AltMSL = gnss().gnss1AltMSL();
+    #endif
+    #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPR_BIT)
+    retVal.attitude.ypr = attitude().ypr();
+    #endif
+    #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_QUATERNION_BIT)
+    retVal.attitude.quaternion = attitude().quaternion();
+    #endif
+    #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_DCM_BIT)
+    retVal.attitude.dcm = attitude().dcm();
+    #endif
+    #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_MAGNED_BIT)
+    retVal.attitude.magNed = attitude().magNed();
+    #endif
+    #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ACCELNED_BIT)
+    retVal.attitude.accelNed = attitude().accelNed();
+    #endif
+    #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINBODYACC_BIT)
+    retVal.attitude.linBodyAcc = attitude().linBodyAcc();
+    #endif
+    #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINACCELNED_BIT)
+    retVal.attitude.linAccelNed = attitude().linAccelNed();
+    #endif
+    #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPRU_BIT)
+    retVal.attitude.yprU = attitude().yprU();
+    #endif
+    #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_HEAVE_BIT)
+    retVal.attitude.heave = attitude().heave();
+    #endif
+    #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ATTU_BIT)
+    retVal.attitude.attU = attitude().attU();
+    #endif
+    #if (INS_GROUP_ENABLE & INS_INSSTATUS_BIT)
+    retVal.ins.insStatus = ins().insStatus();
+    #endif
+    #if (INS_GROUP_ENABLE & INS_POSLLA_BIT)
+    retVal.ins.posLla = ins().posLla();
+    #endif
+    #if (INS_GROUP_ENABLE & INS_POSECEF_BIT)
+    retVal.ins.posEcef = ins().posEcef();
+    #endif
+    #if (INS_GROUP_ENABLE & INS_VELBODY_BIT)
+    retVal.ins.velBody = ins().velBody();
+    #endif
+    #if (INS_GROUP_ENABLE & INS_VELNED_BIT)
+    retVal.ins.velNed = ins().velNed();
+    #endif
+    #if (INS_GROUP_ENABLE & INS_VELECEF_BIT)
+    retVal.ins.velEcef = ins().velEcef();
+    #endif
+    #if (INS_GROUP_ENABLE & INS_MAGECEF_BIT)
+    retVal.ins.magEcef = ins().magEcef();
+    #endif
+    #if (INS_GROUP_ENABLE & INS_ACCELECEF_BIT)
+    retVal.ins.accelEcef = ins().accelEcef();
+    #endif
+    #if (INS_GROUP_ENABLE & INS_LINACCELECEF_BIT)
+    retVal.ins.linAccelEcef = ins().linAccelEcef();
+    #endif
+    #if (INS_GROUP_ENABLE & INS_POSU_BIT)
+    retVal.ins.posU = ins().posU();
+    #endif
+    #if (INS_GROUP_ENABLE & INS_VELU_BIT)
+    retVal.ins.velU = ins().velU();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEUTC_BIT)
+    retVal.gnss2.gnss2TimeUtc = gnss2().gnss2TimeUtc();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GPS2TOW_BIT)
+    retVal.gnss2.gps2Tow = gnss2().gps2Tow();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GPS2WEEK_BIT)
+    retVal.gnss2.gps2Week = gnss2().gps2Week();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2NUMSATS_BIT)
+    retVal.gnss2.gnss2NumSats = gnss2().gnss2NumSats();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2FIX_BIT)
+    retVal.gnss2.gnss2Fix = gnss2().gnss2Fix();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSLLA_BIT)
+    retVal.gnss2.gnss2PosLla = gnss2().gnss2PosLla();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSECEF_BIT)
+    retVal.gnss2.gnss2PosEcef = gnss2().gnss2PosEcef();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELNED_BIT)
+    retVal.gnss2.gnss2VelNed = gnss2().gnss2VelNed();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELECEF_BIT)
+    retVal.gnss2.gnss2VelEcef = gnss2().gnss2VelEcef();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSUNCERTAINTY_BIT)
+    retVal.gnss2.gnss2PosUncertainty = gnss2().gnss2PosUncertainty();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELUNCERTAINTY_BIT)
+    retVal.gnss2.gnss2VelUncertainty = gnss2().gnss2VelUncertainty();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEUNCERTAINTY_BIT)
+    retVal.gnss2.gnss2TimeUncertainty = gnss2().gnss2TimeUncertainty();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEINFO_BIT)
+    retVal.gnss2.gnss2TimeInfo = gnss2().gnss2TimeInfo();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2DOP_BIT)
+    retVal.gnss2.gnss2Dop = gnss2().gnss2Dop();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2SATINFO_BIT)
+    retVal.gnss2.gnss2SatInfo = gnss2().gnss2SatInfo();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2RAWMEAS_BIT)
+    retVal.gnss2.gnss2RawMeas = gnss2().gnss2RawMeas();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2STATUS_BIT)
+    retVal.gnss2.gnss2Status = gnss2().gnss2Status();
+    #endif
+    #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2ALTMSL_BIT)
+    retVal.gnss2.gnss2AltMSL = gnss2().gnss2AltMSL();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEUTC_BIT)
+    retVal.gnss3.gnss3TimeUtc = gnss3().gnss3TimeUtc();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GPS3TOW_BIT)
+    retVal.gnss3.gps3Tow = gnss3().gps3Tow();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GPS3WEEK_BIT)
+    retVal.gnss3.gps3Week = gnss3().gps3Week();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3NUMSATS_BIT)
+    retVal.gnss3.gnss3NumSats = gnss3().gnss3NumSats();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3FIX_BIT)
+    retVal.gnss3.gnss3Fix = gnss3().gnss3Fix();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSLLA_BIT)
+    retVal.gnss3.gnss3PosLla = gnss3().gnss3PosLla();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSECEF_BIT)
+    retVal.gnss3.gnss3PosEcef = gnss3().gnss3PosEcef();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELNED_BIT)
+    retVal.gnss3.gnss3VelNed = gnss3().gnss3VelNed();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELECEF_BIT)
+    retVal.gnss3.gnss3VelEcef = gnss3().gnss3VelEcef();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSUNCERTAINTY_BIT)
+    retVal.gnss3.gnss3PosUncertainty = gnss3().gnss3PosUncertainty();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELUNCERTAINTY_BIT)
+    retVal.gnss3.gnss3VelUncertainty = gnss3().gnss3VelUncertainty();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEUNCERTAINTY_BIT)
+    retVal.gnss3.gnss3TimeUncertainty = gnss3().gnss3TimeUncertainty();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEINFO_BIT)
+    retVal.gnss3.gnss3TimeInfo = gnss3().gnss3TimeInfo();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3DOP_BIT)
+    retVal.gnss3.gnss3Dop = gnss3().gnss3Dop();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3SATINFO_BIT)
+    retVal.gnss3.gnss3SatInfo = gnss3().gnss3SatInfo();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3RAWMEAS_BIT)
+    retVal.gnss3.gnss3RawMeas = gnss3().gnss3RawMeas();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3STATUS_BIT)
+    retVal.gnss3.gnss3Status = gnss3().gnss3Status();
+    #endif
+    #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3ALTMSL_BIT)
+    retVal.gnss3.gnss3AltMSL = gnss3().gnss3AltMSL();
+    #endif
+    return retVal;
+}
+
+using CompactMeasurementQueue = DirectAccessQueue<CompactCompositeData, Config::PacketDispatchers::compositeDataQueueCapacity>;
+
+}  // namespace VN
+
+#endif  // INTERFACE_COMPACTCOMPOSITEDATA_HPP
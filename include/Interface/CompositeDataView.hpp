@@ -0,0 +1,523 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef INTERFACE_COMPOSITEDATAVIEW_HPP
+#define INTERFACE_COMPOSITEDATAVIEW_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+#include "Config.hpp"
+#include "HAL/Timer.hpp"
+#include "Implementation/BinaryHeader.hpp"
+#include "Implementation/BinaryMeasurementDefinitions.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "Implementation/MeasurementDatatypes.hpp"
+#include "Implementation/Packet.hpp"
+#include "Interface/CompositeData.hpp"
+#include "Interface/Registers.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+
+namespace VN
+{
+
+/// @brief A lazily-decoded, read-only view over a single FA (binary) packet.
+/// Rather than decoding every measurement up front as CompositeData does, the view holds a pointer to the linear packet bytes and an OffsetTable locating
+/// each measurement within them. Each accessor decodes only the requested measurement, when called, so the cost scales with the fields a consumer reads.
+/// Measurements output in the Common group are found through their native group accessor, as in CompositeData.
+/// The packet bytes (e.g. a Packet popped from a subscribed PacketQueue) and the OffsetTable must outlive the view.
+class CompositeDataView
+{
+public:
+    /// @brief Location of each measurement in a packet, relative to its sync byte. Built once per binary header and reused for subsequent packets with the
+    /// same header, unless the header contains a dynamically-sized measurement (GNSS SatInfo or RawMeas), in which case it is rebuilt for every packet.
+    class OffsetTable
+    {
+    public:
+        /// @brief Ensures the table describes the passed packet, rebuilding it only if necessary.
+        /// @param packet The linear packet bytes, starting at the sync byte.
+        /// @param metadata The metadata found for the packet.
+        /// @return True if the packet contents do not match its header.
+        bool update(const uint8_t* packet, const FaPacketProtocol::Metadata& metadata) noexcept
+        {
+            if (_isPopulated && !_hasDynamicFields && (_header == metadata.header) && (_length == metadata.length)) { return false; }
+            return _build(packet, metadata);
+        }
+
+        /// @brief Gets the offset of a measurement from the packet's sync byte, if present.
+        std::optional<uint16_t> offset(const uint8_t group, const uint8_t field) const noexcept
+        {
+            if (group >= numGroups || field >= numFieldsPerGroup) { return std::nullopt; }
+            const uint16_t retVal = _offsets[group * numFieldsPerGroup + field];
+            return (retVal == 0) ? std::nullopt : std::make_optional(retVal);
+        }
+
+        const BinaryHeader& header() const noexcept { return _header; }
+        size_t length() const noexcept { return _length; }
+        bool hasDynamicFields() const noexcept { return _hasDynamicFields; }
+
+        static constexpr uint8_t numGroups = 13;  // Up to and including GNSS3
+        static constexpr uint8_t numFieldsPerGroup = 32;
+
+    private:
+        std::array<uint16_t, numGroups * numFieldsPerGroup> _offsets{};  // Zero is the sync byte, so is used to mark an absent measurement
+        BinaryHeader _header{};
+        size_t _length = 0;
+        bool _isPopulated = false;
+        bool _hasDynamicFields = false;
+
+        bool _build(const uint8_t* packet, const FaPacketProtocol::Metadata& metadata) noexcept;
+        void _set(const size_t group, const size_t field, const size_t offset) noexcept
+        {
+            if (group < numGroups && field < numFieldsPerGroup) { _offsets[group * numFieldsPerGroup + field] = static_cast<uint16_t>(offset); }
+        }
+    };
+
+    /// @brief Constructs a view over a linear FA packet.
+    /// @param packet The linear packet bytes, starting at the sync byte.
+    /// @param metadata The metadata found for the packet.
+    /// @param offsetTable The table to populate, or reuse if it already describes this header. Typically held by the consumer across packets.
+    CompositeDataView(const uint8_t* packet, const FaPacketProtocol::Metadata& metadata, OffsetTable& offsetTable) noexcept
+        : timestamp(metadata.timestamp), _packet(packet), _offsetTable(offsetTable)
+    {
+        _isValid = !_offsetTable.update(_packet, metadata);
+    }
+
+    /// @brief Constructs a view over a packet popped from a subscribed PacketQueue. The packet must be an FA packet.
+    CompositeDataView(const Packet& packet, OffsetTable& offsetTable) noexcept : _packet(packet.buffer), _offsetTable(offsetTable)
+    {
+        if (packet.details.syncByte != PacketDetails::SyncByte::FA) { return; }
+        timestamp = packet.details.faMetadata.timestamp;
+        _isValid = !_offsetTable.update(_packet, packet.details.faMetadata);
+    }
+
+    /// @brief Whether the packet was an FA packet whose contents match its header. If not, every accessor returns std::nullopt.
+    bool isValid() const noexcept { return _isValid; }
+
+    /// @brief Checks whether the passed header matches the header of the viewed message.
+    bool matchesMessage(const BinaryHeader& binaryHeader) const noexcept { return _isValid && (binaryHeader == _offsetTable.header()); }
+
+    /// @brief Checks whether the passed register matches the header of the viewed message.
+    bool matchesMessage(const Registers::System::BinaryOutput& binaryOutputRegister) const noexcept
+    {
+        return matchesMessage(binaryOutputRegister.toBinaryHeader());
+    }
+
+    const BinaryHeader& header() const noexcept { return _offsetTable.header(); }
+
+    /// @brief Eagerly decodes the whole packet, for consumers which need an owning copy.
+    std::optional<CompositeData> toCompositeData(const EnabledMeasurements& measurementsToParse = Config::PacketDispatchers::cdEnabledMeasTypes) const noexcept;
+
+    time_point timestamp;
+
+    struct TimeGroup
+    {
+        /// @brief The system time since startup measured in nano seconds.  The time since startup is based upon the internal TXCO oscillator for the MCU.  The accuracy of the internal TXCO is plus minus 20ppm (-40C to 85C).
+        std::optional<Time> timeStartup() const noexcept { return _view._decode<Time>(1, 0); }
+        /// @brief The absolute GPS time since start of GPS epoch 1980 expressed in nano seconds.
+        std::optional<Time> timeGps() const noexcept { return _view._decode<Time>(1, 1); }
+        /// @brief The time since the start of the current GPS time week expressed in nano seconds.
+        std::optional<Time> timeGpsTow() const noexcept { return _view._decode<Time>(1, 2); }
+        /// @brief The current GPS week.
+        std::optional<uint16_t> timeGpsWeek() const noexcept { return _view._decode<uint16_t>(1, 3); }
+        /// @brief The time since the last SyncIn event trigger expressed in nano seconds.
+        std::optional<Time> timeSyncIn() const noexcept { return _view._decode<Time>(1, 4); }
+        /// @brief The time since the last GPS PPS trigger event expressed in nano seconds.
+        std::optional<Time> timeGpsPps() const noexcept { return _view._decode<Time>(1, 5); }
+        /// @brief The current UTC time.  The year is given as a signed byte year offset from the year 2000.  For example the year 2013 would be given as year 13.
+        std::optional<TimeUtc> timeUtc() const noexcept { return _view._decode<TimeUtc>(1, 6); }
+        /// @brief The number of SyncIn trigger events that have occurred.
+        std::optional<uint32_t> syncInCnt() const noexcept { return _view._decode<uint32_t>(1, 7); }
+        /// @brief The number of SyncOut trigger events that have occurred.
+        std::optional<uint32_t> syncOutCnt() const noexcept { return _view._decode<uint32_t>(1, 8); }
+        /// @brief Time valid status flags.
+        std::optional<TimeStatus> timeStatus() const noexcept { return _view._decode<TimeStatus>(1, 9); }
+
+        const CompositeDataView& _view;
+    };
+
+    struct ImuGroup
+    {
+        /// @brief Reports various statuses of the IMU sensors.
+        std::optional<ImuStatus> imuStatus() const noexcept { return _view._decode<ImuStatus>(2, 0); }
+        /// @brief The IMU magnetic field given in the body-frame.  This measurement is compensated by the static calibration (individual factory calibration stored in flash), and the user compensation, however it is not compensated by the onboard Hard/Soft Iron estimator.
+        std::optional<Vec3f> uncompMag() const noexcept { return _view._decode<Vec3f>(2, 1); }
+        /// @brief The IMU acceleration given in the body-frame.  This measurement is compensated by the static calibration (individual factory calibration stored in flash), however it is not compensated by any bias compensation from the onboard Kalman filter.
+        std::optional<Vec3f> uncompAccel() const noexcept { return _view._decode<Vec3f>(2, 2); }
+        /// @brief The IMU angular rate given in the body-frame.  This measurement is compensated by the static calibration (individual factory calibration stored in flash), however it is not compensated by any bias compensation from the onboard Kalman filter.
+        std::optional<Vec3f> uncompGyro() const noexcept { return _view._decode<Vec3f>(2, 3); }
+        /// @brief The IMU temperature.
+        std::optional<float> temperature() const noexcept { return _view._decode<float>(2, 4); }
+        /// @brief The IMU pressure.  This is an absolute pressure measurement.  Typical pressure at sea level would be around 100 kPa.
+        std::optional<float> pressure() const noexcept { return _view._decode<float>(2, 5); }
+        /// @brief The delta theta is the delta rotation angles incurred due to rotation, since the last time the values were output by the device. The delta angles are calculated based upon the onboard conning and sculling integration performed onboard the sensor at the IMU sampling rate. The delta time is the time interval that the delta angle and velocities are integrated over. The integration for the delta angles are reset each time the values are either polled or sent out due to a scheduled asynchronous ASCII or binary output.
+        std::optional<DeltaTheta> deltaTheta() const noexcept { return _view._decode<DeltaTheta>(2, 6); }
+        /// @brief The delta velocity is the delta velocity incurred due to motion, since the last time the values were output by the device. The delta velocities are calculated based upon the onboard conning and sculling integration performed onboard the sensor at the IMU sampling rate. The integration for the delta velocities are reset each time the values are either polled or sent out due to a scheduled asynchronous ASCII or binary output.
+        std::optional<Vec3f> deltaVel() const noexcept { return _view._decode<Vec3f>(2, 7); }
+        /// @brief The IMU compensated magnetic field given in the body-frame.  This measurement is compensated by the static calibration (individual factory calibration stored in flash), the user compensation, and the dynamic calibration from the onboard Hard/Soft Iron estimator.
+        std::optional<Vec3f> mag() const noexcept { return _view._decode<Vec3f>(2, 8); }
+        /// @brief The bias-compensated acceleration measured in the body-frame. This measurement is compensated by the static calibration (individual factory calibration stored in flash), the user compensation, and the dynamic bias compensation from the onboard Kalman filter (if applicable).
+        std::optional<Vec3f> accel() const noexcept { return _view._decode<Vec3f>(2, 9); }
+        /// @brief The bias-compensated angular rate measured in the body-frame.  This measurement is compensated by the static calibration (individual factory calibration stored in flash), the user compensation, and the dynamic bias compensation from the onboard Kalman filter.
+        std::optional<Vec3f> angularRate() const noexcept { return _view._decode<Vec3f>(2, 10); }
+        /// @brief This field provides flags identifying whether any of the measurements are currently saturated.
+        std::optional<uint16_t> sensSat() const noexcept { return _view._decode<uint16_t>(2, 11); }
+
+        const CompositeDataView& _view;
+    };
+
+    struct GnssGroup
+    {
+        /// @brief The current UTC time.  The year is given as a signed byte year offset from the year 2000.  For example the year 2013 would be given as year 13.
+        std::optional<TimeUtc> gnss1TimeUtc() const noexcept { return _view._decode<TimeUtc>(3, 0); }
+        /// @brief The GPS time of week given in nano seconds.
+        std::optional<Time> gps1Tow() const noexcept { return _view._decode<Time>(3, 1); }
+        /// @brief The current GPS week.
+        std::optional<uint16_t> gps1Week() const noexcept { return _view._decode<uint16_t>(3, 2); }
+        /// @brief The number of tracked GNSS satellites.
+        std::optional<uint8_t> gnss1NumSats() const noexcept { return _view._decode<uint8_t>(3, 3); }
+        /// @brief The current GNSS fix.
+        std::optional<uint8_t> gnss1Fix() const noexcept { return _view._decode<uint8_t>(3, 4); }
+        /// @brief The current GNSS position measurement given as the geodetic latitude, longitude and altitude above the ellipsoid.
+        std::optional<Lla> gnss1PosLla() const noexcept { return _view._decode<Lla>(3, 5); }
+        /// @brief The current GNSS position given in the Earth centered Earth fixed (ECEF) reference frame.
+        std::optional<Vec3d> gnss1PosEcef() const noexcept { return _view._decode<Vec3d>(3, 6); }
+        /// @brief The current GNSS velocity in the North East Down (NED) reference frame.
+        std::optional<Vec3f> gnss1VelNed() const noexcept { return _view._decode<Vec3f>(3, 7); }
+        /// @brief The current GNSS velocity in the Earth centered Earth fixed (ECEF) reference frame.
+        std::optional<Vec3f> gnss1VelEcef() const noexcept { return _view._decode<Vec3f>(3, 8); }
+        /// @brief The current GNSS position uncertainty in the North East Down (NED) reference frame.
+        std::optional<Vec3f> gnss1PosUncertainty() const noexcept { return _view._decode<Vec3f>(3, 9); }
+        /// @brief The current GNSS velocity uncertainty.
+        std::optional<float> gnss1VelUncertainty() const noexcept { return _view._decode<float>(3, 10); }
+        /// @brief The current GPS time uncertainty.
+        std::optional<float> gnss1TimeUncertainty() const noexcept { return _view._decode<float>(3, 11); }
+        /// @brief Flags for valid GPS TOW, week number and UTC and current leap seconds.
+        std::optional<GnssTimeInfo> gnss1TimeInfo() const noexcept { return _view._decode<GnssTimeInfo>(3, 12); }
+        /// @brief Dilution of precision.
+        std::optional<GnssDop> gnss1Dop() const noexcept { return _view._decode<GnssDop>(3, 13); }
+        /// @brief Information and measurements pertaining to each GNSS satellite in view.
+        std::optional<GnssSatInfo> gnss1SatInfo() const noexcept { return _view._decode<GnssSatInfo>(3, 14); }
+        /// @brief Raw measurements pertaining to each GNSS satellite in view.
+        std::optional<GnssRawMeas> gnss1RawMeas() const noexcept { return _view._decode<GnssRawMeas>(3, 16); }
+        /// @brief GNSS Status info flags.
+        std::optional<GnssStatus> gnss1Status() const noexcept { return _view._decode<GnssStatus>(3, 17); }
+        /// @brief Altitude (Mean Sea Level).
+        std::optional<double> gnss1AltMSL() const noexcept { return _view._decode<double>(3, 18); }
+
+        const CompositeDataView& _view;
+    };
+
+    struct AttitudeGroup
+    {
+        /// @brief The estimated attitude describing the body frame with respect to the local North-East-Down (NED) frame given as the (3-2-1) set of Euler angles corresponding to Yaw-Pitch-Roll.
+        std::optional<Ypr> ypr() const noexcept { return _view._decode<Ypr>(4, 1); }
+        /// @brief The estimated attitude describing the body frame with respect to the local North-East-Down (NED) frame given as the quaternion.
+        std::optional<Quat> quaternion() const noexcept { return _view._decode<Quat>(4, 2); }
+        /// @brief The estimated attitude given as the directional cosine matrix (DCM) in column major order mapping the local North-East-Down (NED) frame into the body frame.
+        std::optional<Mat3f> dcm() const noexcept { return _view._decode<Mat3f>(4, 3); }
+        /// @brief The current estimated magnetic field given in the local North-East-Down (NED) frame.
+        std::optional<Vec3f> magNed() const noexcept { return _view._decode<Vec3f>(4, 4); }
+        /// @brief The estimated acceleration (with gravity) given in the local North-East-Down (NED) frame.
+        std::optional<Vec3f> accelNed() const noexcept { return _view._decode<Vec3f>(4, 5); }
+        /// @brief The estimated linear acceleration (without gravity) given in the body frame.
+        std::optional<Vec3f> linBodyAcc() const noexcept { return _view._decode<Vec3f>(4, 6); }
+        /// @brief The estimated linear acceleration (without gravity) given in the local North-East-Down (NED) frame.
+        std::optional<Vec3f> linAccelNed() const noexcept { return _view._decode<Vec3f>(4, 7); }
+        /// @brief The estimated attitude (Yaw, Pitch, Roll) uncertainty (1 Sigma), reported in degrees.
+        std::optional<Vec3f> yprU() const noexcept { return _view._decode<Vec3f>(4, 8); }
+        /// @brief Real-time heave and heave-rate estimates, plus a delayed-heave estimate.
+        std::optional<Vec3f> heave() const noexcept { return _view._decode<Vec3f>(4, 12); }
+        /// @brief The estimated uncertainty (1 Sigma) in the current attitude estimate.
+        std::optional<float> attU() const noexcept { return _view._decode<float>(4, 13); }
+
+        const CompositeDataView& _view;
+    };
+
+    struct InsGroup
+    {
+        /// @brief The INS status bitfield.
+        std::optional<InsStatus> insStatus() const noexcept { return _view._decode<InsStatus>(5, 0); }
+        /// @brief The estimated position given as latitude, longitude, and altitude.
+        std::optional<Lla> posLla() const noexcept { return _view._decode<Lla>(5, 1); }
+        /// @brief The estimate position given in the Earth centered Earth fixed (ECEF) frame.
+        std::optional<Vec3d> posEcef() const noexcept { return _view._decode<Vec3d>(5, 2); }
+        /// @brief The estimated velocity in the body-frame.
+        std::optional<Vec3f> velBody() const noexcept { return _view._decode<Vec3f>(5, 3); }
+        /// @brief The estimated velocity in the North East Down (NED) frame.  
+        std::optional<Vec3f> velNed() const noexcept { return _view._decode<Vec3f>(5, 4); }
+        /// @brief The estimated velocity in the Earth centered Earth fixed (ECEF) frame. 
+        std::optional<Vec3f> velEcef() const noexcept { return _view._decode<Vec3f>(5, 5); }
+        /// @brief The compensated magnetic measurement in the Earth centered Earth fixed (ECEF) frame.
+        std::optional<Vec3f> magEcef() const noexcept { return _view._decode<Vec3f>(5, 6); }
+        /// @brief The estimated acceleration (with gravity) given in the Earth centered Earth fixed (ECEF) frame. The acceleration measurement has been bias compensated by the onboard INS filter. This measurement is attitude dependent because the attitude is used to map the measurement from the body-frame into the inertial (ECEF) frame. If the device is stationary and the INS filter is tracking, the measurement should be nominally equivalent to the gravity reference vector in the inertial frame (ECEF).
+        std::optional<Vec3f> accelEcef() const noexcept { return _view._decode<Vec3f>(5, 7); }
+        /// @brief The estimated linear acceleration (without gravity) and given in the Earth centered Earth fixed (ECEF) frame. This measurement is attitude dependent as the attitude solution is used to map the measurement from the body-frame into the inertial (ECEF) frame. This acceleration measurement has been bias compensated by the onboard INS filter, and the gravity component has been removed using the current gravity reference vector estimate. If the device is stationary and the onboard INS filter is tracking, the measurement will nominally read 0 on all three axes.
+        std::optional<Vec3f> linAccelEcef() const noexcept { return _view._decode<Vec3f>(5, 8); }
+        /// @brief The estimated uncertainty (1 Sigma) in the current position estimate.
+        std::optional<float> posU() const noexcept { return _view._decode<float>(5, 9); }
+        /// @brief The estimated uncertainty (1 Sigma) in the current velocity estimate.
+        std::optional<float> velU() const noexcept { return _view._decode<float>(5, 10); }
+
+        const CompositeDataView& _view;
+    };
+
+    struct Gnss2Group
+    {
+        /// @brief The current UTC time.  The year is given as a signed byte year offset from the year 2000.  For example the year 2013 would be given as year 13.
+        std::optional<TimeUtc> gnss2TimeUtc() const noexcept { return _view._decode<TimeUtc>(6, 0); }
+        /// @brief The GPS time of week given in nano seconds.
+        std::optional<Time> gps2Tow() const noexcept { return _view._decode<Time>(6, 1); }
+        /// @brief The current GPS week.
+        std::optional<uint16_t> gps2Week() const noexcept { return _view._decode<uint16_t>(6, 2); }
+        /// @brief The number of tracked GNSS satellites.
+        std::optional<uint8_t> gnss2NumSats() const noexcept { return _view._decode<uint8_t>(6, 3); }
+        /// @brief The current GNSS fix.
+        std::optional<uint8_t> gnss2Fix() const noexcept { return _view._decode<uint8_t>(6, 4); }
+        /// @brief The current GNSS position measurement given as the geodetic latitude, longitude and altitude above the ellipsoid.
+        std::optional<Lla> gnss2PosLla() const noexcept { return _view._decode<Lla>(6, 5); }
+        /// @brief The current GNSS position given in the Earth centered Earth fixed (ECEF) reference frame.
+        std::optional<Vec3d> gnss2PosEcef() const noexcept { return _view._decode<Vec3d>(6, 6); }
+        /// @brief The current GNSS velocity in the North East Down (NED) reference frame.
+        std::optional<Vec3f> gnss2VelNed() const noexcept { return _view._decode<Vec3f>(6, 7); }
+        /// @brief The current GNSS velocity in the Earth centered Earth fixed (ECEF) reference frame.
+        std::optional<Vec3f> gnss2VelEcef() const noexcept { return _view._decode<Vec3f>(6, 8); }
+        /// @brief The current GNSS position uncertainty in the North East Down (NED) reference frame.
+        std::optional<Vec3f> gnss2PosUncertainty() const noexcept { return _view._decode<Vec3f>(6, 9); }
+        /// @brief The current GNSS velocity uncertainty.
+        std::optional<float> gnss2VelUncertainty() const noexcept { return _view._decode<float>(6, 10); }
+        /// @brief The current GPS time uncertainty.
+        std::optional<float> gnss2TimeUncertainty() const noexcept { return _view._decode<float>(6, 11); }
+        /// @brief Flags for valid GPS TOW, week number and UTC and current leap seconds.
+        std::optional<GnssTimeInfo> gnss2TimeInfo() const noexcept { return _view._decode<GnssTimeInfo>(6, 12); }
+        /// @brief Dilution of precision.
+        std::optional<GnssDop> gnss2Dop() const noexcept { return _view._decode<GnssDop>(6, 13); }
+        /// @brief Information and measurements pertaining to each GNSS satellite in view.
+        std::optional<GnssSatInfo> gnss2SatInfo() const noexcept { return _view._decode<GnssSatInfo>(6, 14); }
+        /// @brief Raw measurements pertaining to each GNSS satellite in view.
+        std::optional<GnssRawMeas> gnss2RawMeas() const noexcept { return _view._decode<GnssRawMeas>(6, 16); }
+        /// @brief GNSS Status info flags.
+        std::optional<GnssStatus> gnss2Status() const noexcept { return _view._decode<GnssStatus>(6, 17); }
+        /// @brief Altitude (Mean Sea Level).
+        std::optional<double> gnss2AltMSL() const noexcept { return _view._decode<double>(6, 18); }
+
+        const CompositeDataView& _view;
+    };
+
+    struct Gnss3Group
+    {
+        /// @brief The current UTC time.  The year is given as a signed byte year offset from the year 2000.  For example the year 2013 would be given as year 13.
+        std::optional<TimeUtc> gnss3TimeUtc() const noexcept { return _view._decode<TimeUtc>(12, 0); }
+        /// @brief The GPS time of week given in nano seconds.
+        std::optional<Time> gps3Tow() const noexcept { return _view._decode<Time>(12, 1); }
+        /// @brief The current GPS week.
+        std::optional<uint16_t> gps3Week() const noexcept { return _view._decode<uint16_t>(12, 2); }
+        /// @brief The number of tracked GNSS satellites.
+        std::optional<uint8_t> gnss3NumSats() const noexcept { return _view._decode<uint8_t>(12, 3); }
+        /// @brief The current GNSS fix.
+        std::optional<uint8_t> gnss3Fix() const noexcept { return _view._decode<uint8_t>(12, 4); }
+        /// @brief The current GNSS position measurement given as the geodetic latitude, longitude and altitude above the ellipsoid.
+        std::optional<Lla> gnss3PosLla() const noexcept { return _view._decode<Lla>(12, 5); }
+        /// @brief The current GNSS position given in the Earth centered Earth fixed (ECEF) reference frame.
+        std::optional<Vec3d> gnss3PosEcef() const noexcept { return _view._decode<Vec3d>(12, 6); }
+        /// @brief The current GNSS velocity in the North East Down (NED) reference frame.
+        std::optional<Vec3f> gnss3VelNed() const noexcept { return _view._decode<Vec3f>(12, 7); }
+        /// @brief The current GNSS velocity in the Earth centered Earth fixed (ECEF) reference frame.
+        std::optional<Vec3f> gnss3VelEcef() const noexcept { return _view._decode<Vec3f>(12, 8); }
+        /// @brief The current GNSS position uncertainty in the North East Down (NED) reference frame.
+        std::optional<Vec3f> gnss3PosUncertainty() const noexcept { return _view._decode<Vec3f>(12, 9); }
+        /// @brief The current GNSS velocity uncertainty.
+        std::optional<float> gnss3VelUncertainty() const noexcept { return _view._decode<float>(12, 10); }
+        /// @brief The current GPS time uncertainty.
+        std::optional<float> gnss3TimeUncertainty() const noexcept { return _view._decode<float>(12, 11); }
+        /// @brief Flags for valid GPS TOW, week number and UTC and current leap seconds.
+        std::optional<GnssTimeInfo> gnss3TimeInfo() const noexcept { return _view._decode<GnssTimeInfo>(12, 12); }
+        /// @brief Dilution of precision.
+        std::optional<GnssDop> gnss3Dop() const noexcept { return _view._decode<GnssDop>(12, 13); }
+        /// @brief Information and measurements pertaining to each GNSS satellite in view.
+        std::optional<GnssSatInfo> gnss3SatInfo() const noexcept { return _view._decode<GnssSatInfo>(12, 14); }
+        /// @brief Raw measurements pertaining to each GNSS satellite in view.
+        std::optional<GnssRawMeas> gnss3RawMeas() const noexcept { return _view._decode<GnssRawMeas>(12, 16); }
+        /// @brief GNSS Status info flags.
+        std::optional<GnssStatus> gnss3Status() const noexcept { return _view._decode<GnssStatus>(12, 17); }
+        /// @brief Altitude (Mean Sea Level).
+        std::optional<double> gnss3AltMSL() const noexcept { return _view._decode<double>(12, 18); }
+
+        const CompositeDataView& _view;
+    };
+
+    TimeGroup time() const noexcept { return {*this}; }
+    ImuGroup imu() const noexcept { return {*this}; }
+    GnssGroup gnss() const noexcept { return {*this}; }
+    AttitudeGroup attitude() const noexcept { return {*this}; }
+    InsGroup ins() const noexcept { return {*this}; }
+    Gnss2Group gnss2() const noexcept { return {*this}; }
+    Gnss3Group gnss3() const noexcept { return {*this}; }
+
+private:
+    friend class CompactCompositeData;  // Shares the GNSS SatInfo and RawMeas decoding.
+
+    const uint8_t* _packet;
+    OffsetTable& _offsetTable;
+    bool _isValid = false;
+
+    template <class T>
+    std::optional<T> _decode(const uint8_t group, const uint8_t field) const noexcept
+    {
+        if (!_isValid) { return std::nullopt; }
+        const auto offset = _offsetTable.offset(group, field);
+        if (!offset.has_value()) { return std::nullopt; }
+        T retVal;
+        _copy(_packet + *offset, retVal);
+        return retVal;
+    }
+
+    template <class T>
+    static void _copy(const uint8_t* data, T& value) noexcept
+    {
+        std::memcpy(reinterpret_cast<uint8_t*>(&value), data, sizeof(T));
+    }
+
+    static void _copy(const uint8_t* data, GnssSatInfo& satInfo) noexcept;
+    static void _copy(const uint8_t* data, GnssRawMeas& rawMeas) noexcept;
+};
+
+inline void CompositeDataView::_copy(const uint8_t* data, GnssSatInfo& satInfo) noexcept
+{
+    satInfo.numSats = *data++;
+    satInfo.resv = *data++;
+    for (size_t i = 0; i < satInfo.numSats; ++i)
+    {
+        satInfo.sys[i] = *data++;
+        satInfo.svId[i] = *data++;
+        satInfo.flags[i] = *data++;
+        satInfo.cno[i] = *data++;
+        satInfo.qi[i] = *data++;
+        satInfo.el[i] = static_cast<int8_t>(*data++);
+        std::memcpy(&satInfo.az[i], data, sizeof(int16_t));
+        data += sizeof(int16_t);
+    }
+}
+
+inline void CompositeDataView::_copy(const uint8_t* data, GnssRawMeas& rawMeas) noexcept
+{
+    std::memcpy(&rawMeas.tow, data, sizeof(rawMeas.tow));
+    data += sizeof(rawMeas.tow);
+    std::memcpy(&rawMeas.week, data, sizeof(rawMeas.week));
+    data += sizeof(rawMeas.week);
+    rawMeas.numMeas = *data++;
+    rawMeas.resv = *data++;
+    for (size_t i = 0; i < rawMeas.numMeas; ++i)
+    {
+        rawMeas.sys[i] = *data++;
+        rawMeas.svId[i] = *data++;
+        rawMeas.band[i] = *data++;
+        rawMeas.chan[i] = *data++;
+        rawMeas.freqNum[i] = static_cast<int8_t>(*data++);
+        rawMeas.cno[i] = *data++;
+        std::memcpy(&rawMeas.flags[i], data, sizeof(uint16_t));
+        data += sizeof(uint16_t);
+        std::memcpy(&rawMeas.pr[i], data, sizeof(double));
+        data += sizeof(double);
+        std::memcpy(&rawMeas.cp[i], data, sizeof(double));
+        data += sizeof(double);
+        std::memcpy(&rawMeas.dp[i], data, sizeof(float));
+        data += sizeof(float);
+    }
+}
+
+inline bool CompositeDataView::OffsetTable::_build(const uint8_t* packet, const FaPacketProtocol::Metadata& metadata) noexcept
+{
+    _offsets.fill(0);
+    _header = metadata.header;
+    _length = metadata.length;
+    _isPopulated = false;
+    _hasDynamicFields = false;
+
+    const size_t payloadEnd = metadata.length - 2;  // Excludes crc
+    size_t offset = 1 + _header.size();
+    BinaryHeaderIterator iter(_header);
+    while (iter.next())
+    {
+        const uint8_t group = iter.group();
+        const uint8_t field = iter.field();
+
+        size_t fieldSize = 0;
+        const bool isGnssGroup = (group == 3 || group == 6 || group == 12);
+        if (isGnssGroup && field == 14)
+        {  // Is Sat Info
+            if (offset + 1 > payloadEnd) { return true; }
+            const uint8_t numSats = packet[offset];
+            if (numSats > Config::PacketFinders::gnssSatInfoMaxCount) { return true; }
+            fieldSize = 2 + 8 * numSats;
+            _hasDynamicFields = true;
+        }
+        else if (isGnssGroup && field == 16)
+        {  // Is Raw Meas
+            if (offset + 11 > payloadEnd) { return true; }
+            const uint8_t numMeas = packet[offset + 10];
+            if (numMeas > Config::PacketFinders::gnssRawMeasMaxCount) { return true; }
+            fieldSize = 12 + 28 * numMeas;
+            _hasDynamicFields = true;
+        }
+        else
+        {
+            const auto staticSize = getStaticBinaryTypeSize(group, field);
+            if (!staticSize.has_value()) { return true; }
+            fieldSize = staticSize.value();
+        }
+        if (offset + fieldSize > payloadEnd) { return true; }
+
+        if (group == 0)
+        {  // Common group fields are a concatenation of one or more measurements from their native groups
+            size_t subOffset = offset;
+            for (const auto& mapping : CommonGroupMapping.at(field))
+            {
+                _set(mapping.measGroupIndex, mapping.measTypeIndex, subOffset);
+                subOffset += getStaticBinaryTypeSize(mapping.measGroupIndex, mapping.measTypeIndex).value_or(0);
+            }
+        }
+        else { _set(group, field, offset); }
+        offset += fieldSize;
+    }
+
+    if (offset != payloadEnd) { return true; }
+    _isPopulated = true;
+    return false;
+}
+
+inline std::optional<CompositeData> CompositeDataView::toCompositeData(const EnabledMeasurements& measurementsToParse) const noexcept
+{
+    if (!_isValid) { return std::nullopt; }
+    FaPacketProtocol::Metadata metadata{_offsetTable.header(), _offsetTable.length(), timestamp};
+    const ByteBuffer buffer(const_cast<uint8_t*>(_packet), metadata.length, metadata.length);
+    auto compositeData = FaPacketProtocol::parsePacket(buffer, 0, metadata, measurementsToParse);
+    if (compositeData.has_value()) { compositeData->timestamp = timestamp; }
+    return compositeData;
+}
+
+}  // namespace VN
+
+#endif  // INTERFACE_COMPOSITEDATAVIEW_HPP
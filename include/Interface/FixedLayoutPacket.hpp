@@ -0,0 +1,269 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef INTERFACE_FIXEDLAYOUTPACKET_HPP
+#define INTERFACE_FIXEDLAYOUTPACKET_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include "HAL/Timer.hpp"
+#include "Implementation/BinaryHeader.hpp"
+#include "Implementation/BinaryMeasurementDefinitions.hpp"
+#include "Implementation/CoreUtils.hpp"
+#include "Implementation/FaPacketDispatcher.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+#include "TemplateLibrary/DirectAccessQueue.hpp"
+
+namespace VN
+{
+
+/// @brief A binary output configuration known at compile time, as it is configured on the sensor. Each member is the bitfield of enabled types for its
+/// output group, using the same bits as BinaryOutputMeasurements (e.g. COMMON_YPR_BIT). Must be declared constexpr with static storage duration to be used
+/// as a FixedLayoutPacket template argument.
+struct FixedLayoutSpec
+{
+    uint32_t common = 0;
+    uint32_t time = 0;
+    uint32_t imu = 0;
+    uint32_t gnss = 0;
+    uint32_t attitude = 0;
+    uint32_t ins = 0;
+    uint32_t gnss2 = 0;
+    uint32_t gnss3 = 0;
+};
+
+namespace FixedLayout
+{
+
+constexpr uint8_t numGroups = 13;
+constexpr uint8_t numFieldsPerGroup = 32;
+constexpr uint8_t headerMaxLength = 1 + 2 + 8 * 4;  // Sync byte, two group bytes, and two type words per group
+
+struct Layout
+{
+    std::array<uint8_t, headerMaxLength> header{};
+    uint8_t headerLength = 0;
+    std::array<uint16_t, numGroups * numFieldsPerGroup> offsets{};  // From the sync byte. 0 if the measurement is not output.
+    uint16_t length = 0;                                             // Including sync byte and crc
+    bool isFixed = true;                                             // False if a field has no static size (e.g. GNSS SatInfo or RawMeas)
+};
+
+/// @brief Computes the header bytes, field offsets and packet length the sensor will produce for the passed spec.
+constexpr Layout computeLayout(const FixedLayoutSpec& spec) noexcept
+{
+    Layout retVal;
+    const std::array<uint32_t, 8> groupTypes = {spec.common, spec.time, spec.imu, spec.gnss, spec.attitude, spec.ins, spec.gnss2, spec.gnss3};
+    const std::array<uint8_t, 8> groupIndices = {0, 1, 2, 3, 4, 5, 6, 12};
+
+    uint8_t headerIndex = 0;
+    retVal.header[headerIndex++] = 0xFA;
+    uint8_t groupByte = 0;
+    for (uint8_t i = 0; i < 7; ++i)
+    {
+        if (groupTypes[i] != 0) { groupByte |= (1 << i); }
+    }
+    if (spec.gnss3 != 0)
+    {
+        retVal.header[headerIndex++] = groupByte | 0x80;
+        retVal.header[headerIndex++] = (1 << (12 - 8));
+    }
+    else { retVal.header[headerIndex++] = groupByte; }
+
+    for (uint8_t i = 0; i < groupTypes.size(); ++i)
+    {
+        const uint32_t types = groupTypes[i];
+        if (types == 0) { continue; }
+        const uint16_t lowWord = (types & 0x7FFF) | (((types >> 16) != 0) ? 0x8000 : 0);
+        retVal.header[headerIndex++] = lowWord & 0xFF;
+        retVal.header[headerIndex++] = lowWord >> 8;
+        if ((types >> 16) != 0)
+        {
+            const uint16_t highWord = (types >> 16) & 0x7FFF;
+            retVal.header[headerIndex++] = highWord & 0xFF;
+            retVal.header[headerIndex++] = highWord >> 8;
+        }
+    }
+    retVal.headerLength = headerIndex;
+
+    uint16_t offset = headerIndex;
+    for (uint8_t i = 0; i < groupTypes.size(); ++i)
+    {
+        for (uint8_t field = 0; field < numFieldsPerGroup; ++field)
+        {
+            if ((field % 16) == 15) { continue; }  // Extension bit
+            if (!(groupTypes[i] & (uint32_t(1) << field))) { continue; }
+            const auto size = getStaticBinaryTypeSize(groupIndices[i], field);
+            if (!size.has_value())
+            {
+                retVal.isFixed = false;
+                return retVal;
+            }
+            retVal.offsets[groupIndices[i] * numFieldsPerGroup + field] = offset;
+            offset += *size;
+        }
+    }
+    retVal.length = offset + 2;
+    return retVal;
+}
+
+}  // namespace FixedLayout
+
+/// @brief An FA packet whose binary output configuration is fixed at compile time.
+/// The header bytes, field offsets and length are computed from the spec at compile time, so recognizing a packet is a byte comparison against the expected
+/// header and each accessor is a single copy from a fixed offset. Measurements are addressed by their output group and field, as configured in the spec;
+/// a Common group field is read as its whole payload. Use with FixedLayoutFastPath to receive such packets from a Sensor without generic parsing.
+template <const FixedLayoutSpec& Spec>
+class FixedLayoutPacket
+{
+    static constexpr FixedLayout::Layout _layout = FixedLayout::computeLayout(Spec);
+    static_assert(_layout.isFixed, "FixedLayoutPacket requires every enabled measurement to have a static size.");
+    static_assert(_layout.headerLength > 2, "FixedLayoutPacket requires at least one enabled measurement.");
+
+public:
+    static constexpr uint8_t headerLength = _layout.headerLength;
+    static constexpr uint16_t length = _layout.length;
+
+    /// @brief Gets the offset of a measurement from the sync byte, or 0 if it is not in the spec.
+    static constexpr uint16_t offsetOf(const uint8_t group, const uint8_t field) noexcept
+    {
+        return _layout.offsets[group * FixedLayout::numFieldsPerGroup + field];
+    }
+
+    /// @brief Whether the bytes starting at the sync byte begin with the header this spec produces.
+    static bool matchesHeader(const uint8_t* packet) noexcept { return std::memcmp(packet, _layout.header.data(), headerLength) == 0; }
+
+    /// @brief Whether the buffered bytes starting at syncByteIndex begin with the header this spec produces. At least headerLength bytes must be available.
+    static bool matchesHeader(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
+    {
+        for (uint8_t i = 0; i < headerLength; ++i)
+        {
+            if (byteBuffer.peek_unchecked(syncByteIndex + i) != _layout.header[i]) { return false; }
+        }
+        return true;
+    }
+
+    /// @brief Builds the BinaryHeader this spec produces, e.g. to subscribe to or compare against other messages.
+    static BinaryHeader binaryHeader() noexcept
+    {
+        BinaryHeader retVal;
+        uint8_t index = 1;
+        do {
+            retVal.outputGroups.push_back(_layout.header[index]);
+        } while (_layout.header[index++] & 0x80);
+        for (; index < headerLength; index += 2) { retVal.outputTypes.push_back(_layout.header[index] | (_layout.header[index + 1] << 8)); }
+        return retVal;
+    }
+
+    /// @brief Copies a complete packet out of the buffer.
+    /// @return True if the packet does not match the spec or fails its crc.
+    bool populate(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const time_point packetTimestamp) noexcept
+    {
+        byteBuffer.peek_unchecked(_bytes.data(), length, syncByteIndex);
+        timestamp = packetTimestamp;
+        return !matchesHeader(_bytes.data()) || !isValidCrc();
+    }
+
+    /// @brief Copies a complete linear packet, starting at its sync byte.
+    /// @return True if the packet does not match the spec or fails its crc.
+    bool populate(const uint8_t* packet, const time_point packetTimestamp) noexcept
+    {
+        std::memcpy(_bytes.data(), packet, length);
+        timestamp = packetTimestamp;
+        return !matchesHeader(_bytes.data()) || !isValidCrc();
+    }
+
+    /// @brief Copies a complete packet out of the buffer, which the caller has already checked against the spec.
+    void populate_unchecked(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const time_point packetTimestamp) noexcept
+    {
+        byteBuffer.peek_unchecked(_bytes.data(), length, syncByteIndex);
+        timestamp = packetTimestamp;
+    }
+
+    bool isValidCrc() const noexcept
+    {
+        uint16_t crc = 0;
+        for (uint16_t i = 1; i < length; ++i) { _calculateCRC(&crc, _bytes[i]); }
+        return crc == 0;
+    }
+
+    /// @brief Reads the measurement at its fixed offset. T must match the measurement's binary size, e.g. Ypr for (Attitude, Ypr).
+    template <class T, uint8_t Group, uint8_t Field>
+    T get() const noexcept
+    {
+        static_assert(Group < FixedLayout::numGroups && Field < FixedLayout::numFieldsPerGroup, "Invalid binary group or field.");
+        constexpr uint16_t offset = offsetOf(Group, Field);
+        static_assert(offset != 0, "The measurement is not enabled in the spec.");
+        static_assert(sizeof(T) == *getStaticBinaryTypeSize(Group, Field), "The requested type does not match the size of the measurement.");
+        T retVal;
+        std::memcpy(reinterpret_cast<uint8_t*>(&retVal), _bytes.data() + offset, sizeof(T));
+        return retVal;
+    }
+
+    const uint8_t* data() const noexcept { return _bytes.data(); }
+
+    time_point timestamp;
+
+private:
+    std::array<uint8_t, length> _bytes{};
+};
+
+/// @brief Plugs a FixedLayoutPacket into an FaPacketDispatcher (see Sensor::registerFastPath). Packets matching the spec are copied into the passed queue
+/// rather than being parsed into the measurement queue; all other FA packets take the generic path.
+template <const FixedLayoutSpec& Spec>
+class FixedLayoutFastPath : public FaPacketDispatcher::FastPath
+{
+public:
+    using Packet = FixedLayoutPacket<Spec>;
+    using Queue = DirectAccessQueue_Interface<Packet>;
+
+    FixedLayoutFastPath(Queue* queue) noexcept : _queue(queue), _header(Packet::binaryHeader()) {}
+
+    bool matches(const ByteBuffer& byteBuffer, const size_t syncByteIndex) const noexcept override
+    {
+        if (!Packet::matchesHeader(byteBuffer, syncByteIndex)) { return false; }
+        uint16_t crc = 0;
+        for (size_t i = syncByteIndex + 1; i < syncByteIndex + Packet::length; ++i) { _calculateCRC(&crc, byteBuffer.peek_unchecked(i)); }
+        return crc == 0;
+    }
+
+    bool dispatch(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const time_point timestamp) noexcept override
+    {
+        auto putSlot = _queue->put();
+        if (!putSlot) { return true; }
+        putSlot->populate_unchecked(byteBuffer, syncByteIndex, timestamp);  // Header and crc were checked in matches
+        return false;
+    }
+
+    size_t length() const noexcept override { return Packet::length; }
+    const BinaryHeader& header() const noexcept override { return _header; }
+
+private:
+    Queue* _queue;
+    BinaryHeader _header;
+};
+
+}  // namespace VN
+
+#endif  // INTERFACE_FIXEDLAYOUTPACKET_HPP
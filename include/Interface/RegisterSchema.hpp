@@ -0,0 +1,200 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef INTERFACE_REGISTERSCHEMA_HPP
+#define INTERFACE_REGISTERSCHEMA_HPP
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "Config.hpp"
+#include "Interface/Command.hpp"
+#include "TemplateLibrary/Vector.hpp"
+
+namespace VN
+{
+namespace Registers
+{
+
+/// @brief Returns pointers to the characters delimiting each ASCII field of a register response (or of a bare, comma-separated parameter string).
+Vector<const char*, Config::PacketFinders::asciiMaxFieldCount> findIndexOfFieldSeparators(const AsciiMessage& input);
+
+namespace Schema
+{
+
+/// @brief How a register field is represented in ASCII. Decimal kinds are named for the type the field is parsed as, which may differ from the
+/// type of the member that stores it (e.g. an enum or a bitfield struct).
+enum class FieldKind : uint8_t
+{
+    Float,
+    Double,
+    Uint8,
+    Uint16,
+    Uint32,
+    Int32,
+    Hex8,
+    Hex16,
+    Hex32,
+    Text
+};
+
+/// @brief The inclusive range of values accepted when parsing an integer field. Any value of the parsed type, unless narrowed by enumeration().
+struct FieldRange
+{
+    int64_t min = std::numeric_limits<int64_t>::min();
+    int64_t max = std::numeric_limits<int64_t>::max();
+};
+
+/// @brief One entry of a register's schema: how a field is encoded and which member holds it.
+template <class RegisterType, class MemberType>
+struct Field
+{
+    FieldKind kind;
+    MemberType RegisterType::*member;
+    double scale = 1.0;  // Float and Double only: the member holds the ASCII value multiplied by scale
+    FieldRange range{};  // Integer kinds only
+};
+
+/// @brief A schema field bound to a register instance, so that a single non-template routine can parse or format any register.
+struct FieldRef
+{
+    FieldKind kind;
+    void* value;
+    double scale;
+    FieldRange range;
+};
+
+struct ConstFieldRef
+{
+    FieldKind kind;
+    const void* value;
+    double scale;
+};
+
+template <class T>
+constexpr FieldKind _decimalKind() noexcept
+{
+    if constexpr (std::is_same_v<T, float>) { return FieldKind::Float; }
+    else if constexpr (std::is_same_v<T, double>) { return FieldKind::Double; }
+    else if constexpr (std::is_same_v<T, uint8_t>) { return FieldKind::Uint8; }
+    else if constexpr (std::is_same_v<T, uint16_t>) { return FieldKind::Uint16; }
+    else if constexpr (std::is_same_v<T, uint32_t>) { return FieldKind::Uint32; }
+    else
+    {
+        static_assert(std::is_same_v<T, int32_t>, "Unsupported decimal register field type.");
+        return FieldKind::Int32;
+    }
+}
+
+template <class T>
+constexpr FieldKind _hexKind() noexcept
+{
+    if constexpr (std::is_same_v<T, uint8_t>) { return FieldKind::Hex8; }
+    else if constexpr (std::is_same_v<T, uint16_t>) { return FieldKind::Hex16; }
+    else
+    {
+        static_assert(std::is_same_v<T, uint32_t>, "Unsupported hexadecimal register field type.");
+        return FieldKind::Hex32;
+    }
+}
+
+/// @brief A field written in decimal and parsed as T. The member is stored with T's object representation, so it may be T itself, an enum over T,
+/// or a bitfield struct of the same size.
+template <class T, class RegisterType, class MemberType>
+constexpr Field<RegisterType, MemberType> decimal(MemberType RegisterType::*member) noexcept
+{
+    static_assert(sizeof(MemberType) == sizeof(T) && std::is_trivially_copyable_v<MemberType>, "Register member must share the parsed type's representation.");
+    return {_decimalKind<T>(), member};
+}
+
+/// @brief A field written in hexadecimal and parsed as T, with the same storage requirements as decimal().
+template <class T, class RegisterType, class MemberType>
+constexpr Field<RegisterType, MemberType> hex(MemberType RegisterType::*member) noexcept
+{
+    static_assert(sizeof(MemberType) == sizeof(T) && std::is_trivially_copyable_v<MemberType>, "Register member must share the parsed type's representation.");
+    return {_hexKind<T>(), member};
+}
+
+/// @brief A decimal field parsed as T and stored in an enum member. Values outside [minValue, maxValue] fail to parse rather than being stored as an
+/// enumerator the register does not define.
+template <class T, class RegisterType, class MemberType>
+constexpr Field<RegisterType, MemberType> enumeration(MemberType RegisterType::*member, const T minValue, const T maxValue) noexcept
+{
+    static_assert(std::is_enum_v<MemberType> && std::is_integral_v<T>, "enumeration() is for enum members parsed as an integer.");
+    Field<RegisterType, MemberType> retVal = decimal<T>(member);
+    retVal.range = FieldRange{minValue, maxValue};
+    return retVal;
+}
+
+/// @brief A floating-point field whose member holds the ASCII value multiplied by scale. Formatting divides it back out.
+template <class T, class RegisterType, class MemberType>
+constexpr Field<RegisterType, MemberType> scaled(MemberType RegisterType::*member, const double scale) noexcept
+{
+    static_assert(std::is_floating_point_v<T>, "scaled() is for Float and Double fields.");
+    Field<RegisterType, MemberType> retVal = decimal<T>(member);
+    retVal.scale = scale;
+    return retVal;
+}
+
+/// @brief A free-text field spanning a single token.
+template <class RegisterType>
+constexpr Field<RegisterType, AsciiMessage> text(AsciiMessage RegisterType::*member) noexcept
+{
+    return {FieldKind::Text, member};
+}
+
+/// @brief Parses the fields of an ASCII register response into the bound values, in order. The response must hold between numRequiredFields and
+/// numFields fields; any optional trailing fields that are absent are left untouched. Returns true on failure, including an integer outside its field's
+/// range, in which case the fields before the failing one have already been written.
+bool parseFields(const AsciiMessage& response, const FieldRef* fields, const size_t numFields, const size_t numRequiredFields) noexcept;
+
+/// @brief Formats the bound values as a comma-separated parameter string.
+AsciiMessage formatFields(const ConstFieldRef* fields, const size_t numFields) noexcept;
+
+template <class RegisterType, class... Fields>
+bool parse(const AsciiMessage& response, RegisterType& reg, const std::tuple<Fields...>& schema, const size_t numRequiredFields = sizeof...(Fields)) noexcept
+{
+    const std::array<FieldRef, sizeof...(Fields)> fields = std::apply(
+        [&reg](const auto&... field)
+        { return std::array<FieldRef, sizeof...(Fields)>{FieldRef{field.kind, &(reg.*field.member), field.scale, field.range}...}; },
+        schema);
+    return parseFields(response, fields.data(), fields.size(), numRequiredFields);
+}
+
+template <class RegisterType, class... Fields>
+AsciiMessage format(const RegisterType& reg, const std::tuple<Fields...>& schema) noexcept
+{
+    const std::array<ConstFieldRef, sizeof...(Fields)> fields = std::apply(
+        [&reg](const auto&... field) { return std::array<ConstFieldRef, sizeof...(Fields)>{ConstFieldRef{field.kind, &(reg.*field.member), field.scale}...}; },
+        schema);
+    return formatFields(fields.data(), fields.size());
+}
+
+}  // namespace Schema
+}  // namespace Registers
+}  // namespace VN
+
+#endif  // INTERFACE_REGISTERSCHEMA_HPP
@@ -0,0 +1,664 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef INTERFACE_REGISTERSCHEMAS_HPP
+#define INTERFACE_REGISTERSCHEMAS_HPP
+
+#include <cstdint>
+#include <tuple>
+
+#include "Interface/RegisterSchema.hpp"
+#include "Interface/Registers.hpp"
+
+// The schema of each register parsed and formatted by Schema::parse and Schema::format, in the order its fields appear in the ASCII response.
+// Enum fields are parsed with the range of their enumerators, so a value the register does not define fails to parse.
+
+namespace VN
+{
+    namespace Registers
+    {
+        namespace Attitude
+        {
+            inline constexpr auto yawPitchRollSchema = std::make_tuple(
+                Schema::decimal<float>(&YawPitchRoll::yaw),
+                Schema::decimal<float>(&YawPitchRoll::pitch),
+                Schema::decimal<float>(&YawPitchRoll::roll));
+            
+            inline constexpr auto quaternionSchema = std::make_tuple(
+                Schema::decimal<float>(&Quaternion::quatX),
+                Schema::decimal<float>(&Quaternion::quatY),
+                Schema::decimal<float>(&Quaternion::quatZ),
+                Schema::decimal<float>(&Quaternion::quatS));
+            
+            inline constexpr auto quatMagAccelRateSchema = std::make_tuple(
+                Schema::decimal<float>(&QuatMagAccelRate::quatX),
+                Schema::decimal<float>(&QuatMagAccelRate::quatY),
+                Schema::decimal<float>(&QuatMagAccelRate::quatZ),
+                Schema::decimal<float>(&QuatMagAccelRate::quatS),
+                Schema::decimal<float>(&QuatMagAccelRate::magX),
+                Schema::decimal<float>(&QuatMagAccelRate::magY),
+                Schema::decimal<float>(&QuatMagAccelRate::magZ),
+                Schema::decimal<float>(&QuatMagAccelRate::accelX),
+                Schema::decimal<float>(&QuatMagAccelRate::accelY),
+                Schema::decimal<float>(&QuatMagAccelRate::accelZ),
+                Schema::decimal<float>(&QuatMagAccelRate::gyroX),
+                Schema::decimal<float>(&QuatMagAccelRate::gyroY),
+                Schema::decimal<float>(&QuatMagAccelRate::gyroZ));
+            
+            inline constexpr auto magGravRefVecSchema = std::make_tuple(
+                Schema::decimal<float>(&MagGravRefVec::magRefN),
+                Schema::decimal<float>(&MagGravRefVec::magRefE),
+                Schema::decimal<float>(&MagGravRefVec::magRefD),
+                Schema::decimal<float>(&MagGravRefVec::gravRefN),
+                Schema::decimal<float>(&MagGravRefVec::gravRefE),
+                Schema::decimal<float>(&MagGravRefVec::gravRefD));
+            
+            inline constexpr auto yprMagAccelAngularRatesSchema = std::make_tuple(
+                Schema::decimal<float>(&YprMagAccelAngularRates::yaw),
+                Schema::decimal<float>(&YprMagAccelAngularRates::pitch),
+                Schema::decimal<float>(&YprMagAccelAngularRates::roll),
+                Schema::decimal<float>(&YprMagAccelAngularRates::magX),
+                Schema::decimal<float>(&YprMagAccelAngularRates::magY),
+                Schema::decimal<float>(&YprMagAccelAngularRates::magZ),
+                Schema::decimal<float>(&YprMagAccelAngularRates::accelX),
+                Schema::decimal<float>(&YprMagAccelAngularRates::accelY),
+                Schema::decimal<float>(&YprMagAccelAngularRates::accelZ),
+                Schema::decimal<float>(&YprMagAccelAngularRates::gyroX),
+                Schema::decimal<float>(&YprMagAccelAngularRates::gyroY),
+                Schema::decimal<float>(&YprMagAccelAngularRates::gyroZ));
+            
+            inline constexpr auto vpeBasicControlSchema = std::make_tuple(
+                Schema::decimal<uint8_t>(&VpeBasicControl::resv),
+                Schema::enumeration<uint8_t>(&VpeBasicControl::headingMode, 0, 2),
+                Schema::enumeration<uint8_t>(&VpeBasicControl::filteringMode, 0, 1),
+                Schema::enumeration<uint8_t>(&VpeBasicControl::tuningMode, 0, 1));
+            
+            inline constexpr auto vpeMagBasicTuningSchema = std::make_tuple(
+                Schema::decimal<float>(&VpeMagBasicTuning::baseTuningX),
+                Schema::decimal<float>(&VpeMagBasicTuning::baseTuningY),
+                Schema::decimal<float>(&VpeMagBasicTuning::baseTuningZ),
+                Schema::decimal<float>(&VpeMagBasicTuning::adaptiveTuningX),
+                Schema::decimal<float>(&VpeMagBasicTuning::adaptiveTuningY),
+                Schema::decimal<float>(&VpeMagBasicTuning::adaptiveTuningZ),
+                Schema::decimal<float>(&VpeMagBasicTuning::adaptiveFilteringX),
+                Schema::decimal<float>(&VpeMagBasicTuning::adaptiveFilteringY),
+                Schema::decimal<float>(&VpeMagBasicTuning::adaptiveFilteringZ));
+            
+            inline constexpr auto vpeAccelBasicTuningSchema = std::make_tuple(
+                Schema::decimal<float>(&VpeAccelBasicTuning::baseTuningX),
+                Schema::decimal<float>(&VpeAccelBasicTuning::baseTuningY),
+                Schema::decimal<float>(&VpeAccelBasicTuning::baseTuningZ),
+                Schema::decimal<float>(&VpeAccelBasicTuning::adaptiveTuningX),
+                Schema::decimal<float>(&VpeAccelBasicTuning::adaptiveTuningY),
+                Schema::decimal<float>(&VpeAccelBasicTuning::adaptiveTuningZ),
+                Schema::decimal<float>(&VpeAccelBasicTuning::adaptiveFilteringX),
+                Schema::decimal<float>(&VpeAccelBasicTuning::adaptiveFilteringY),
+                Schema::decimal<float>(&VpeAccelBasicTuning::adaptiveFilteringZ));
+            
+            inline constexpr auto yprLinearBodyAccelAngularRatesSchema = std::make_tuple(
+                Schema::decimal<float>(&YprLinearBodyAccelAngularRates::yaw),
+                Schema::decimal<float>(&YprLinearBodyAccelAngularRates::pitch),
+                Schema::decimal<float>(&YprLinearBodyAccelAngularRates::roll),
+                Schema::decimal<float>(&YprLinearBodyAccelAngularRates::linAccelX),
+                Schema::decimal<float>(&YprLinearBodyAccelAngularRates::linAccelY),
+                Schema::decimal<float>(&YprLinearBodyAccelAngularRates::linAccelZ),
+                Schema::decimal<float>(&YprLinearBodyAccelAngularRates::gyroX),
+                Schema::decimal<float>(&YprLinearBodyAccelAngularRates::gyroY),
+                Schema::decimal<float>(&YprLinearBodyAccelAngularRates::gyroZ));
+            
+            inline constexpr auto yprLinearInertialAccelAngularRatesSchema = std::make_tuple(
+                Schema::decimal<float>(&YprLinearInertialAccelAngularRates::yaw),
+                Schema::decimal<float>(&YprLinearInertialAccelAngularRates::pitch),
+                Schema::decimal<float>(&YprLinearInertialAccelAngularRates::roll),
+                Schema::decimal<float>(&YprLinearInertialAccelAngularRates::linAccelN),
+                Schema::decimal<float>(&YprLinearInertialAccelAngularRates::linAccelE),
+                Schema::decimal<float>(&YprLinearInertialAccelAngularRates::linAccelD),
+                Schema::decimal<float>(&YprLinearInertialAccelAngularRates::gyroX),
+                Schema::decimal<float>(&YprLinearInertialAccelAngularRates::gyroY),
+                Schema::decimal<float>(&YprLinearInertialAccelAngularRates::gyroZ));
+            
+        } // namespace Attitude
+        
+        namespace GNSS
+        {
+            inline constexpr auto gnssBasicConfigSchema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&GnssBasicConfig::receiverEnable, 0, 202),
+                Schema::enumeration<uint8_t>(&GnssBasicConfig::ppsSource, 0, 6),
+                Schema::enumeration<uint8_t>(&GnssBasicConfig::rate, 1, 5),
+                Schema::decimal<uint8_t>(&GnssBasicConfig::resv4),
+                Schema::enumeration<uint8_t>(&GnssBasicConfig::antPower, 0, 2));
+            
+            inline constexpr auto gnssAOffsetSchema = std::make_tuple(
+                Schema::decimal<float>(&GnssAOffset::positionX),
+                Schema::decimal<float>(&GnssAOffset::positionY),
+                Schema::decimal<float>(&GnssAOffset::positionZ));
+            
+            inline constexpr auto gnssSolLlaSchema = std::make_tuple(
+                Schema::decimal<double>(&GnssSolLla::gps1Tow),
+                Schema::decimal<uint16_t>(&GnssSolLla::gps1Week),
+                Schema::enumeration<uint8_t>(&GnssSolLla::gnss1Fix, 0, 8),
+                Schema::decimal<uint8_t>(&GnssSolLla::gnss1NumSats),
+                Schema::decimal<double>(&GnssSolLla::lat),
+                Schema::decimal<double>(&GnssSolLla::lon),
+                Schema::decimal<double>(&GnssSolLla::alt),
+                Schema::decimal<float>(&GnssSolLla::velN),
+                Schema::decimal<float>(&GnssSolLla::velE),
+                Schema::decimal<float>(&GnssSolLla::velD),
+                Schema::decimal<float>(&GnssSolLla::posUncertaintyN),
+                Schema::decimal<float>(&GnssSolLla::posUncertaintyE),
+                Schema::decimal<float>(&GnssSolLla::posUncertaintyD),
+                Schema::decimal<float>(&GnssSolLla::gnss1VelUncertainty),
+                Schema::decimal<float>(&GnssSolLla::gnss1TimeUncertainty));
+            
+            inline constexpr auto gnssSolEcefSchema = std::make_tuple(
+                Schema::decimal<double>(&GnssSolEcef::gps1Tow),
+                Schema::decimal<uint16_t>(&GnssSolEcef::gps1Week),
+                Schema::enumeration<uint8_t>(&GnssSolEcef::gnss1Fix, 0, 8),
+                Schema::decimal<uint8_t>(&GnssSolEcef::gnss1NumSats),
+                Schema::decimal<double>(&GnssSolEcef::posX),
+                Schema::decimal<double>(&GnssSolEcef::posY),
+                Schema::decimal<double>(&GnssSolEcef::posZ),
+                Schema::decimal<float>(&GnssSolEcef::velX),
+                Schema::decimal<float>(&GnssSolEcef::velY),
+                Schema::decimal<float>(&GnssSolEcef::velZ),
+                Schema::decimal<float>(&GnssSolEcef::posUncertaintyX),
+                Schema::decimal<float>(&GnssSolEcef::posUncertaintyY),
+                Schema::decimal<float>(&GnssSolEcef::posUncertaintyZ),
+                Schema::decimal<float>(&GnssSolEcef::gnss1VelUncertainty),
+                Schema::decimal<float>(&GnssSolEcef::gnss1TimeUncertainty));
+            
+            inline constexpr auto gnssSystemConfigSchema = std::make_tuple(
+                Schema::hex<uint16_t>(&GnssSystemConfig::systems),
+                Schema::decimal<uint8_t>(&GnssSystemConfig::minCno),
+                Schema::decimal<uint8_t>(&GnssSystemConfig::minElev),
+                Schema::decimal<uint8_t>(&GnssSystemConfig::maxSats),
+                Schema::hex<uint8_t>(&GnssSystemConfig::sbasMode),
+                Schema::hex<uint16_t>(&GnssSystemConfig::sbasSelect1),
+                Schema::hex<uint16_t>(&GnssSystemConfig::sbasSelect2),
+                Schema::hex<uint16_t>(&GnssSystemConfig::sbasSelect3),
+                Schema::enumeration<uint8_t>(&GnssSystemConfig::receiverSelect, 0, 2));
+            
+            inline constexpr auto gnssSyncConfigSchema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&GnssSyncConfig::gnssSyncEnable, 0, 2),
+                Schema::enumeration<uint8_t>(&GnssSyncConfig::polarity, 0, 1),
+                Schema::enumeration<uint8_t>(&GnssSyncConfig::specType, 0, 1),
+                Schema::decimal<uint8_t>(&GnssSyncConfig::resv),
+                Schema::decimal<uint32_t>(&GnssSyncConfig::period),
+                Schema::decimal<uint32_t>(&GnssSyncConfig::pulseWidth),
+                Schema::decimal<int32_t>(&GnssSyncConfig::offset));
+            
+            inline constexpr auto gnss2SolLlaSchema = std::make_tuple(
+                Schema::decimal<double>(&Gnss2SolLla::gps2Tow),
+                Schema::decimal<uint16_t>(&Gnss2SolLla::gps2Week),
+                Schema::enumeration<uint8_t>(&Gnss2SolLla::gnss2Fix, 0, 8),
+                Schema::decimal<uint8_t>(&Gnss2SolLla::gnss2NumSats),
+                Schema::decimal<double>(&Gnss2SolLla::lat),
+                Schema::decimal<double>(&Gnss2SolLla::lon),
+                Schema::decimal<double>(&Gnss2SolLla::alt),
+                Schema::decimal<float>(&Gnss2SolLla::velN),
+                Schema::decimal<float>(&Gnss2SolLla::velE),
+                Schema::decimal<float>(&Gnss2SolLla::velD),
+                Schema::decimal<float>(&Gnss2SolLla::posUncertaintyN),
+                Schema::decimal<float>(&Gnss2SolLla::posUncertaintyE),
+                Schema::decimal<float>(&Gnss2SolLla::posUncertaintyD),
+                Schema::decimal<float>(&Gnss2SolLla::gnss2VelUncertainty),
+                Schema::decimal<float>(&Gnss2SolLla::gnss2TimeUncertainty));
+            
+            inline constexpr auto gnss2SolEcefSchema = std::make_tuple(
+                Schema::decimal<double>(&Gnss2SolEcef::gps2Tow),
+                Schema::decimal<uint16_t>(&Gnss2SolEcef::gps2Week),
+                Schema::enumeration<uint8_t>(&Gnss2SolEcef::gnss2Fix, 0, 8),
+                Schema::decimal<uint8_t>(&Gnss2SolEcef::gnss2NumSats),
+                Schema::decimal<double>(&Gnss2SolEcef::posX),
+                Schema::decimal<double>(&Gnss2SolEcef::posY),
+                Schema::decimal<double>(&Gnss2SolEcef::posZ),
+                Schema::decimal<float>(&Gnss2SolEcef::velX),
+                Schema::decimal<float>(&Gnss2SolEcef::velY),
+                Schema::decimal<float>(&Gnss2SolEcef::velZ),
+                Schema::decimal<float>(&Gnss2SolEcef::posUncertaintyX),
+                Schema::decimal<float>(&Gnss2SolEcef::posUncertaintyY),
+                Schema::decimal<float>(&Gnss2SolEcef::posUncertaintyZ),
+                Schema::decimal<float>(&Gnss2SolEcef::gnss2VelUncertainty),
+                Schema::decimal<float>(&Gnss2SolEcef::gnss2TimeUncertainty));
+            
+            inline constexpr auto extGnssOffsetSchema = std::make_tuple(
+                Schema::decimal<float>(&ExtGnssOffset::positionX),
+                Schema::decimal<float>(&ExtGnssOffset::positionY),
+                Schema::decimal<float>(&ExtGnssOffset::positionZ));
+            
+        } // namespace GNSS
+        
+        namespace GNSSCompass
+        {
+            inline constexpr auto gnssCompassSignalHealthStatusSchema = std::make_tuple(
+                Schema::decimal<float>(&GnssCompassSignalHealthStatus::numSatsPvtA),
+                Schema::decimal<float>(&GnssCompassSignalHealthStatus::numSatsRtkA),
+                Schema::decimal<float>(&GnssCompassSignalHealthStatus::highestCn0A),
+                Schema::decimal<float>(&GnssCompassSignalHealthStatus::numSatsPvtB),
+                Schema::decimal<float>(&GnssCompassSignalHealthStatus::numSatsRtkB),
+                Schema::decimal<float>(&GnssCompassSignalHealthStatus::highestCn0B),
+                Schema::decimal<float>(&GnssCompassSignalHealthStatus::numComSatsPVT),
+                Schema::decimal<float>(&GnssCompassSignalHealthStatus::numComSatsRTK));
+            
+            inline constexpr auto gnssCompassBaselineSchema = std::make_tuple(
+                Schema::decimal<float>(&GnssCompassBaseline::positionX),
+                Schema::decimal<float>(&GnssCompassBaseline::positionY),
+                Schema::decimal<float>(&GnssCompassBaseline::positionZ),
+                Schema::decimal<float>(&GnssCompassBaseline::uncertaintyX),
+                Schema::decimal<float>(&GnssCompassBaseline::uncertaintyY),
+                Schema::decimal<float>(&GnssCompassBaseline::uncertaintyZ));
+            
+            inline constexpr auto gnssCompassEstBaselineSchema = std::make_tuple(
+                Schema::decimal<uint8_t>(&GnssCompassEstBaseline::estBaselineComplete),
+                Schema::decimal<uint8_t>(&GnssCompassEstBaseline::resv),
+                Schema::decimal<uint16_t>(&GnssCompassEstBaseline::numMeas),
+                Schema::decimal<float>(&GnssCompassEstBaseline::positionX),
+                Schema::decimal<float>(&GnssCompassEstBaseline::positionY),
+                Schema::decimal<float>(&GnssCompassEstBaseline::positionZ),
+                Schema::decimal<float>(&GnssCompassEstBaseline::uncertaintyX),
+                Schema::decimal<float>(&GnssCompassEstBaseline::uncertaintyY),
+                Schema::decimal<float>(&GnssCompassEstBaseline::uncertaintyZ));
+            
+            inline constexpr auto gnssCompassStartupStatusSchema = std::make_tuple(
+                Schema::decimal<uint8_t>(&GnssCompassStartupStatus::percentComplete),
+                Schema::decimal<float>(&GnssCompassStartupStatus::currentHeading));
+            
+        } // namespace GNSSCompass
+        
+        namespace HardSoftIronEstimator
+        {
+            inline constexpr auto realTimeHsiControlSchema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&RealTimeHsiControl::mode, 0, 2),
+                Schema::enumeration<uint8_t>(&RealTimeHsiControl::applyCompensation, 1, 3),
+                Schema::decimal<uint8_t>(&RealTimeHsiControl::convergeRate));
+            
+            inline constexpr auto estMagCalSchema = std::make_tuple(
+                Schema::decimal<float>(&EstMagCal::magGain00),
+                Schema::decimal<float>(&EstMagCal::magGain01),
+                Schema::decimal<float>(&EstMagCal::magGain02),
+                Schema::decimal<float>(&EstMagCal::magGain10),
+                Schema::decimal<float>(&EstMagCal::magGain11),
+                Schema::decimal<float>(&EstMagCal::magGain12),
+                Schema::decimal<float>(&EstMagCal::magGain20),
+                Schema::decimal<float>(&EstMagCal::magGain21),
+                Schema::decimal<float>(&EstMagCal::magGain22),
+                Schema::decimal<float>(&EstMagCal::magBiasX),
+                Schema::decimal<float>(&EstMagCal::magBiasY),
+                Schema::decimal<float>(&EstMagCal::magBiasZ));
+            
+        } // namespace HardSoftIronEstimator
+        
+        namespace Heave
+        {
+            inline constexpr auto heaveOutputsSchema = std::make_tuple(
+                Schema::decimal<float>(&HeaveOutputs::heave),
+                Schema::decimal<float>(&HeaveOutputs::heaveRate),
+                Schema::decimal<float>(&HeaveOutputs::delayedHeave));
+            
+            inline constexpr auto heaveBasicConfigSchema = std::make_tuple(
+                Schema::decimal<float>(&HeaveBasicConfig::initialWavePeriod),
+                Schema::decimal<float>(&HeaveBasicConfig::initialWaveAmplitude),
+                Schema::decimal<float>(&HeaveBasicConfig::maxWavePeriod),
+                Schema::decimal<float>(&HeaveBasicConfig::minWaveAmplitude),
+                Schema::decimal<float>(&HeaveBasicConfig::delayedHeaveCutoffFreq),
+                Schema::decimal<float>(&HeaveBasicConfig::heaveCutoffFreq),
+                Schema::decimal<float>(&HeaveBasicConfig::heaveRateCutoffFreq));
+            
+        } // namespace Heave
+        
+        namespace IMU
+        {
+            inline constexpr auto magSchema = std::make_tuple(
+                Schema::decimal<float>(&Mag::magX),
+                Schema::decimal<float>(&Mag::magY),
+                Schema::decimal<float>(&Mag::magZ));
+            
+            inline constexpr auto accelSchema = std::make_tuple(
+                Schema::decimal<float>(&Accel::accelX),
+                Schema::decimal<float>(&Accel::accelY),
+                Schema::decimal<float>(&Accel::accelZ));
+            
+            inline constexpr auto gyroSchema = std::make_tuple(
+                Schema::decimal<float>(&Gyro::gyroX),
+                Schema::decimal<float>(&Gyro::gyroY),
+                Schema::decimal<float>(&Gyro::gyroZ));
+            
+            inline constexpr auto magAccelGyroSchema = std::make_tuple(
+                Schema::decimal<float>(&MagAccelGyro::magX),
+                Schema::decimal<float>(&MagAccelGyro::magY),
+                Schema::decimal<float>(&MagAccelGyro::magZ),
+                Schema::decimal<float>(&MagAccelGyro::accelX),
+                Schema::decimal<float>(&MagAccelGyro::accelY),
+                Schema::decimal<float>(&MagAccelGyro::accelZ),
+                Schema::decimal<float>(&MagAccelGyro::gyroX),
+                Schema::decimal<float>(&MagAccelGyro::gyroY),
+                Schema::decimal<float>(&MagAccelGyro::gyroZ));
+            
+            inline constexpr auto magCalSchema = std::make_tuple(
+                Schema::decimal<float>(&MagCal::magGain00),
+                Schema::decimal<float>(&MagCal::magGain01),
+                Schema::decimal<float>(&MagCal::magGain02),
+                Schema::decimal<float>(&MagCal::magGain10),
+                Schema::decimal<float>(&MagCal::magGain11),
+                Schema::decimal<float>(&MagCal::magGain12),
+                Schema::decimal<float>(&MagCal::magGain20),
+                Schema::decimal<float>(&MagCal::magGain21),
+                Schema::decimal<float>(&MagCal::magGain22),
+                Schema::decimal<float>(&MagCal::magBiasX),
+                Schema::decimal<float>(&MagCal::magBiasY),
+                Schema::decimal<float>(&MagCal::magBiasZ));
+            
+            inline constexpr auto accelCalSchema = std::make_tuple(
+                Schema::decimal<float>(&AccelCal::accelGain00),
+                Schema::decimal<float>(&AccelCal::accelGain01),
+                Schema::decimal<float>(&AccelCal::accelGain02),
+                Schema::decimal<float>(&AccelCal::accelGain10),
+                Schema::decimal<float>(&AccelCal::accelGain11),
+                Schema::decimal<float>(&AccelCal::accelGain12),
+                Schema::decimal<float>(&AccelCal::accelGain20),
+                Schema::decimal<float>(&AccelCal::accelGain21),
+                Schema::decimal<float>(&AccelCal::accelGain22),
+                Schema::decimal<float>(&AccelCal::accelBiasX),
+                Schema::decimal<float>(&AccelCal::accelBiasY),
+                Schema::decimal<float>(&AccelCal::accelBiasZ));
+            
+            inline constexpr auto refFrameRotSchema = std::make_tuple(
+                Schema::decimal<float>(&RefFrameRot::rFR00),
+                Schema::decimal<float>(&RefFrameRot::rFR01),
+                Schema::decimal<float>(&RefFrameRot::rFR02),
+                Schema::decimal<float>(&RefFrameRot::rFR10),
+                Schema::decimal<float>(&RefFrameRot::rFR11),
+                Schema::decimal<float>(&RefFrameRot::rFR12),
+                Schema::decimal<float>(&RefFrameRot::rFR20),
+                Schema::decimal<float>(&RefFrameRot::rFR21),
+                Schema::decimal<float>(&RefFrameRot::rFR22));
+            
+            inline constexpr auto imuMeasSchema = std::make_tuple(
+                Schema::decimal<float>(&ImuMeas::uncompMagX),
+                Schema::decimal<float>(&ImuMeas::uncompMagY),
+                Schema::decimal<float>(&ImuMeas::uncompMagZ),
+                Schema::decimal<float>(&ImuMeas::uncompAccX),
+                Schema::decimal<float>(&ImuMeas::uncompAccY),
+                Schema::decimal<float>(&ImuMeas::uncompAccZ),
+                Schema::decimal<float>(&ImuMeas::uncompGyroX),
+                Schema::decimal<float>(&ImuMeas::uncompGyroY),
+                Schema::decimal<float>(&ImuMeas::uncompGyroZ),
+                Schema::decimal<float>(&ImuMeas::temperature),
+                Schema::decimal<float>(&ImuMeas::pressure));
+            
+            inline constexpr auto deltaThetaVelocitySchema = std::make_tuple(
+                Schema::decimal<float>(&DeltaThetaVelocity::deltaTime),
+                Schema::decimal<float>(&DeltaThetaVelocity::deltaThetaX),
+                Schema::decimal<float>(&DeltaThetaVelocity::deltaThetaY),
+                Schema::decimal<float>(&DeltaThetaVelocity::deltaThetaZ),
+                Schema::decimal<float>(&DeltaThetaVelocity::deltaVelX),
+                Schema::decimal<float>(&DeltaThetaVelocity::deltaVelY),
+                Schema::decimal<float>(&DeltaThetaVelocity::deltaVelZ));
+            
+            inline constexpr auto deltaThetaVelConfigSchema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&DeltaThetaVelConfig::integrationFrame, 0, 1),
+                Schema::enumeration<uint8_t>(&DeltaThetaVelConfig::gyroCompensation, 0, 1),
+                Schema::enumeration<uint8_t>(&DeltaThetaVelConfig::accelCompensation, 0, 3),
+                Schema::enumeration<uint8_t>(&DeltaThetaVelConfig::earthRateCompensation, 0, 3),
+                Schema::decimal<uint16_t>(&DeltaThetaVelConfig::resv));
+            
+            inline constexpr auto gyroCalSchema = std::make_tuple(
+                Schema::decimal<float>(&GyroCal::gyroGain00),
+                Schema::decimal<float>(&GyroCal::gyroGain01),
+                Schema::decimal<float>(&GyroCal::gyroGain02),
+                Schema::decimal<float>(&GyroCal::gyroGain10),
+                Schema::decimal<float>(&GyroCal::gyroGain11),
+                Schema::decimal<float>(&GyroCal::gyroGain12),
+                Schema::decimal<float>(&GyroCal::gyroGain20),
+                Schema::decimal<float>(&GyroCal::gyroGain21),
+                Schema::decimal<float>(&GyroCal::gyroGain22),
+                Schema::decimal<float>(&GyroCal::gyroBiasX),
+                Schema::decimal<float>(&GyroCal::gyroBiasY),
+                Schema::decimal<float>(&GyroCal::gyroBiasZ));
+            
+            inline constexpr auto imuFilterControlSchema = std::make_tuple(
+                Schema::decimal<uint16_t>(&ImuFilterControl::magWindowSize),
+                Schema::decimal<uint16_t>(&ImuFilterControl::accelWindowSize),
+                Schema::decimal<uint16_t>(&ImuFilterControl::gyroWindowSize),
+                Schema::decimal<uint16_t>(&ImuFilterControl::tempWindowSize),
+                Schema::decimal<uint16_t>(&ImuFilterControl::presWindowSize),
+                Schema::decimal<uint8_t>(&ImuFilterControl::magFilterMode),
+                Schema::decimal<uint8_t>(&ImuFilterControl::accelFilterMode),
+                Schema::decimal<uint8_t>(&ImuFilterControl::gyroFilterMode),
+                Schema::decimal<uint8_t>(&ImuFilterControl::tempFilterMode),
+                Schema::decimal<uint8_t>(&ImuFilterControl::presFilterMode));
+            
+        } // namespace IMU
+        
+        namespace INS
+        {
+            inline constexpr auto insSolLlaSchema = std::make_tuple(
+                Schema::decimal<double>(&InsSolLla::timeGpsTow),
+                Schema::decimal<uint16_t>(&InsSolLla::timeGpsWeek),
+                Schema::hex<uint16_t>(&InsSolLla::insStatus),
+                Schema::decimal<float>(&InsSolLla::yaw),
+                Schema::decimal<float>(&InsSolLla::pitch),
+                Schema::decimal<float>(&InsSolLla::roll),
+                Schema::decimal<double>(&InsSolLla::posLat),
+                Schema::decimal<double>(&InsSolLla::posLon),
+                Schema::decimal<double>(&InsSolLla::posAlt),
+                Schema::decimal<float>(&InsSolLla::velN),
+                Schema::decimal<float>(&InsSolLla::velE),
+                Schema::decimal<float>(&InsSolLla::velD),
+                Schema::decimal<float>(&InsSolLla::attUncertainty),
+                Schema::decimal<float>(&InsSolLla::posUncertainty),
+                Schema::decimal<float>(&InsSolLla::velUncertainty));
+            
+            inline constexpr auto insSolEcefSchema = std::make_tuple(
+                Schema::decimal<double>(&InsSolEcef::timeGpsTow),
+                Schema::decimal<uint16_t>(&InsSolEcef::timeGpsWeek),
+                Schema::hex<uint16_t>(&InsSolEcef::insStatus),
+                Schema::decimal<float>(&InsSolEcef::yaw),
+                Schema::decimal<float>(&InsSolEcef::pitch),
+                Schema::decimal<float>(&InsSolEcef::roll),
+                Schema::decimal<double>(&InsSolEcef::posEX),
+                Schema::decimal<double>(&InsSolEcef::posEY),
+                Schema::decimal<double>(&InsSolEcef::posEZ),
+                Schema::decimal<float>(&InsSolEcef::velEX),
+                Schema::decimal<float>(&InsSolEcef::velEY),
+                Schema::decimal<float>(&InsSolEcef::velEZ),
+                Schema::decimal<float>(&InsSolEcef::attUncertainty),
+                Schema::decimal<float>(&InsSolEcef::posUncertainty),
+                Schema::decimal<float>(&InsSolEcef::velUncertainty));
+            
+            inline constexpr auto insBasicConfigSchema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&InsBasicConfig::scenario, 0, 5),
+                Schema::enumeration<uint8_t>(&InsBasicConfig::ahrsAiding, 0, 1),
+                Schema::enumeration<uint8_t>(&InsBasicConfig::estBaseline, 0, 1),
+                Schema::decimal<uint8_t>(&InsBasicConfig::resv));
+            
+            inline constexpr auto insStateLlaSchema = std::make_tuple(
+                Schema::decimal<float>(&InsStateLla::yaw),
+                Schema::decimal<float>(&InsStateLla::pitch),
+                Schema::decimal<float>(&InsStateLla::roll),
+                Schema::decimal<double>(&InsStateLla::posLat),
+                Schema::decimal<double>(&InsStateLla::posLon),
+                Schema::decimal<double>(&InsStateLla::posAlt),
+                Schema::decimal<float>(&InsStateLla::velN),
+                Schema::decimal<float>(&InsStateLla::velE),
+                Schema::decimal<float>(&InsStateLla::velD),
+                Schema::decimal<float>(&InsStateLla::accelX),
+                Schema::decimal<float>(&InsStateLla::accelY),
+                Schema::decimal<float>(&InsStateLla::accelZ),
+                Schema::decimal<float>(&InsStateLla::gyroX),
+                Schema::decimal<float>(&InsStateLla::gyroY),
+                Schema::decimal<float>(&InsStateLla::gyroZ));
+            
+            inline constexpr auto insStateEcefSchema = std::make_tuple(
+                Schema::decimal<float>(&InsStateEcef::yaw),
+                Schema::decimal<float>(&InsStateEcef::pitch),
+                Schema::decimal<float>(&InsStateEcef::roll),
+                Schema::decimal<double>(&InsStateEcef::posEX),
+                Schema::decimal<double>(&InsStateEcef::posEY),
+                Schema::decimal<double>(&InsStateEcef::posEZ),
+                Schema::decimal<float>(&InsStateEcef::velEX),
+                Schema::decimal<float>(&InsStateEcef::velEY),
+                Schema::decimal<float>(&InsStateEcef::velEZ),
+                Schema::decimal<float>(&InsStateEcef::accelX),
+                Schema::decimal<float>(&InsStateEcef::accelY),
+                Schema::decimal<float>(&InsStateEcef::accelZ),
+                Schema::decimal<float>(&InsStateEcef::gyroX),
+                Schema::decimal<float>(&InsStateEcef::gyroY),
+                Schema::decimal<float>(&InsStateEcef::gyroZ));
+            
+            inline constexpr auto filterStartupBiasSchema = std::make_tuple(
+                Schema::decimal<float>(&FilterStartupBias::gyroBiasX),
+                Schema::decimal<float>(&FilterStartupBias::gyroBiasY),
+                Schema::decimal<float>(&FilterStartupBias::gyroBiasZ),
+                Schema::decimal<float>(&FilterStartupBias::accelBiasX),
+                Schema::decimal<float>(&FilterStartupBias::accelBiasY),
+                Schema::decimal<float>(&FilterStartupBias::accelBiasZ),
+                Schema::decimal<float>(&FilterStartupBias::presBias));
+            
+            inline constexpr auto insRefOffsetSchema = std::make_tuple(
+                Schema::decimal<float>(&InsRefOffset::refOffsetX),
+                Schema::decimal<float>(&InsRefOffset::refOffsetY),
+                Schema::decimal<float>(&InsRefOffset::refOffsetZ),
+                Schema::decimal<float>(&InsRefOffset::refUncertX),
+                Schema::decimal<float>(&InsRefOffset::refUncertY),
+                Schema::decimal<float>(&InsRefOffset::refUncertZ));
+            
+            inline constexpr auto insGnssSelectSchema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&InsGnssSelect::activeReceiverSelect, 0, 5),
+                Schema::decimal<uint8_t>(&InsGnssSelect::usedForNavTime),
+                Schema::decimal<uint8_t>(&InsGnssSelect::hysteresisTime),
+                Schema::enumeration<uint8_t>(&InsGnssSelect::useGnssCompass, 0, 1),
+                Schema::decimal<uint8_t>(&InsGnssSelect::resv1),
+                Schema::decimal<uint8_t>(&InsGnssSelect::resv2));
+            
+        } // namespace INS
+        
+        namespace System
+        {
+            inline constexpr auto userTagSchema = std::make_tuple(
+                Schema::text(&UserTag::tag));
+            
+            inline constexpr auto modelSchema = std::make_tuple(
+                Schema::text(&Model::model));
+            
+            inline constexpr auto hwVerSchema = std::make_tuple(
+                Schema::decimal<uint32_t>(&HwVer::hwVer),
+                Schema::decimal<uint32_t>(&HwVer::hwMinVer));
+            
+            inline constexpr auto serialSchema = std::make_tuple(
+                Schema::decimal<uint32_t>(&Serial::serialNum));
+            
+            inline constexpr auto fwVerSchema = std::make_tuple(
+                Schema::text(&FwVer::fwVer));
+            
+            inline constexpr auto baudRateSchema = std::make_tuple(
+                Schema::enumeration<uint32_t>(&BaudRate::baudRate, 9600, 921600),
+                Schema::enumeration<uint8_t>(&BaudRate::serialPort, 0, 2));
+            
+            inline constexpr auto asyncOutputTypeSchema = std::make_tuple(
+                Schema::enumeration<uint32_t>(&AsyncOutputType::ador, 0, 34),
+                Schema::enumeration<uint8_t>(&AsyncOutputType::serialPort, 0, 2));
+            
+            inline constexpr auto asyncOutputFreqSchema = std::make_tuple(
+                Schema::enumeration<uint32_t>(&AsyncOutputFreq::adof, 0, 200),
+                Schema::enumeration<uint8_t>(&AsyncOutputFreq::serialPort, 0, 2));
+            
+            inline constexpr auto protocolControlSchema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&ProtocolControl::asciiAppendCount, 0, 5),
+                Schema::enumeration<uint8_t>(&ProtocolControl::asciiAppendStatus, 0, 6),
+                Schema::enumeration<uint8_t>(&ProtocolControl::spiAppendCount, 0, 5),
+                Schema::enumeration<uint8_t>(&ProtocolControl::spiAppendStatus, 0, 6),
+                Schema::enumeration<uint8_t>(&ProtocolControl::asciiChecksum, 1, 3),
+                Schema::enumeration<uint8_t>(&ProtocolControl::spiChecksum, 0, 3),
+                Schema::enumeration<uint8_t>(&ProtocolControl::errorMode, 0, 2));
+            
+            inline constexpr auto syncControlSchema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&SyncControl::syncInMode, 0, 6),
+                Schema::enumeration<uint8_t>(&SyncControl::syncInEdge, 0, 1),
+                Schema::decimal<uint16_t>(&SyncControl::syncInSkipFactor),
+                Schema::decimal<uint32_t>(&SyncControl::resv1),
+                Schema::enumeration<uint8_t>(&SyncControl::syncOutMode, 0, 6),
+                Schema::enumeration<uint8_t>(&SyncControl::syncOutPolarity, 0, 1),
+                Schema::decimal<uint16_t>(&SyncControl::syncOutSkipFactor),
+                Schema::decimal<uint32_t>(&SyncControl::syncOutPulseWidth),
+                Schema::decimal<uint32_t>(&SyncControl::resv2));
+            
+            inline constexpr auto syncStatusSchema = std::make_tuple(
+                Schema::decimal<uint32_t>(&SyncStatus::syncInCount),
+                Schema::decimal<uint32_t>(&SyncStatus::syncInTime),
+                Schema::decimal<uint32_t>(&SyncStatus::syncOutCount));
+            
+            inline constexpr auto nmeaOutput1Schema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&NmeaOutput1::port, 0, 3),
+                Schema::enumeration<uint8_t>(&NmeaOutput1::rate, 0, 20),
+                Schema::enumeration<uint8_t>(&NmeaOutput1::mode, 0, 2),
+                Schema::enumeration<uint8_t>(&NmeaOutput1::gnssSelect, 0, 1),
+                Schema::hex<uint32_t>(&NmeaOutput1::msgSelection));
+            
+            inline constexpr auto nmeaOutput2Schema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&NmeaOutput2::port, 0, 3),
+                Schema::enumeration<uint8_t>(&NmeaOutput2::rate, 0, 20),
+                Schema::enumeration<uint8_t>(&NmeaOutput2::mode, 0, 2),
+                Schema::enumeration<uint8_t>(&NmeaOutput2::gnssSelect, 0, 1),
+                Schema::hex<uint32_t>(&NmeaOutput2::msgSelection));
+            
+            inline constexpr auto legacyCompatibilitySettingsSchema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&LegacyCompatibilitySettings::insLegacy, 0, 1),
+                Schema::decimal<uint8_t>(&LegacyCompatibilitySettings::gnssLegacy),
+                Schema::enumeration<uint8_t>(&LegacyCompatibilitySettings::imuLegacy, 0, 1),
+                Schema::enumeration<uint8_t>(&LegacyCompatibilitySettings::hwLegacy, 0, 1));
+            
+        } // namespace System
+        
+        namespace VelocityAiding
+        {
+            inline constexpr auto velAidingMeasSchema = std::make_tuple(
+                Schema::decimal<float>(&VelAidingMeas::velocityX),
+                Schema::decimal<float>(&VelAidingMeas::velocityY),
+                Schema::decimal<float>(&VelAidingMeas::velocityZ));
+            
+            inline constexpr auto velAidingControlSchema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&VelAidingControl::velAidEnable, 0, 1),
+                Schema::decimal<float>(&VelAidingControl::velUncertTuning),
+                Schema::decimal<float>(&VelAidingControl::resv));
+            
+        } // namespace VelocityAiding
+        
+        namespace WorldMagGravityModel
+        {
+            inline constexpr auto refModelConfigSchema = std::make_tuple(
+                Schema::enumeration<uint8_t>(&RefModelConfig::enableMagModel, 0, 1),
+                Schema::enumeration<uint8_t>(&RefModelConfig::enableGravityModel, 0, 1),
+                Schema::decimal<uint8_t>(&RefModelConfig::resv1),
+                Schema::decimal<uint8_t>(&RefModelConfig::resv2),
+                Schema::decimal<uint32_t>(&RefModelConfig::recalcThreshold),
+                Schema::decimal<float>(&RefModelConfig::year),
+                Schema::decimal<double>(&RefModelConfig::latitude),
+                Schema::decimal<double>(&RefModelConfig::longitude),
+                Schema::decimal<double>(&RefModelConfig::altitude));
+        } // namespace WorldMagGravityModel
+    } // namespace Registers
+} // namespace VN
+
+#endif // INTERFACE_REGISTERSCHEMAS_HPP
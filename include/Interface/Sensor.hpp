@@ -24,6 +24,7 @@
 #ifndef INTERFACE_SENSOR_HPP
 #define INTERFACE_SENSOR_HPP
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <optional>
@@ -45,6 +46,11 @@
 #include "Implementation/AsciiHeader.hpp"
 #include "Implementation/FaPacketDispatcher.hpp"
 #include "Implementation/FbPacketDispatcher.hpp"
+#include "Implementation/LatestMeasurements.hpp"
+#include "Implementation/BufferAutoTuner.hpp"
+#include "Implementation/LinkMonitor.hpp"
+#include "Interface/CompactCompositeData.hpp"
+#include "Interface/CompositeDataView.hpp"
 #include "Interface/Registers.hpp"
 
 namespace VN
@@ -71,6 +77,18 @@ public:
     template <size_t MainByteBufferCapacity, size_t FbByteBufferCapacity>
     Sensor(std::array<uint8_t, MainByteBufferCapacity>& mainBuffer, std::array<uint8_t, FbByteBufferCapacity>& fbBuffer);
 
+    /// @brief Buffer capacities chosen at runtime, so that one build can serve both slow and fast links.
+    struct BufferConfig
+    {
+        size_t mainBufferCapacity;          // Raised to at least Config::Serial::numBytesToReadPerGetData
+        uint16_t measurementQueueCapacity;  // Limited to Config::PacketDispatchers::compositeDataQueueCapacity, which sets the storage allocated
+        bool autoTune;  // If true, both are resized from the baud rate and the observed data rate once streaming begins, and grown if the rate later rises. See BufferAutoTuner.
+    };
+
+    /// @brief Constructor to size the Sensor's buffers at runtime.
+    /// @param bufferConfig The initial buffer capacities, and whether to auto-tune them after connecting.
+    Sensor(const BufferConfig& bufferConfig);
+
     /// @brief Default destructor.
     ~Sensor();
 
@@ -94,16 +112,37 @@ public:
     /// @brief Sends a ReadRegister for the Model register. Returns true if a valid response is received, otherwise returns false.
     bool verifySensorConnectivity() noexcept;
 
+    /// @brief Replaces the serial port with another transport, such as SerialReplay, which reads into this Sensor's main buffer. Must be called while
+    /// disconnected. The Sensor owns the transport for the rest of its life.
+    /// @tparam SerialType A Serial_Base, constructed from the main buffer followed by args.
+    /// @return The new transport, or nullptr if connected.
+    template <class SerialType, class... Args>
+    SerialType* useSerial(Args&&... args)
+    {
+        if (_serial->connectedPortName().has_value()) { return nullptr; }
+        auto serial = std::make_unique<SerialType>(_mainByteBuffer, std::forward<Args>(args)...);
+        SerialType* serialPtr = serial.get();
+        _customSerial = std::move(serial);
+        _serial = serialPtr;
+        return serialPtr;
+    }
+
     /// @brief Gets the port name of the open serial port. If no port is open, will return std::nullopt.
-    std::optional<Serial_Base::PortName> connectedPortName() const noexcept { return _serial.connectedPortName(); };
+    std::optional<Serial_Base::PortName> connectedPortName() const noexcept { return _serial->connectedPortName(); };
 
     /// @brief Gets the baud rate at which the serial port is opened. If no port is open, will return std::nullopt.
     std::optional<BaudRate> connectedBaudRate() const noexcept
     {
-        auto connectedBaudRate = _serial.connectedBaudRate();
+        auto connectedBaudRate = _serial->connectedBaudRate();
         return connectedBaudRate ? std::make_optional(static_cast<BaudRate>(*connectedBaudRate)) : std::nullopt;
     };
 
+    /// @brief Gets the buffer capacities currently in use, which may have been changed by auto-tuning.
+    BufferConfig bufferConfig() const noexcept
+    {
+        return BufferConfig{_mainByteBuffer.capacity(), _measurementQueue.capacity(), _autoTuneBuffers};
+    }
+
     /// @brief Sends a Write Register for the new baud rate to the unit and reopens to the serial port under the new baud rate. Will retry on failure.
     Error changeBaudRate(const BaudRate newBaudRate) noexcept;
 
@@ -120,7 +159,13 @@ public:
     using CompositeDataQueueReturn = DirectAccessQueue_Interface<CompositeData>::value_type;
 
     /// @brief Checks to see if there is a new measurement available on the MeasurementQueue.
-    bool hasMeasurement() const noexcept { return !_measurementQueue.isEmpty(); }
+    bool hasMeasurement() const noexcept
+    {
+#if (DEFERRED_PARSING_ENABLE)
+        if (!_deferredPacketQueue.isEmpty()) { return true; }
+#endif
+        return !_measurementQueue.isEmpty();
+    }
 
     /// @brief Gets (and pops) the front of the MeasurementQueue.
     /// @param block If true, wait a maximum of getMeasurementTimeoutLength for a new measurement.
@@ -130,6 +175,71 @@ public:
     /// @param block If true, wait a maximum of getMeasurementTimeoutLength for a new measurement.
     CompositeDataQueueReturn getMostRecentMeasurement(const bool block = true) noexcept;
 
+    /// @brief Pops up to count measurements from the front of the MeasurementQueue, in order, with a single lock acquisition. Does not block.
+    /// @param measurements The array to populate, of at least count elements.
+    /// @return The number of measurements popped into measurements.
+    size_t getMeasurements(CompositeDataQueueReturn* measurements, const size_t count) noexcept;
+
+    /// @brief Pops every measurement on the MeasurementQueue, in batches, calling callback(CompositeData&) on each in order. Does not block.
+    /// @return The number of measurements passed to callback.
+    template <class Callback>
+    size_t drainMeasurements(Callback&& callback) noexcept;
+
+#if (DEFERRED_PARSING_ENABLE)
+    /// @brief Parses every measurement queued by the listening thread onto the MeasurementQueue, until it is full. Measurements are otherwise parsed one at a
+    /// time as requested; this allows a worker thread to parse ahead of the consumer.
+    void parseDeferredMeasurements() noexcept;
+
+    /// @brief An FA measurement read in place from the raw packet queued by the listening thread. Holds the packet's slot on the queue until destroyed.
+    class MeasurementView
+    {
+    public:
+        /// @brief Whether a measurement was available.
+        explicit operator bool() const noexcept { return _view.has_value(); }
+
+        const CompositeDataView& operator*() const noexcept { return *_view; }
+        const CompositeDataView* operator->() const noexcept { return &*_view; }
+
+    private:
+        friend class Sensor;
+        PacketQueue_Interface::value_type _packet;  // Declared before _view, so the view is destroyed before the packet is released
+        std::optional<CompositeDataView> _view;
+    };
+
+    /// @brief Gets (and pops) the next FA measurement as a view over its raw packet, in place of getNextMeasurement. Only the measurements read from the
+    /// view are decoded, so no CompositeData is built. ASCII measurements queued ahead of it are parsed onto the MeasurementQueue.
+    /// @param offsetTable Locates each measurement in the packet. Reused across packets with the same header, so should be held by the consumer.
+    /// @param block If true, wait a maximum of getMeasurementTimeoutLength for a new measurement.
+    MeasurementView getNextMeasurementView(CompositeDataView::OffsetTable& offsetTable, const bool block = true) noexcept;
+#endif
+
+#if (COMPACT_MEASUREMENT_QUEUE_ENABLE)
+    using CompactMeasurementQueueReturn = DirectAccessQueue_Interface<CompactCompositeData>::value_type;
+
+    /// @brief Checks to see if there is a new FA measurement available on the CompactMeasurementQueue.
+    bool hasCompactMeasurement() const noexcept
+    {
+#if (DEFERRED_PARSING_ENABLE)
+        if (!_deferredPacketQueue.isEmpty()) { return true; }
+#endif
+        return !_compactMeasurementQueue.isEmpty();
+    }
+
+    /// @brief Gets (and pops) the front of the CompactMeasurementQueue, which holds every FA measurement in place of the MeasurementQueue. ASCII measurements
+    /// remain on the MeasurementQueue.
+    /// @param block If true, wait a maximum of getMeasurementTimeoutLength for a new measurement.
+    CompactMeasurementQueueReturn getNextCompactMeasurement(const bool block = true) noexcept;
+
+    /// @brief GNSS SatInfo and RawMeas blocks which could not be held because the slab shared by the CompactMeasurementQueue was exhausted.
+    uint32_t compactGnssDropCount() const noexcept { return _compactGnssSlab.numDropped.load(std::memory_order_relaxed); }
+#endif
+
+#if (LATEST_MEASUREMENT_ENABLE)
+    /// @brief The most recent measurement, and the most recent sample of each measurement group. Unlike the MeasurementQueue, reading these does not pop
+    /// anything and they are updated even while the queue is full. Each read parses the packet on the reader's thread. Safe to read from any thread.
+    const LatestMeasurements& latestMeasurements() const noexcept { return _latestMeasurements; }
+#endif
+
     // ------------------------------------------
     /*! \name Sending Commands */
     // ------------------------------------------
@@ -232,6 +342,14 @@ public:
     Error subscribeToMessage(PacketQueue_Interface* queueToSubscribe, const AsciiHeader& asciiHeaderFilter = AsciiHeader{},
                              const AsciiSubscriberFilterType filterType = AsciiSubscriberFilterType::StartsWith) noexcept;
 
+    /// @brief Registers a handler for a single, fixed binary output configuration (e.g. a FixedLayoutFastPath). FA packets it matches bypass generic parsing
+    /// and are not added to the measurement queue. Only one can be registered at a time, and it should be registered before connecting.
+    /// @param fastPath The handler for matching packets.
+    void registerFastPath(FaPacketDispatcher::FastPath* const fastPath) noexcept { _faPacketDispatcher.registerFastPath(fastPath); }
+
+    /// @brief Deregisters the fast path handler previously registered, if applicable. If not, it has no effect.
+    void deregisterFastPath() noexcept { _faPacketDispatcher.deregisterFastPath(); }
+
     /// @brief Unsubscribes the passed queue from all messages matching the passed sync byte, regardless of filter.
     /// @param queueToUnsubscribe The queue to unsubscribe.
     /// @param syncByte The sync byte from which to unsubscribe the passed queue.
@@ -264,6 +382,14 @@ public:
     /// @brief This is only used for software integration testing.
     friend class SensorTestHarness;
 
+    // -------------------------------
+    /*! @name Link Monitoring */
+    // -------------------------------
+
+    /// @brief Gets a snapshot of the link's data and packet rates, packet losses, and buffer high watermarks. Updated by the listening thread (or by
+    /// loadMainBufferFromSerial, if unthreaded) every Config::Sensor::linkStatsWindow / linkStatsBuckets. Lock-free, and safe to call from any thread.
+    LinkStats linkStats() const noexcept { return _linkMonitor.stats(); }
+
     // -------------------------------
     /*! @name Error Handling */
     // -------------------------------
@@ -279,7 +405,13 @@ private:
     // Connectivity
     //-------------------------------
     ByteBuffer _mainByteBuffer{Config::PacketFinders::mainBufferCapacity};
-    Serial _serial{_mainByteBuffer};
+    Serial _hardwareSerial{_mainByteBuffer};
+    std::unique_ptr<Serial_Base> _customSerial = nullptr;
+    Serial_Base* _serial = &_hardwareSerial;
+    bool _autoTuneBuffers = false;
+    BufferAutoTuner _bufferAutoTuner;
+    void _observeForBufferAutoTune(const size_t numBytesRead) noexcept;
+    LinkMonitor _linkMonitor;
 
 #if (THREADING_ENABLE)
     std::atomic<bool> _listening = false;
@@ -295,7 +427,23 @@ private:
     // Measurement Operators
     // -------------------------------
     MeasurementQueue _measurementQueue{Config::PacketDispatchers::compositeDataQueueCapacity};
-    Sensor::CompositeDataQueueReturn _blockOnMeasurement(Timer& timer, const Microseconds sleepLength) noexcept;
+    template <class MeasurementQueueType>
+    typename MeasurementQueueType::OwningPtr _blockOnMeasurement(MeasurementQueueType& queue, Timer& timer, const Microseconds sleepLength) noexcept;
+    void _awaitMeasurement(const Microseconds sleepLength) noexcept;
+#if (DEFERRED_PARSING_ENABLE)
+    // FA and ASCII measurements share one queue, so they are parsed in the order they arrived
+    PacketQueue<Config::PacketDispatchers::deferredPacketQueueCapacity> _deferredPacketQueue{
+        std::max<size_t>(Config::PacketFinders::faPacketMaxLength, Config::PacketFinders::asciiPacketMaxLength)};
+    void _parseDeferredPacket(const bool mostRecentOnly) noexcept;
+    void _parseDeferredPacket(const Packet& packet) noexcept;
+#endif
+#if (LATEST_MEASUREMENT_ENABLE)
+    LatestMeasurements _latestMeasurements;
+#endif
+#if (COMPACT_MEASUREMENT_QUEUE_ENABLE)
+    CompactGnssSlab _compactGnssSlab;
+    CompactMeasurementQueue _compactMeasurementQueue{};
+#endif
 
     //-------------------------------
     // Command Operators
@@ -306,12 +454,22 @@ private:
     // -------------------------------
     // Packet Processing
     // -------------------------------
+#if (DEFERRED_PARSING_ENABLE)
+    FaPacketDispatcher _faPacketDispatcher{&_measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes, &_deferredPacketQueue};
+#else
     FaPacketDispatcher _faPacketDispatcher{&_measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes};
+#endif
+#if (DEFERRED_PARSING_ENABLE)
+    AsciiPacketDispatcher _asciiPacketDispatcher{&_measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes, &_commandProcessor, &_deferredPacketQueue};
+#else
     AsciiPacketDispatcher _asciiPacketDispatcher{&_measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes, &_commandProcessor};
+#endif
     FbPacketDispatcher _fbPacketDispatcher{&_faPacketDispatcher, Config::PacketFinders::fbBufferCapacity};
 
     PacketSynchronizer _packetSynchronizer{_mainByteBuffer, [this](AsyncError&& error) { _asyncErrorQueue.put(std::move(error)); }};
 
+    void _addDispatchers() noexcept;
+
     // -------------------------------
     // Error handling
     // -------------------------------
@@ -323,10 +481,28 @@ template <size_t MainByteBufferCapacity, size_t FbBufferCapacity>
 Sensor::Sensor(std::array<uint8_t, MainByteBufferCapacity>& mainBuffer, std::array<uint8_t, FbBufferCapacity>& fbBuffer)
     : _mainByteBuffer(mainBuffer.data(), mainBuffer.size()), _fbPacketDispatcher(&_faPacketDispatcher, fbBuffer.data(), fbBuffer.size())
 {
-    // Set up packet synchronizer
-    _packetSynchronizer.addDispatcher(&_faPacketDispatcher);
-    _packetSynchronizer.addDispatcher(&_asciiPacketDispatcher);
-    _packetSynchronizer.addDispatcher(&_fbPacketDispatcher);
+    _addDispatchers();
+}
+
+template <class Callback>
+size_t Sensor::drainMeasurements(Callback&& callback) noexcept
+{
+    if constexpr (Config::PacketDispatchers::compositeDataQueueCapacity == 0) { return 0; }
+    std::array<CompositeDataQueueReturn, Config::PacketDispatchers::compositeDataQueueCapacity> batch;
+    size_t numDrained = 0;
+    while (true)
+    {
+        const size_t numPopped = getMeasurements(batch.data(), batch.size());
+        for (size_t i = 0; i < numPopped; ++i)
+        {
+            callback(*batch[i]);
+            batch[i] = nullptr;
+        }
+        numDrained += numPopped;
+        // A partial batch means the queue was emptied. Stopping there keeps a producer faster than the callback from holding us here indefinitely.
+        if (numPopped < batch.size()) { break; }
+    }
+    return numDrained;
 }
 }  // namespace VN
 
@@ -0,0 +1,128 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef TEMPLATELIBRARY_ARENA_HPP
+#define TEMPLATELIBRARY_ARENA_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace VN
+{
+
+/// @brief A single contiguous, zeroed, cache-line-aligned allocation, carved up by its owner. On Linux it can be backed by huge pages and locked into
+/// memory; elsewhere those options are ignored. Either way, every page is touched on construction so that steady-state use does not page fault.
+class Arena
+{
+public:
+    static constexpr size_t alignment = 64;
+
+    struct Options
+    {
+        bool hugePages = false;  // Prefer huge pages, falling back to transparent huge pages, then to normal pages.
+        bool lockPages = false;  // mlock the arena so it is never paged out. Silently skipped if the process lacks the privilege.
+    };
+
+    /// @brief Rounds a slot size up so that consecutive slots each start on their own cache line.
+    static constexpr size_t slotStride(const size_t slotSize) noexcept { return (slotSize + alignment - 1) / alignment * alignment; }
+
+    Arena(const size_t size) : Arena(size, Options{}) {}
+
+    Arena(const size_t size, const Options options) : _size(size)
+    {
+        if (_size == 0) { return; }
+#if defined(__linux__)
+        if (options.hugePages) { _mapHugePages(); }
+#endif
+        if (_data == nullptr) { _data = static_cast<uint8_t*>(::operator new(_size, std::align_val_t{alignment})); }
+        std::memset(_data, 0, _size);
+#if defined(__linux__)
+        if (options.lockPages) { _isLocked = (mlock(_data, _size) == 0); }
+#else
+        (void)options;
+#endif
+    }
+
+    ~Arena()
+    {
+        if (_data == nullptr) { return; }
+#if defined(__linux__)
+        if (_isLocked) { munlock(_data, _size); }
+        if (_mappedSize != 0)
+        {
+            munmap(_data, _mappedSize);
+            return;
+        }
+#endif
+        ::operator delete(_data, std::align_val_t{alignment});
+    }
+
+    Arena(Arena&& other) = delete;
+    Arena(const Arena& other) = delete;
+    Arena& operator=(Arena&& other) = delete;
+    Arena& operator=(const Arena& other) = delete;
+
+    uint8_t* data() noexcept { return _data; }
+    const uint8_t* data() const noexcept { return _data; }
+    size_t size() const noexcept { return _size; }
+    bool isLocked() const noexcept { return _isLocked; }
+
+private:
+    uint8_t* _data = nullptr;
+    size_t _size = 0;
+    size_t _mappedSize = 0;  // Nonzero if _data was mmapped rather than allocated.
+    bool _isLocked = false;
+
+#if defined(__linux__)
+    void _mapHugePages() noexcept
+    {
+        constexpr size_t hugePageSize = 2 * 1024 * 1024;
+        const size_t mappedSize = (_size + hugePageSize - 1) / hugePageSize * hugePageSize;
+#ifdef MAP_HUGETLB
+        void* mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#else
+        void* mapped = MAP_FAILED;
+#endif
+        if (mapped == MAP_FAILED)
+        {  // No reserved huge pages. Ask for transparent huge pages instead, which the kernel may or may not honor.
+            mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mapped == MAP_FAILED) { return; }
+#ifdef MADV_HUGEPAGE
+            madvise(mapped, mappedSize, MADV_HUGEPAGE);
+#endif
+        }
+        _data = static_cast<uint8_t*>(mapped);
+        _mappedSize = mappedSize;
+    }
+#endif
+};
+
+}  // namespace VN
+
+#endif  // TEMPLATELIBRARY_ARENA_HPP
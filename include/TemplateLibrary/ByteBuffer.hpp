@@ -29,7 +29,9 @@
 #include <algorithm>
 #include <cstdint>
 #include "Debug.hpp"
+#include "TemplateLibrary/ConsumerSignal.hpp"
 #include <atomic>
+#include <new>
 #if (VN_DEBUG_LEVEL > 0)
 #include <string>
 #include <array>
@@ -70,6 +72,24 @@ public:
     ByteBuffer& operator=(ByteBuffer&& other) = delete;
     ByteBuffer(ByteBuffer&& other) = delete;
 
+    /// @brief Reallocates the buffer at a new capacity, keeping its contents. Must not be called while another thread is accessing the buffer.
+    /// @return True if the buffer does not own its memory, the contents would not fit, or the allocation failed.
+    bool resize(const size_t newCapacity) noexcept
+    {
+        if (!_autoAllocated || (newCapacity == 0) || (newCapacity < _size)) { return true; }
+        uint8_t* newBuffer = new (std::nothrow) uint8_t[newCapacity];
+        if (newBuffer == nullptr) { return true; }
+        const size_t size = _size;
+        peek_unchecked(newBuffer, size, 0);
+        delete[] _buffer;
+        _buffer = newBuffer;
+        _capacity = newCapacity;
+        _head = 0;
+        _tail = size % newCapacity;
+        _full = (size == newCapacity);
+        return false;
+    }
+
     bool operator==(const ByteBuffer& other) const noexcept
     {
         if (this->size() != other.size()) { return false; }
@@ -127,7 +147,7 @@ public:
 
     uint8_t peek_unchecked(const size_t index = 0) const noexcept { return _buffer[(_head + index) % _capacity]; }
 
-    const uint8_t* peek_linear_unchecked(size_t offset) const { return &_buffer[_head + offset]; }
+    const uint8_t* peek_linear_unchecked(size_t offset) const { return &_buffer[(_head + offset) % _capacity]; }
 
     bool put(const uint8_t* inputBufferHead, size_t inputBufferSize) noexcept
     {
@@ -150,6 +170,7 @@ public:
         _tail = (_tail + inputBufferSize) % _capacity;
         _full = _tail == _head;
         _size += inputBufferSize;
+        if (_consumerSignal) { _consumerSignal->produced(inputBufferSize); }
 
         VN_DEBUG_2("putting bytes: " + std::to_string(inputBufferSize));
         return false;
@@ -215,6 +236,9 @@ public:
     bool isEmpty() const noexcept { return (!_full && (_tail == _head)); }
     bool isFull() const noexcept { return _full; }
     size_t capacity() const noexcept { return _capacity; }
+
+    /// @brief Registers the consumer to be woken as bytes are put, counting each byte as an item. Deregister with nullptr.
+    void setConsumerSignal(ConsumerSignal* consumerSignal) noexcept { _consumerSignal = consumerSignal; }
     size_t size() const noexcept { return _size; }
     uint8_t* data() const noexcept { return _buffer; }
     const uint8_t* head() const noexcept { return &_buffer[_head]; }
@@ -236,6 +260,7 @@ private:
     std::atomic<size_t> _size = 0;
     std::atomic<bool> _full = false;
     bool _autoAllocated = true;
+    ConsumerSignal* _consumerSignal = nullptr;
 
     constexpr const_iterator _begin() const noexcept { return _buffer; }
     const_iterator _end() const noexcept { return _begin() + _capacity; }
@@ -0,0 +1,81 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef TEMPLATELIBRARY_CONSUMERSIGNAL_HPP
+#define TEMPLATELIBRARY_CONSUMERSIGNAL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include "HAL/Duration.hpp"
+#include "HAL/Event.hpp"
+
+namespace VN
+{
+
+/// @brief Lets a consumer thread sleep until its queue is worth draining, rather than polling it. The consumer is woken once threshold items are
+/// pending, or maxLatency after the first item arrives, whichever is sooner. Producers call produced() once each item is visible to the consumer.
+class ConsumerSignal
+{
+public:
+    ConsumerSignal(const size_t threshold, const Microseconds maxLatency) : _threshold(std::max<size_t>(threshold, 1)), _maxLatency(maxLatency) {}
+
+    ConsumerSignal(const ConsumerSignal&) = delete;
+    ConsumerSignal& operator=(const ConsumerSignal&) = delete;
+
+    /// @brief Records count more items, waking the consumer on the first and again on crossing the threshold.
+    void produced(const size_t count = 1) noexcept
+    {
+        const size_t before = _pending.fetch_add(count, std::memory_order_acq_rel);
+        if ((before == 0) || (before < _threshold && before + count >= _threshold)) { _event.notify(); }
+    }
+
+    /// @brief Blocks until a batch is ready or interrupt() is called, then clears the pending count. Takes no CPU while nothing is pending.
+    void waitForBatch() noexcept
+    {
+        _event.wait();
+        if (!_interrupted.load(std::memory_order_acquire) && _pending.load(std::memory_order_acquire) < _threshold) { _event.waitFor(_maxLatency); }
+        _interrupted.store(false, std::memory_order_relaxed);
+        // Anything produced from here on raises the event again, so it is either drained next or wakes the following wait
+        _pending.store(0, std::memory_order_release);
+    }
+
+    /// @brief Wakes the consumer immediately, such as to let it stop.
+    void interrupt() noexcept
+    {
+        _interrupted.store(true, std::memory_order_release);
+        _event.notify();
+    }
+
+private:
+    const size_t _threshold;
+    const Microseconds _maxLatency;
+    std::atomic<size_t> _pending = 0;
+    std::atomic<bool> _interrupted = false;
+    Event _event;
+};
+
+}  // namespace VN
+
+#endif  // TEMPLATELIBRARY_CONSUMERSIGNAL_HPP
@@ -28,6 +28,7 @@
 #include <memory>
 #include <cstdint>
 #include "HAL/Mutex.hpp"
+#include "TemplateLibrary/ConsumerSignal.hpp"
 #include "TemplateLibrary/Queue.hpp"
 
 namespace VN
@@ -39,6 +40,20 @@ constexpr std::array<Type, sizeof...(Is)> initializeArray(int arg, std::index_se
     return {{(static_cast<void>(Is), Type(arg))...}};  // cast removes unused parameter warning
 }
 
+/// @brief Describes one contiguous buffer to be split into equally spaced, equally sized regions, one per queue element.
+struct ContiguousStorage
+{
+    uint8_t* data;
+    size_t stride;  // Distance between the starts of consecutive regions
+    size_t length;  // Usable length of each region
+};
+
+template <class Type, std::size_t... Is>
+constexpr std::array<Type, sizeof...(Is)> initializeArray(const ContiguousStorage storage, std::index_sequence<Is...>)
+{
+    return {{Type(storage.data + Is * storage.stride, storage.length)...}};
+}
+
 template <class ItemType>
 class DirectAccessQueue_Interface
 {
@@ -128,10 +143,25 @@ public:
     virtual OwningPtr put() noexcept = 0;
     virtual OwningPtr get() noexcept = 0;
     virtual OwningPtr getBack() noexcept = 0;
+    /// @brief Pops up to maxCount items from the front of the queue, in order, under a single lock acquisition.
+    /// @return The number of items popped into items.
+    virtual uint16_t getMany(OwningPtr* items, const uint16_t maxCount) noexcept = 0;
     virtual void reset() noexcept = 0;
     virtual uint16_t size() const noexcept = 0;
     virtual bool isEmpty() const noexcept = 0;
     virtual uint16_t capacity() const noexcept = 0;
+
+    /// @brief Registers the consumer to be woken as items arrive. The signal must outlive the queue or be deregistered with nullptr.
+    void setConsumerSignal(ConsumerSignal* consumerSignal) noexcept { _consumerSignal = consumerSignal; }
+
+    /// @brief Called by the producer once a put item has been released into the queue.
+    void notifyConsumer() noexcept
+    {
+        if (_consumerSignal) { _consumerSignal->produced(); }
+    }
+
+private:
+    ConsumerSignal* _consumerSignal = nullptr;
 };
 
 template <class ItemType, size_t Capacity>
@@ -152,14 +182,28 @@ public:
     {
     }
 
+    // Used to construct each item over its own region of a single buffer, as (pointer, length)
+    DirectAccessQueue(const ContiguousStorage storage) : _elements(initializeArray<Element>(storage, std::make_index_sequence<Capacity>{})) {}
+
     DirectAccessQueue(DirectAccessQueue&& other) = delete;
     DirectAccessQueue(const DirectAccessQueue& other) = delete;
     DirectAccessQueue& operator=(DirectAccessQueue&& other) = delete;
     DirectAccessQueue& operator=(const DirectAccessQueue& other) = delete;
 
+    /// @brief Limits the queue to fewer items than its storage holds; once the limit is reached, put() clears the queue as it would if full.
+    /// @return True if limit is zero or exceeds Capacity.
+    bool setCapacityLimit(const uint16_t limit) noexcept
+    {
+        if ((limit == 0) || (limit > Capacity)) { return true; }
+        LockGuard lock(_mutex);
+        _capacityLimit = limit;
+        return false;
+    }
+
     virtual OwningPtr put() noexcept override final
     {
         LockGuard lock(_mutex);
+        if ((_capacityLimit < Capacity) && (_circularBuffer.size() >= _capacityLimit)) { _reset(); }
         uint16_t i = 0;
         for (auto& element : _elements)
         {
@@ -167,6 +211,7 @@ public:
             {
                 element.status = Element::Status::Putting;
                 _circularBuffer.put(i);
+                _updateHighWatermark();
                 return &element;
             }
             ++i;
@@ -212,6 +257,21 @@ public:
         return &_elements[*nextIdx];
     }
 
+    virtual uint16_t getMany(OwningPtr* items, const uint16_t maxCount) noexcept override final
+    {
+        LockGuard lock(_mutex);
+        uint16_t numPopped = 0;
+        while (numPopped < maxCount)
+        {
+            const auto nextIdx = _circularBuffer.peek();
+            if (!nextIdx || (_elements[*nextIdx].status != Element::Status::InQueue)) { break; }
+            _circularBuffer.get();
+            _elements[*nextIdx].status = Element::Status::Getting;
+            items[numPopped++] = &_elements[*nextIdx];
+        }
+        return numPopped;
+    }
+
     virtual OwningPtr getBack() noexcept override final
     {
         LockGuard lock(_mutex);
@@ -245,12 +305,23 @@ public:
 
     virtual bool isEmpty() const noexcept override final { return _circularBuffer.isEmpty() || (size() == 0); }
 
-    virtual uint16_t capacity() const noexcept override final { return Capacity; }
+    virtual uint16_t capacity() const noexcept override final { return _capacityLimit; }
+
+    /// @brief The most items that have been in the queue at once, including any still being put.
+    uint16_t highWatermark() const noexcept { return _highWatermark.load(std::memory_order_relaxed); }
 
 private:
     std::array<Element, Capacity> _elements;
     Queue<uint16_t, Capacity> _circularBuffer;
     mutable Mutex _mutex;
+    std::atomic<uint16_t> _capacityLimit = Capacity;
+    std::atomic<uint16_t> _highWatermark = 0;
+
+    void _updateHighWatermark() noexcept
+    {
+        const uint16_t size = _circularBuffer.size();
+        if (size > _highWatermark.load(std::memory_order_relaxed)) { _highWatermark.store(size, std::memory_order_relaxed); }
+    }
 
     void _reset() noexcept
     {
@@ -0,0 +1,91 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef TEMPLATELIBRARY_SEQLOCK_HPP
+#define TEMPLATELIBRARY_SEQLOCK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace VN
+{
+
+/// @brief Holds a single, most recent value of a trivially copyable type. Readers never block the writer: a reader copies the value out and retries if a
+/// store overlapped the copy, as signalled by the sequence counter being odd or having changed. Stores from several threads are serialized against one
+/// another by the sequence counter itself, so a reader's retry is the only cost of contention.
+template <class T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock values are copied bytewise and must be trivially copyable.");
+
+public:
+    SeqLock() = default;
+
+    SeqLock(SeqLock&& other) = delete;
+    SeqLock(const SeqLock& other) = delete;
+    SeqLock& operator=(SeqLock&& other) = delete;
+    SeqLock& operator=(const SeqLock& other) = delete;
+
+    void store(const T& value) noexcept
+    {
+        uint32_t seq = _seq.load(std::memory_order_relaxed);
+        do {
+            seq &= ~uint32_t{1};
+        } while (!_seq.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed));
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(static_cast<void*>(&_value), &value, sizeof(T));
+        _seq.store(seq + 2, std::memory_order_release);
+    }
+
+    /// @brief Makes a single attempt to copy the value out.
+    /// @return True if a store overlapped the copy, in which case value is indeterminate.
+    bool tryLoad(T& value) const noexcept
+    {
+        const uint32_t seqBefore = _seq.load(std::memory_order_acquire);
+        if (seqBefore & 1) { return true; }
+        std::memcpy(static_cast<void*>(&value), &_value, sizeof(T));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return seqBefore != _seq.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Copies the value out, retrying until no store overlaps the copy.
+    T load() const noexcept
+    {
+        T retVal;
+        while (tryLoad(retVal)) {}
+        return retVal;
+    }
+
+    /// @brief The number of completed stores. Comparing against a previously read version tells whether the value has changed since.
+    uint32_t version() const noexcept { return _seq.load(std::memory_order_acquire) >> 1; }
+
+private:
+    std::atomic<uint32_t> _seq{0};
+    T _value{};
+};
+
+}  // namespace VN
+
+#endif  // TEMPLATELIBRARY_SEQLOCK_HPP
@@ -0,0 +1,88 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef TEMPLATELIBRARY_SLAB_HPP
+#define TEMPLATELIBRARY_SLAB_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace VN
+{
+
+/// @brief A fixed-capacity pool of items, handed out by index. Allocation and release are lock-free, so slots may be claimed on the listening thread and
+/// released on the consuming thread. Used to hold large, rarely-present items out-of-line from the objects which reference them.
+template <class ItemType, uint8_t Capacity>
+class Slab
+{
+    static_assert(Capacity < 0xFF, "Index 0xFF is reserved as invalidIndex.");
+
+public:
+    static constexpr uint8_t invalidIndex = 0xFF;
+
+    Slab() = default;
+
+    Slab(Slab&& other) = delete;
+    Slab(const Slab& other) = delete;
+    Slab& operator=(Slab&& other) = delete;
+    Slab& operator=(const Slab& other) = delete;
+
+    /// @brief Claims a free slot.
+    /// @return The index of the claimed slot, or invalidIndex if every slot is in use.
+    uint8_t allocate() noexcept
+    {
+        for (uint8_t i = 0; i < Capacity; ++i)
+        {
+            bool expected = false;
+            if (_inUse[i].compare_exchange_strong(expected, true, std::memory_order_acquire)) { return i; }
+        }
+        return invalidIndex;
+    }
+
+    /// @brief Returns a previously claimed slot to the slab. Passing invalidIndex is a no-op.
+    void release(const uint8_t index) noexcept
+    {
+        if (index < Capacity) { _inUse[index].store(false, std::memory_order_release); }
+    }
+
+    ItemType& operator[](const uint8_t index) noexcept { return _items[index]; }
+    const ItemType& operator[](const uint8_t index) const noexcept { return _items[index]; }
+
+    uint8_t capacity() const noexcept { return Capacity; }
+
+    uint8_t size() const noexcept
+    {
+        uint8_t retVal = 0;
+        for (const auto& inUse : _inUse) { retVal += inUse.load(std::memory_order_relaxed); }
+        return retVal;
+    }
+
+private:
+    std::array<ItemType, Capacity> _items{};
+    std::array<std::atomic<bool>, Capacity> _inUse{};
+};
+
+}  // namespace VN
+
+#endif  // TEMPLATELIBRARY_SLAB_HPP
@@ -47,6 +47,13 @@ class String
 {
     static_assert(Capacity < size_t(-1));
 
+    // The length is stored alongside the characters so that length() and everything built on it is O(1). A mutable reference into the characters
+    // (data(), begin(), end(), at(), operator[]) may be written through directly, e.g. by snprintf, so handing one out marks the stored length as
+    // unknown and the next length() recounts it once. So never pass end() and length() or numAvailable() to the same call: which is evaluated first is
+    // unspecified, and the length could be recounted before the write. Format into a separate buffer and append() it instead.
+    using LengthType = std::conditional_t<(Capacity < 0xFF), uint8_t, std::conditional_t<(Capacity < 0xFFFF), uint16_t, size_t>>;
+    static constexpr LengthType _unknownLength = std::numeric_limits<LengthType>::max();
+
 public:
     String() = default;
 
@@ -55,13 +62,18 @@ public:
         const size_t copyLength = std::min(Capacity, length);
         strncpy(str.data(), inputString, copyLength);
         str[copyLength] = '\0';  // Explicity set null termination for compiler
+        _length = static_cast<LengthType>(strnlen(str.data(), copyLength));
     }
 
     String(const char* begin, const char* end) : String(begin, std::distance(begin, end)) {}
 
     String(const std::string& inputString) : String(inputString.c_str(), inputString.size() + 1) {}
 
-    String(const char& inputChar) { str[0] = inputChar; }
+    String(const char& inputChar)
+    {
+        str[0] = inputChar;
+        _length = (inputChar == '\0') ? 0 : 1;
+    }
 
     template <size_t CapacityR>
     String(const String<CapacityR>& other)
@@ -69,10 +81,15 @@ public:
         const size_t copyLength = std::min(Capacity, other.length());
         memcpy(str.data(), other.begin(), copyLength);  // Using memcpy because gcc was pushing a truncation warning
         str[copyLength] = '\0';                         // Explicity set null termination
+        _length = static_cast<LengthType>(copyLength);
     }
 
     const char* data() const noexcept { return str.data(); }
-    char* data() noexcept { return str.data(); }
+    char* data() noexcept
+    {
+        _length = _unknownLength;
+        return str.data();
+    }
 
     auto c_str() const noexcept { return str.data(); }
 
@@ -83,6 +100,7 @@ public:
     char& at(size_t index) noexcept
     {
         VN_ASSERT(index <= length());
+        _length = _unknownLength;
         return str.at(index);
     }
 
@@ -94,28 +112,93 @@ public:
 
     bool push_back(const char charToPush) noexcept
     {
-        if (length() >= Capacity) { return true; }
-        str[length()] = charToPush;
+        const size_t currentLength = length();
+        if (currentLength >= Capacity) { return true; }
+        if (charToPush == '\0') { return false; }
+        str[currentLength] = charToPush;
+        str[currentLength + 1] = '\0';
+        _length = static_cast<LengthType>(currentLength + 1);
+        return false;
+    }
+
+    /// @brief Appends up to numChars characters, stopping early at a null character. Returns true if the input was truncated to fit.
+    bool append(const char* chars, const size_t numChars) noexcept
+    {
+        const size_t currentLength = length();
+        const char* nullChar = static_cast<const char*>(memchr(chars, '\0', numChars));
+        const size_t inputLength = (nullChar == nullptr) ? numChars : static_cast<size_t>(nullChar - chars);
+        const size_t copyLength = std::min(inputLength, Capacity - currentLength);
+        memcpy(str.data() + currentLength, chars, copyLength);
+        str[currentLength + copyLength] = '\0';
+        _length = static_cast<LengthType>(currentLength + copyLength);
+        return copyLength != inputLength;
+    }
+
+    template <size_t CapacityR>
+    bool append(const String<CapacityR>& other) noexcept
+    {
+        return append(other.c_str(), other.length());
+    }
+
+    /// @brief Replaces the contents with up to numChars characters, stopping early at a null character. Returns true if the input was truncated to fit.
+    bool assign(const char* chars, const size_t numChars) noexcept
+    {
+        _length = 0;
+        return append(chars, numChars);
+    }
+
+    /// @brief Sets the length after the characters have been written directly through data(). Returns true if newLength exceeds the capacity.
+    bool setLength(const size_t newLength) noexcept
+    {
+        if (newLength > Capacity) { return true; }
+        str[newLength] = '\0';
+        _length = static_cast<LengthType>(newLength);
         return false;
     }
 
     void pop_back() noexcept
     {
         if (empty()) { return; }
-        str[length() - 1] = '\0';
+        const size_t newLength = length() - 1;
+        str[newLength] = '\0';
+        _length = static_cast<LengthType>(newLength);
     }
 
-    char back() noexcept { return empty() ? '\0' : str[length() - 1]; }
+    char back() const noexcept { return empty() ? '\0' : str[length() - 1]; }
 
-    void clear() noexcept { std::fill(str.begin(), str.end(), '\0'); }
+    void clear() noexcept
+    {
+        std::fill(str.begin(), str.end(), '\0');
+        _length = 0;
+    }
 
     const char* begin() const noexcept { return str.data(); }
-    char* begin() noexcept { return str.data(); }
+    char* begin() noexcept
+    {
+        _length = _unknownLength;
+        return str.data();
+    }
 
     const char* end() const noexcept { return &str[length()]; }
-    char* end() noexcept { return &str[length()]; }
+    char* end() noexcept
+    {
+        char* retVal = &str[length()];
+        _length = _unknownLength;
+        return retVal;
+    }
 
-    size_t length() const noexcept { return strnlen(str.data(), Capacity); }
+    size_t length() const noexcept
+    {
+        if (_length == _unknownLength)
+        {
+            // Counted with a loop rather than strnlen, which gcc flags with -Wstringop-overread where it can only see part of the object, e.g. a
+            // String in an inactive union member.
+            size_t count = 0;
+            while (count < Capacity && str[count] != '\0') { ++count; }
+            _length = static_cast<LengthType>(count);
+        }
+        return _length;
+    }
 
     bool empty() const noexcept { return (str[0] == '\0'); }
 
@@ -181,7 +264,11 @@ public:
 
     operator std::string() const noexcept { return to_string(); }
 
-    char& operator[](size_t index) { return str[index]; }
+    char& operator[](size_t index)
+    {
+        _length = _unknownLength;
+        return str[index];
+    }
 
     const char& operator[](size_t index) const noexcept { return str[index]; }
 
@@ -189,6 +276,7 @@ public:
 
 private:
     std::array<char, Capacity + 1> str = {0};
+    mutable LengthType _length = 0;
 };
 
 // ###################
@@ -225,10 +313,7 @@ String<Capacity> operator+(const char lhs, const String<Capacity>& rhs) noexcept
 template <size_t CapacityL, size_t CapacityR>
 String<CapacityL> operator+(String<CapacityL> lhs, const char (&rhs)[CapacityR]) noexcept
 {
-    const size_t rhsLen = strnlen(rhs, CapacityR);
-    const size_t rem = CapacityL - lhs.length();
-    const size_t num = (rem >= rhsLen) ? rhsLen : rem;
-    std::copy_n(rhs, num, lhs.end());
+    lhs.append(rhs, CapacityR);
     return lhs;
 }
 
@@ -257,10 +342,7 @@ String<Capacity> operator+(const std::string& lhs, const String<Capacity>& rhs)
 template <size_t CapacityL, size_t CapacityR>
 String<CapacityL> operator+(String<CapacityL> lhs, const String<CapacityR>& rhs) noexcept
 {
-    const size_t rhsLen = rhs.length();
-    const size_t rem = CapacityL - lhs.length();
-    const size_t num = (rem >= rhsLen) ? rhsLen : rem;
-    std::copy_n(rhs.begin(), num, lhs.end());
+    lhs.append(rhs);
     return lhs;
 }
 
@@ -321,10 +403,79 @@ std::optional<T> fromString(const char* begin, const char* end) {
     return std::make_optional(numReturn);
 }
 
+/// @brief Locale-free parse of the plain decimal form the sensor emits ([+-]digits[.digits][(e|E)[+-]digits]). Returns nullopt for anything it cannot
+/// convert exactly, in which case the caller falls back to the standard library. The arithmetic is done in T itself so that the mantissa and the power
+/// of ten are both exact and a single multiply or divide is correctly rounded: for double that allows 15 significant digits and a decimal exponent
+/// within +/-22, for float a mantissa up to 2^24 (7-8 significant digits) and an exponent within +/-10. Going through double for a float would round
+/// twice and could differ from strtof in the last bit.
+template <class T>
+std::optional<T> _fastFromString(const char* begin, const char* end) noexcept
+{
+    static_assert(std::is_floating_point_v<T>, "Template parameter T must be a floating point type");
+    constexpr T powersOfTen[] = {T(1e0),  T(1e1),  T(1e2),  T(1e3),  T(1e4),  T(1e5),  T(1e6),  T(1e7),  T(1e8),  T(1e9),  T(1e10), T(1e11),
+                                 T(1e12), T(1e13), T(1e14), T(1e15), T(1e16), T(1e17), T(1e18), T(1e19), T(1e20), T(1e21), T(1e22)};
+    constexpr bool isFloat = std::is_same_v<T, float>;
+    constexpr int maxExactPower = isFloat ? 10 : 22;
+    constexpr int maxExactDigits = isFloat ? 8 : 15;
+    constexpr uint64_t maxExactMantissa = isFloat ? (uint64_t(1) << 24) : (uint64_t(1) << 53);
+
+    const char* ptr = begin;
+    bool isNegative = false;
+    if (ptr != end && (*ptr == '+' || *ptr == '-')) { isNegative = (*ptr++ == '-'); }
+
+    uint64_t mantissa = 0;
+    int numSignificantDigits = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+    for (; ptr != end && *ptr >= '0' && *ptr <= '9'; ++ptr)
+    {
+        hasDigits = true;
+        if (mantissa == 0 && *ptr == '0') { continue; }
+        if (++numSignificantDigits > maxExactDigits) { return std::nullopt; }
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*ptr - '0');
+    }
+    if (ptr != end && *ptr == '.')
+    {
+        for (++ptr; ptr != end && *ptr >= '0' && *ptr <= '9'; ++ptr)
+        {
+            hasDigits = true;
+            --exponent;
+            if (mantissa == 0 && *ptr == '0') { continue; }
+            if (++numSignificantDigits > maxExactDigits) { return std::nullopt; }
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*ptr - '0');
+        }
+    }
+    if (!hasDigits) { return std::nullopt; }
+    if (ptr != end && (*ptr == 'e' || *ptr == 'E'))
+    {
+        ++ptr;
+        bool isExponentNegative = false;
+        if (ptr != end && (*ptr == '+' || *ptr == '-')) { isExponentNegative = (*ptr++ == '-'); }
+        if (ptr == end) { return std::nullopt; }
+        int explicitExponent = 0;
+        for (; ptr != end && *ptr >= '0' && *ptr <= '9'; ++ptr)
+        {
+            if (explicitExponent > 2 * maxExactPower) { return std::nullopt; }
+            explicitExponent = explicitExponent * 10 + (*ptr - '0');
+        }
+        exponent += isExponentNegative ? -explicitExponent : explicitExponent;
+    }
+    if (ptr != end) { return std::nullopt; }
+    if (exponent < -maxExactPower || exponent > maxExactPower) { return std::nullopt; }
+    if (mantissa > maxExactMantissa) { return std::nullopt; }
+
+    T value = static_cast<T>(mantissa);
+    if (exponent < 0) { value /= powersOfTen[-exponent]; }
+    else { value *= powersOfTen[exponent]; }
+    return std::make_optional(isNegative ? -value : value);
+}
+
 // 浮動小数点数に対する特殊化
 template <class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
 std::optional<T> fromString(const char* begin, const char* end) {
     static_assert(std::is_arithmetic_v<T>, "Template parameter T must be a numeric type");
+    const std::optional<T> fastReturn = _fastFromString<T>(begin, end);
+    if (fastReturn.has_value()) { return fastReturn; }
     T numReturn;
     std::string s(begin, end);
     std::istringstream iss(s);
@@ -339,6 +490,8 @@ std::optional<T> fromString(const char* begin, const char* end) {
 template <>
 inline std::optional<double> fromString(const char* begin, const char* end)
 {
+    const std::optional<double> fastReturn = _fastFromString<double>(begin, end);
+    if (fastReturn.has_value()) { return fastReturn; }
     char* endPtr;
     errno = 0;
     const double numReturn = strtod(begin, &endPtr);
@@ -349,6 +502,8 @@ inline std::optional<double> fromString(const char* begin, const char* end)
 template <>
 inline std::optional<float> fromString(const char* begin, const char* end)
 {
+    const std::optional<float> fastReturn = _fastFromString<float>(begin, end);
+    if (fastReturn.has_value()) { return fastReturn; }
     char* endPtr;
     errno = 0;
     const float numReturn = strtof(begin, &endPtr);
@@ -451,8 +606,11 @@ struct std::hash<VN::String<Capacity>>
 {
     size_t operator()(const VN::String<Capacity>& str) const noexcept
     {
+        // Hashes over the stored length, so a String with a known length is never rescanned for its terminator
+        const char* chars = str.c_str();
+        const size_t length = str.length();
         size_t hash = 0;
-        for (size_t i = 0; i < str.length(); ++i) { hash ^= static_cast<size_t>(str[i]) + 0x9e3779b9 + (hash << 6) + (hash >> 2); }
+        for (size_t i = 0; i < length; ++i) { hash ^= static_cast<size_t>(chars[i]) + 0x9e3779b9 + (hash << 6) + (hash >> 2); }
         return hash;
     }
 };
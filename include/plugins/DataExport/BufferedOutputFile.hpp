@@ -0,0 +1,159 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef DATAEXPORT_BUFFEREDOUTPUTFILE_HPP
+#define DATAEXPORT_BUFFEREDOUTPUTFILE_HPP
+
+#include <cstring>
+#include <memory>
+
+#include "Config.hpp"
+#include "HAL/File.hpp"
+
+namespace VN
+{
+
+/// @brief An OutputFile which collects writes in a large block of memory and hands them to the file only when the block fills, when flushed, or
+/// when destroyed. Exporters format directly into the block using reserve() and commit(). The block is only held while the file is open.
+class BufferedOutputFile
+{
+public:
+    BufferedOutputFile() = default;
+    explicit BufferedOutputFile(const size_t capacity) : _capacity(capacity) {}
+    BufferedOutputFile(const Filesystem::FilePath& filePath, const size_t capacity = Config::DataExport::fileBufferCapacity)
+        : _file(filePath), _buffer(std::make_unique<char[]>(capacity)), _capacity(capacity)
+    {
+    }
+
+    ~BufferedOutputFile() { flush(); }
+
+    BufferedOutputFile(const BufferedOutputFile&) = delete;
+    BufferedOutputFile& operator=(const BufferedOutputFile&) = delete;
+
+    BufferedOutputFile(BufferedOutputFile&& rhs) noexcept
+        : _file(std::move(rhs._file)), _buffer(std::move(rhs._buffer)), _capacity(rhs._capacity), _size(rhs._size)
+    {
+        rhs._capacity = 0;
+        rhs._size = 0;
+    }
+
+    BufferedOutputFile& operator=(BufferedOutputFile&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            flush();
+            _file = std::move(rhs._file);
+            _buffer = std::move(rhs._buffer);
+            _capacity = rhs._capacity;
+            _size = rhs._size;
+            rhs._capacity = 0;
+            rhs._size = 0;
+        }
+        return *this;
+    }
+
+    /// @brief Opens the file, truncating it.
+    /// @return An error occurred.
+    bool open(const Filesystem::FilePath& filePath)
+    {
+        close();
+        if (_file.open(filePath)) { return true; }
+        _buffer = std::make_unique<char[]>(_capacity);
+        return false;
+    }
+
+    /// @brief Opens the file to write after its existing contents, such as to continue one closed earlier.
+    /// @return An error occurred.
+    bool openAppend(const Filesystem::FilePath& filePath)
+    {
+        close();
+        if (_file.openAppend(filePath)) { return true; }
+        _buffer = std::make_unique<char[]>(_capacity);
+        return false;
+    }
+
+    /// @brief Writes out the block and closes the file, releasing the block until the file is opened again.
+    void close()
+    {
+        flush();
+        _file.close();
+        _buffer = nullptr;
+    }
+
+    /// @brief Appends bytes to the block, flushing first if they do not fit. Writes larger than the block go straight to the file.
+    /// @return An error occurred.
+    bool write(const char* buffer, const size_t count)
+    {
+        if (_buffer == nullptr) { return true; }
+        if (count > _capacity - _size)
+        {
+            if (flush()) { return true; }
+            if (count > _capacity) { return _file.write(buffer, count); }
+        }
+        std::memcpy(_buffer.get() + _size, buffer, count);
+        _size += count;
+        return false;
+    }
+
+    bool write(const char* buffer) { return write(buffer, std::strlen(buffer)); }
+
+    /// @brief Makes room for at least count contiguous bytes, flushing if necessary. Follow with commit() once the bytes are written.
+    /// @return Where to write, or nullptr if the file is closed, count exceeds the block capacity, or the flush failed.
+    char* reserve(const size_t count)
+    {
+        if (_buffer == nullptr) { return nullptr; }
+        if (count > _capacity - _size)
+        {
+            if (count > _capacity || flush()) { return nullptr; }
+        }
+        return _buffer.get() + _size;
+    }
+
+    /// @brief Accepts count bytes written at the pointer last returned by reserve().
+    void commit(const size_t count) { _size += count; }
+
+    /// @brief Hands everything collected so far to the file.
+    /// @return An error occurred.
+    bool flush()
+    {
+        if (_size == 0) { return false; }
+        const bool error = _file.write(_buffer.get(), _size);
+        _size = 0;
+        return error;
+    }
+
+    bool is_open() const { return _file.is_open(); }
+
+    size_t capacity() const { return _capacity; }
+
+private:
+    OutputFile _file;
+    std::unique_ptr<char[]> _buffer = nullptr;
+    size_t _capacity = 0;
+    size_t _size = 0;
+};
+
+}  // namespace VN
+
+#endif  // DATAEXPORT_BUFFEREDOUTPUTFILE_HPP
@@ -0,0 +1,257 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef DATAEXPORT_COLUMNARDECODER_HPP
+#define DATAEXPORT_COLUMNARDECODER_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "HAL/File.hpp"
+#include "Implementation/BinaryMeasurementDefinitions.hpp"
+#include "Implementation/CoreUtils.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "Interface/CompositeDataView.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+
+namespace VN
+{
+
+/// @brief Decodes every FA packet in a log into contiguous, per-component column arrays (struct-of-arrays), for offline analysis.
+/// Each valid FA packet in the log is one row. Requested measurements are addressed by their native group and field, and are found whether they were output
+/// in their native group or in the Common group. Consecutive packets sharing a header and length are decoded together as a run: the header is compared
+/// byte-for-byte rather than parsed, and each column is filled by a fixed-stride copy loop over the run.
+class ColumnarDecoder
+{
+public:
+    class Column
+    {
+    public:
+        uint8_t group() const noexcept { return _group; }
+        uint8_t field() const noexcept { return _field; }
+        size_t numComponents() const noexcept { return _components.size(); }
+        size_t elementSize() const noexcept { return _elementSize; }
+
+        /// @brief The contiguous values of one component, one per row. Rows where the measurement was absent hold zero. T must be the type the column was
+        /// added with.
+        template <class T>
+        const T* data(const size_t component) const noexcept
+        {
+            VN_ASSERT(sizeof(T) == _elementSize);
+            return reinterpret_cast<const T*>(_components[component].data());
+        }
+
+        /// @brief Whether the measurement was present in the passed row.
+        bool isValid(const size_t row) const noexcept { return (_validity[row / 64] >> (row % 64)) & 1U; }
+
+        /// @brief The validity bitmap, one bit per row, least-significant bit first.
+        const std::vector<uint64_t>& validity() const noexcept { return _validity; }
+
+    private:
+        friend class ColumnarDecoder;
+
+        Column(const uint8_t group, const uint8_t field, const uint8_t elementSize, const uint8_t numComponents)
+            : _group(group), _field(field), _elementSize(elementSize), _components(numComponents)
+        {
+        }
+
+        uint8_t _group;
+        uint8_t _field;
+        uint8_t _elementSize;
+        std::vector<std::vector<uint8_t>> _components;
+        std::vector<uint64_t> _validity;
+    };
+
+    /// @brief Requests a measurement be decoded into columns of T. A measurement of several T (e.g. float for Accel) is split into one column per component;
+    /// a measurement of mixed types (e.g. TimeUtc) should be requested as its own type, in a single column.
+    /// @return True if the measurement has no static size, or its size is not a multiple of sizeof(T).
+    template <class T>
+    bool addColumn(const uint8_t group, const uint8_t field) noexcept
+    {
+        static_assert(sizeof(T) <= std::numeric_limits<uint8_t>::max());
+        const auto size = getStaticBinaryTypeSize(group, field);
+        if (!size.has_value() || (*size % sizeof(T)) != 0) { return true; }
+        _columns.push_back(Column(group, field, sizeof(T), *size / sizeof(T)));
+        return false;
+    }
+
+    /// @brief Decodes a log file. Clears any previously decoded rows.
+    /// @return True if the file could not be read.
+    bool decode(const Filesystem::FilePath& fileName)
+    {
+        if (!Filesystem::exists(fileName)) { return true; }
+        const auto fileSizeInBytes = std::filesystem::file_size(fileName.c_str());
+        auto buffer = std::make_unique<uint8_t[]>(fileSizeInBytes);
+        InputFile inputFile(fileName);
+        if (inputFile.read(reinterpret_cast<char*>(buffer.get()), fileSizeInBytes)) { return true; }
+        decode(buffer.get(), fileSizeInBytes);
+        return false;
+    }
+
+    /// @brief Decodes the contents of a ByteBuffer, which is not modified. Clears any previously decoded rows.
+    void decode(const ByteBuffer& byteBuffer)
+    {
+        const size_t size = byteBuffer.size();
+        if (byteBuffer.numLinearBytes() >= size) { decode(byteBuffer.peek_linear_unchecked(0), size); }
+        else
+        {
+            std::vector<uint8_t> linear(size);
+            byteBuffer.peek_unchecked(linear.data(), size);
+            decode(linear.data(), size);
+        }
+    }
+
+    /// @brief Decodes a linear log. Clears any previously decoded rows.
+    void decode(const uint8_t* log, const size_t length);
+
+    size_t numRows() const noexcept { return _rowOffsets.size(); }
+
+    /// @brief The byte offset of each row's packet within the log.
+    const std::vector<size_t>& rowOffsets() const noexcept { return _rowOffsets; }
+
+    /// @brief Gets the columns of a measurement previously added, or nullptr if it was not.
+    const Column* column(const uint8_t group, const uint8_t field) const noexcept
+    {
+        for (const auto& col : _columns)
+        {
+            if (col._group == group && col._field == field) { return &col; }
+        }
+        return nullptr;
+    }
+
+private:
+    std::vector<Column> _columns;
+    std::vector<size_t> _rowOffsets;
+
+    void _appendRun(const uint8_t* runStart, const size_t stride, const size_t numPackets, const CompositeDataView::OffsetTable& offsetTable);
+
+    template <size_t ElementSize>
+    static void _gather(uint8_t* dst, const uint8_t* src, const size_t stride, const size_t count) noexcept
+    {
+        for (size_t i = 0; i < count; ++i) { std::memcpy(dst + i * ElementSize, src + i * stride, ElementSize); }
+    }
+
+    static void _gather(uint8_t* dst, const uint8_t* src, const size_t elementSize, const size_t stride, const size_t count) noexcept
+    {
+        switch (elementSize)
+        {
+            case 1:
+                return _gather<1>(dst, src, stride, count);
+            case 2:
+                return _gather<2>(dst, src, stride, count);
+            case 4:
+                return _gather<4>(dst, src, stride, count);
+            case 8:
+                return _gather<8>(dst, src, stride, count);
+            default:
+                for (size_t i = 0; i < count; ++i) { std::memcpy(dst + i * elementSize, src + i * stride, elementSize); }
+        }
+    }
+
+    static void _setValidRange(std::vector<uint64_t>& bitmap, size_t first, const size_t last) noexcept
+    {
+        for (; first < last && (first % 64) != 0; ++first) { bitmap[first / 64] |= uint64_t(1) << (first % 64); }
+        for (; first + 64 <= last; first += 64) { bitmap[first / 64] = ~uint64_t(0); }
+        for (; first < last; ++first) { bitmap[first / 64] |= uint64_t(1) << (first % 64); }
+    }
+
+    static bool _isValidCrc(const uint8_t* packet, const size_t length) noexcept
+    {
+        uint16_t crc = 0;
+        for (size_t i = 1; i < length; ++i) { _calculateCRC(&crc, packet[i]); }
+        return crc == 0;
+    }
+};
+
+inline void ColumnarDecoder::decode(const uint8_t* log, const size_t length)
+{
+    _rowOffsets.clear();
+    for (auto& col : _columns)
+    {
+        for (auto& component : col._components) { component.clear(); }
+        col._validity.clear();
+    }
+
+    const ByteBuffer byteBuffer(const_cast<uint8_t*>(log), length, length);
+    CompositeDataView::OffsetTable offsetTable;
+    size_t index = 0;
+    while (index < length)
+    {
+        if (log[index] != 0xFA)
+        {
+            ++index;
+            continue;
+        }
+        const auto findPacketRetVal = FaPacketProtocol::findPacket(byteBuffer, index);
+        if (findPacketRetVal.validity != FaPacketProtocol::Validity::Valid || offsetTable.update(log + index, findPacketRetVal.metadata))
+        {
+            ++index;
+            continue;
+        }
+
+        // Extend the run while the following packets repeat this one's header. Their layout is then identical, so only the crc needs checking.
+        const size_t packetLength = findPacketRetVal.metadata.length;
+        const size_t headerLength = 1 + findPacketRetVal.metadata.header.size();
+        size_t numPackets = 1;
+        if (!offsetTable.hasDynamicFields())
+        {
+            while (index + (numPackets + 1) * packetLength <= length)
+            {
+                const uint8_t* next = log + index + numPackets * packetLength;
+                if (std::memcmp(log + index, next, headerLength) != 0 || !_isValidCrc(next, packetLength)) { break; }
+                ++numPackets;
+            }
+        }
+        _appendRun(log + index, packetLength, numPackets, offsetTable);
+        for (size_t i = 0; i < numPackets; ++i) { _rowOffsets.push_back(index + i * packetLength); }
+        index += numPackets * packetLength;
+    }
+}
+
+inline void ColumnarDecoder::_appendRun(const uint8_t* runStart, const size_t stride, const size_t numPackets,
+                                        const CompositeDataView::OffsetTable& offsetTable)
+{
+    const size_t firstRow = _rowOffsets.size();
+    const size_t numRows = firstRow + numPackets;
+    for (auto& col : _columns)
+    {
+        col._validity.resize((numRows + 63) / 64, 0);
+        const auto offset = offsetTable.offset(col._group, col._field);
+        for (size_t i = 0; i < col._components.size(); ++i)
+        {
+            auto& component = col._components[i];
+            component.resize(numRows * col._elementSize, 0);
+            if (!offset.has_value()) { continue; }
+            _gather(component.data() + firstRow * col._elementSize, runStart + *offset + i * col._elementSize, col._elementSize, stride, numPackets);
+        }
+        if (offset.has_value()) { _setValidRange(col._validity, firstRow, numRows); }
+    }
+}
+
+}  // namespace VN
+
+#endif  // DATAEXPORT_COLUMNARDECODER_HPP
@@ -32,6 +32,7 @@
 #include "HAL/Thread.hpp"
 #endif
 #include "Implementation/QueueDefinitions.hpp"
+#include "TemplateLibrary/ConsumerSignal.hpp"
 
 namespace VN
 {
@@ -39,7 +40,12 @@ namespace VN
 class Exporter
 {
 public:
-    Exporter(const size_t& packetCapacity) : _queue{packetCapacity} {}
+    Exporter(const size_t& packetCapacity) : _queue{packetCapacity}
+    {
+#if THREADING_ENABLE
+        _queue.setConsumerSignal(&_consumerSignal);
+#endif
+    }
 
     virtual ~Exporter() = default;
 
@@ -57,6 +63,7 @@ public:
     void stop()
     {
         _logging = false;
+        _consumerSignal.interrupt();
         _thread->join();
     }
 
@@ -70,13 +77,14 @@ protected:
 #if THREADING_ENABLE
     std::atomic<bool> _logging = false;
     std::unique_ptr<Thread> _thread = nullptr;
+    ConsumerSignal _consumerSignal{static_cast<size_t>(_queue.capacity() / Config::DataExport::wakeFillDivisor), Config::DataExport::wakeMaxLatency};
 
 private:
     void _export()
     {
         while (_logging)
         {
-            thisThread::sleepFor(1ms);
+            _consumerSignal.waitForBatch();
             exportToFile();
         }
         exportToFile();
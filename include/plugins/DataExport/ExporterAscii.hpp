@@ -25,6 +25,7 @@
 #define DATAEXPORT_EXPORTERASCII_HPP
 
 #include "Exporter.hpp"
+#include "OutputFileCache.hpp"
 #include "HAL/File.hpp"
 #include "Implementation/Packet.hpp"
 #include "Interface/Command.hpp"
@@ -33,10 +34,11 @@
 namespace VN
 {
 
+/// @brief Writes each unique ASCII message type to its own text file. There is no limit on the number of message types; beyond
+/// Config::DataExport::maxOpenFiles, the least recently written files are closed and reopened to append when next needed.
 class ExporterAscii : public Exporter
 {
 private:
-    static constexpr uint8_t MAX_NUM_FILES = 10;
     static constexpr uint16_t EXPORTER_PACKET_CAPACITY = 2048;
 
 public:
@@ -51,12 +53,6 @@ public:
 
     ~ExporterAscii() {}
 
-    struct AsciiInfo
-    {
-        AsciiHeader header;
-        OutputFile file;
-    };
-
     void exportToFile() override
     {
         while (!_queue.isEmpty())
@@ -64,12 +60,6 @@ public:
             const auto p = _queue.get();
             if (!p || (p->details.syncByte != PacketDetails::SyncByte::Ascii)) { continue; }
 
-            if (_asciiInfo.size() == _asciiInfo.capacity())
-            {
-                VN_DEBUG_1("Packet dropped.");
-                continue;
-            }
-
             OutputFile& ascii = getFileHandle(p->details.asciiMetadata.header);
 
             if (_enableSystemTimeStamps)
@@ -89,22 +79,16 @@ private:
     Filesystem::FilePath _filePath;
     const bool _enableSystemTimeStamps = false;
 
-    Vector<AsciiInfo, MAX_NUM_FILES> _asciiInfo;  // One entry per file created, which is per unique message
+    OutputFileCache<AsciiHeader, OutputFile> _asciiFiles;  // One file per unique message
 
     OutputFile& getFileHandle(const AsciiHeader& header)
     {
-        for (auto& tmp : _asciiInfo)
-        {
-            if (tmp.header == header) { return tmp.file; }
-        }
+        if (OutputFile* file = _asciiFiles.find(header)) { return *file; }
 
         // if we don't find the header we need to init a new text file
         AsciiMessage fileName = _filePath + header + ".txt";
 
-        // The size of this has already been checked
-        if (_asciiInfo.push_back(AsciiInfo{header, OutputFile(fileName)})) { VN_ABORT(); }
-
-        return _asciiInfo.back().file;
+        return _asciiFiles.insert(header, fileName, OutputFile());
     }
 };
 
@@ -0,0 +1,376 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef DATAEXPORT_EXPORTERCOLUMNAR_HPP
+#define DATAEXPORT_EXPORTERCOLUMNAR_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Config.hpp"
+#include "Debug.hpp"
+#include "Exporter.hpp"
+#include "ExporterCsvUtils.hpp"
+#include "OutputFileCache.hpp"
+#include "HAL/File.hpp"
+#include "Implementation/BinaryHeader.hpp"
+#include "Implementation/Packet.hpp"
+
+namespace VN
+{
+
+/// @brief Writes each unique FA message type to its own binary file of typed columns, one column per measurement component, so the data can be
+/// memory-mapped and used without parsing. Column types and names come from the same tables as ExporterCsv. SatInfo and RawMeas are variable-length and
+/// are left to ExporterCsv.
+///
+/// Rows are buffered per message type and written out as a row group every rowGroupRows rows, on flush(), and when the exporter is destroyed. All values
+/// are little-endian and every column chunk starts 8-byte aligned within the file. A file is the magic "VNCOL001" followed by row groups, each of which is:
+///   - One chunk per column, in schema order: numRows contiguous values, zero-padded to a multiple of 8 bytes.
+///   - A schema footer:
+///     - uint64 dataLength (bytes of column chunks before the footer), uint32 numRows, uint16 numColumns, uint16 reserved.
+///     - Per column: uint64 offset (from the start of the row group), uint8 group, uint8 field, uint8 component, uint8 ColumnType, uint8 elementSize,
+///       uint8 nameLength, the name, zero-padded to a multiple of 8 bytes.
+///     - uint32 footerLength (bytes of the whole footer), uint32 ROW_GROUP_MAGIC.
+/// A reader walks the row groups from the end of the file, as each footer gives the size of its row group.
+class ExporterColumnar : public Exporter
+{
+private:
+    static constexpr uint16_t EXPORTER_PACKET_CAPACITY = 2048;
+    static constexpr uint8_t TIMESTAMP_GROUP = 0xFF;  // Group of the systemTimeStamp column, which is not a measurement
+
+public:
+    enum class ColumnType : uint8_t
+    {
+        U8 = 0,
+        U16 = 1,
+        U32 = 2,
+        U64 = 3,
+        I8 = 4,
+        I64 = 5,
+        F32 = 6,
+        F64 = 7,
+    };
+
+    static constexpr char FILE_MAGIC[8] = {'V', 'N', 'C', 'O', 'L', '0', '0', '1'};
+    static constexpr uint32_t ROW_GROUP_MAGIC = 0x47524E56;  // "VNRG"
+
+    ExporterColumnar(const Filesystem::FilePath& outputDir, bool enableSystemTimeStamps = false,
+                     uint32_t rowGroupRows = Config::DataExport::columnarRowGroupRows)
+        : Exporter(EXPORTER_PACKET_CAPACITY), _filePath(outputDir), _enableSystemTimeStamps(enableSystemTimeStamps), _rowGroupRows(rowGroupRows)
+    {
+        if (!_filePath.empty() && _filePath.to_string().back() != std::filesystem::path::preferred_separator)
+        {
+            _filePath = _filePath + std::filesystem::path::preferred_separator;
+        }
+    }
+
+    ~ExporterColumnar() { flush(); }
+
+    void exportToFile() override
+    {
+        while (!_queue.isEmpty())
+        {
+            const auto p = _queue.get();
+            if (!p) { return; }
+            if (p->details.syncByte != PacketDetails::SyncByte::FA) { continue; }
+
+            const BinaryHeader& header = p->details.faMetadata.header;
+            _Stream& stream = _getStream(header);
+            if (!stream.isDecodable || _appendRow(stream, *p)) { continue; }
+            if (++stream.numRows == _rowGroupRows) { _writeRowGroup(header, stream); }
+        }
+    }
+
+    /// @brief Writes out the rows buffered so far for every message type, each as a row group of its own.
+    void flush()
+    {
+        for (auto& [header, stream] : _streams)
+        {
+            if (stream.numRows != 0) { _writeRowGroup(header, stream); }
+        }
+    }
+
+private:
+    struct _Column
+    {
+        uint8_t group;
+        uint8_t field;
+        uint8_t component;
+        ColumnType type;
+        uint8_t elementSize;
+        const char* name;  // Points into the static measurement names, so is not null-terminated
+        uint8_t nameLength;
+        std::unique_ptr<uint8_t[]> data;
+    };
+
+    /// @brief How to read one measurement out of a packet's payload.
+    struct _Step
+    {
+        enum class Kind : uint8_t
+        {
+            Copy,     // One value into each of count columns, starting at firstColumn
+            Skip,     // count bytes with no column
+            SatInfo,  // Variable-length, skipped
+            RawMeas,  // Variable-length, skipped
+        } kind;
+        uint16_t count;
+        uint16_t firstColumn;
+    };
+
+    struct _Stream
+    {
+        std::vector<_Column> columns;
+        std::vector<_Step> steps;
+        uint32_t numRows = 0;
+        bool isDecodable = true;
+    };
+
+    Filesystem::FilePath _filePath;
+    const bool _enableSystemTimeStamps = false;
+    const uint32_t _rowGroupRows;
+
+    std::unordered_map<BinaryHeader, _Stream> _streams;  // One per unique message type
+    OutputFileCache<BinaryHeader, OutputFile> _files;
+
+    _Stream& _getStream(const BinaryHeader& header)
+    {
+        const auto iter = _streams.find(header);
+        if (iter != _streams.end()) { return iter->second; }
+
+        _Stream& stream = _streams[header];
+        if (_enableSystemTimeStamps) { _addColumn(stream, TIMESTAMP_GROUP, 0, ColumnType::I64, "systemTimeStamp", 1); }
+
+        BinaryHeaderIterator headerIter(header);
+        while (headerIter.next())
+        {
+            const uint8_t group = headerIter.group();
+            const uint8_t field = headerIter.field();
+            const auto typeInfo = csvTypeLookup(group, field);
+            switch (typeInfo.type)
+            {
+                case CsvType::U8:
+                    _addColumn(stream, group, field, ColumnType::U8, getMeasurementName(group, field), typeInfo.len);
+                    break;
+                case CsvType::U16:
+                    _addColumn(stream, group, field, ColumnType::U16, getMeasurementName(group, field), typeInfo.len);
+                    break;
+                case CsvType::U32:
+                    _addColumn(stream, group, field, ColumnType::U32, getMeasurementName(group, field), typeInfo.len);
+                    break;
+                case CsvType::U64:
+                    _addColumn(stream, group, field, ColumnType::U64, getMeasurementName(group, field), typeInfo.len);
+                    break;
+                case CsvType::FLO:
+                    _addColumn(stream, group, field, ColumnType::F32, getMeasurementName(group, field), typeInfo.len);
+                    break;
+                case CsvType::DUB:
+                    _addColumn(stream, group, field, ColumnType::F64, getMeasurementName(group, field), typeInfo.len);
+                    break;
+                case CsvType::UTC:
+                {
+                    // Year, month, day, hour, minute, second, then fraction in ms, which splits into three runs of one type
+                    const char* names = getMeasurementName(group, field);
+                    const char* monthName = _skipNames(names, 1);
+                    const char* fracsecName = _skipNames(monthName, 5);
+                    _addColumn(stream, group, field, ColumnType::I8, names, 1);
+                    _addColumn(stream, group, field, ColumnType::U8, monthName, 5, 1);
+                    _addColumn(stream, group, field, ColumnType::U16, fracsecName, 1, 6);
+                    break;
+                }
+                case CsvType::UNK:
+                    stream.steps.push_back(_Step{_Step::Kind::Skip, typeInfo.len, 0});
+                    break;
+                case CsvType::SAT:
+                    stream.steps.push_back(_Step{_Step::Kind::SatInfo, 0, 0});
+                    break;
+                case CsvType::RAW:
+                    stream.steps.push_back(_Step{_Step::Kind::RawMeas, 0, 0});
+                    break;
+                default:
+                    VN_DEBUG_1("Unknown measurement type, message type not exported.");
+                    stream.isDecodable = false;
+                    return stream;
+            }
+        }
+
+        Filesystem::FilePath fileName;
+        const int fileNameLength =
+            std::snprintf(fileName.begin(), fileName.capacity(), "%sFA%s.col", _filePath.c_str(), binaryHeaderToString<64>(header).c_str());
+        if (fileNameLength >= static_cast<int>(fileName.capacity()))
+        {
+            VN_DEBUG_1("Output path too long, message type not exported.");
+            stream.isDecodable = false;
+            return stream;
+        }
+        std::replace(fileName.begin(), fileName.end(), ',', '_');
+        _files.insert(header, fileName, OutputFile()).write(FILE_MAGIC, sizeof(FILE_MAGIC));
+        return stream;
+    }
+
+    /// @brief Adds count columns of one type for consecutive components of a measurement, taking their names from the comma-separated list.
+    void _addColumn(_Stream& stream, const uint8_t group, const uint8_t field, const ColumnType type, const char* names, const uint8_t count,
+                    const uint8_t firstComponent = 0)
+    {
+        const uint8_t elementSize = _elementSize(type);
+        const auto firstColumn = static_cast<uint16_t>(stream.columns.size());
+        for (uint8_t i = 0; i < count; ++i)
+        {
+            const char* nameEnd = std::strchr(names, ',');
+            if (nameEnd == nullptr) { nameEnd = names + std::strlen(names); }
+            stream.columns.push_back(_Column{group, field, static_cast<uint8_t>(firstComponent + i), type, elementSize, names,
+                                             static_cast<uint8_t>(nameEnd - names), std::make_unique<uint8_t[]>(_rowGroupRows * elementSize)});
+            if (*nameEnd == ',') { names = nameEnd + 1; }
+        }
+
+        if (group == TIMESTAMP_GROUP) { return; }  // Filled from the packet's metadata rather than its payload
+        if (firstComponent != 0) { stream.steps.back().count += count; }  // Continues the measurement, as for UTC
+        else { stream.steps.push_back(_Step{_Step::Kind::Copy, count, firstColumn}); }
+    }
+
+    static const char* _skipNames(const char* names, const uint8_t count)
+    {
+        for (uint8_t i = 0; i < count; ++i)
+        {
+            const char* comma = std::strchr(names, ',');
+            if (comma == nullptr) { break; }
+            names = comma + 1;
+        }
+        return names;
+    }
+
+    static uint8_t _elementSize(const ColumnType type)
+    {
+        switch (type)
+        {
+            case ColumnType::U8:
+            case ColumnType::I8:
+                return 1;
+            case ColumnType::U16:
+                return 2;
+            case ColumnType::U32:
+            case ColumnType::F32:
+                return 4;
+            default:
+                return 8;
+        }
+    }
+
+    /// @brief Copies the packet's values into row numRows of each column.
+    /// @return The packet is shorter than its header describes, so the row was not added.
+    bool _appendRow(_Stream& stream, const Packet& p) const
+    {
+        const uint8_t* src = p.buffer + 1 + p.details.faMetadata.header.size();
+        const uint8_t* const end = p.buffer + p.details.faMetadata.length - 2;  // Before the crc
+
+        _Column* column = stream.columns.data();
+        if (_enableSystemTimeStamps)
+        {
+            const int64_t timestamp = std::chrono::duration_cast<Nanoseconds>(p.details.faMetadata.timestamp.time_since_epoch()).count();
+            std::memcpy(column->data.get() + stream.numRows * sizeof(timestamp), &timestamp, sizeof(timestamp));
+        }
+
+        for (const auto& step : stream.steps)
+        {
+            switch (step.kind)
+            {
+                case _Step::Kind::Copy:
+                {
+                    for (column = &stream.columns[step.firstColumn]; column != &stream.columns[step.firstColumn] + step.count; ++column)
+                    {
+                        if (src + column->elementSize > end) { return true; }
+                        std::memcpy(column->data.get() + stream.numRows * column->elementSize, src, column->elementSize);
+                        src += column->elementSize;
+                    }
+                    break;
+                }
+                case _Step::Kind::Skip:
+                    src += step.count;
+                    break;
+                case _Step::Kind::SatInfo:
+                    if (src + 2 > end) { return true; }
+                    src += 2 + 8 * static_cast<size_t>(src[0]);  // numSats, reserved, then 8 bytes per satellite
+                    break;
+                case _Step::Kind::RawMeas:
+                    if (src + 12 > end) { return true; }
+                    src += 12 + 28 * static_cast<size_t>(src[10]);  // tow, week, numMeas, reserved, then 28 bytes per measurement
+                    break;
+            }
+        }
+        return src > end;
+    }
+
+    void _writeRowGroup(const BinaryHeader& header, _Stream& stream)
+    {
+        OutputFile* file = _files.find(header);
+        if (file == nullptr) { return; }
+
+        static constexpr char padding[8] = {};
+        std::vector<uint8_t> footer(16);
+        uint64_t dataLength = 0;
+        for (const auto& column : stream.columns)
+        {
+            const size_t size = stream.numRows * column.elementSize;
+            file->write(reinterpret_cast<const char*>(column.data.get()), size);
+            file->write(padding, _paddingTo8(size));
+
+            const size_t entry = footer.size();
+            footer.resize(entry + 14 + column.nameLength);
+            std::memcpy(&footer[entry], &dataLength, sizeof(dataLength));
+            footer[entry + 8] = column.group;
+            footer[entry + 9] = column.field;
+            footer[entry + 10] = column.component;
+            footer[entry + 11] = static_cast<uint8_t>(column.type);
+            footer[entry + 12] = column.elementSize;
+            footer[entry + 13] = column.nameLength;
+            std::memcpy(&footer[entry + 14], column.name, column.nameLength);
+            footer.resize(footer.size() + _paddingTo8(footer.size()), 0);
+
+            dataLength += size + _paddingTo8(size);
+        }
+
+        const uint32_t numRows = stream.numRows;
+        const uint16_t numColumns = static_cast<uint16_t>(stream.columns.size());
+        std::memcpy(&footer[0], &dataLength, sizeof(dataLength));
+        std::memcpy(&footer[8], &numRows, sizeof(numRows));
+        std::memcpy(&footer[12], &numColumns, sizeof(numColumns));
+
+        const uint32_t footerLength = static_cast<uint32_t>(footer.size() + 8);
+        footer.resize(footerLength);
+        std::memcpy(&footer[footerLength - 8], &footerLength, sizeof(footerLength));
+        std::memcpy(&footer[footerLength - 4], &ROW_GROUP_MAGIC, sizeof(ROW_GROUP_MAGIC));
+        file->write(reinterpret_cast<const char*>(footer.data()), footer.size());
+
+        stream.numRows = 0;
+    }
+
+    static size_t _paddingTo8(const size_t size) { return (8 - (size % 8)) % 8; }
+};
+
+}  // namespace VN
+
+#endif  // DATAEXPORT_EXPORTERCOLUMNAR_HPP
@@ -27,8 +27,15 @@
 
 #include <chrono>
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "Exporter.hpp"
+#include "BufferedOutputFile.hpp"
+#include "OutputFileCache.hpp"
 #include "HAL/File.hpp"
 #include "HAL/Duration.hpp"
 #include "Implementation/Packet.hpp"
@@ -40,166 +47,105 @@
 namespace VN
 {
 
+/// @brief Writes each unique message type to its own CSV file. Output is formatted directly into a per-file block of fileBufferCapacity bytes,
+/// which is written out when full, on flush(), or when the exporter is destroyed. There is no limit on the number of message types; beyond
+/// Config::DataExport::maxOpenFiles, the least recently written files are closed and reopened to append when next needed.
+///
+/// With more than one format worker, packets are handed out in chunks to a pool of threads which each format into private text. The exporting
+/// thread then writes the chunks out in the order the packets were received, so the files are identical to those written by a single thread.
 class ExporterCsv : public Exporter
 {
 private:
-    static constexpr uint8_t MAX_NUM_FILES = 4;
+    static constexpr uint8_t MAX_NUM_DYNAMIC_FILES = 4;  // SatInfo and RawMeas for each of the two GNSS groups
     static constexpr uint16_t EXPORTER_PACKET_CAPACITY = 2048;
     static constexpr uint16_t STRING_BUFFER_CAPACITY = 256;
+    static constexpr uint16_t CHUNK_PACKET_CAPACITY = 32;
+    static constexpr uint8_t CHUNKS_PER_WORKER = 2;
 
 public:
-    ExporterCsv(const Filesystem::FilePath& outputDir, bool enableSystemTimeStamps = false)
-        : Exporter(EXPORTER_PACKET_CAPACITY), _filePath(outputDir), _enableSystemTimeStamps(enableSystemTimeStamps)
+    ExporterCsv(const Filesystem::FilePath& outputDir, bool enableSystemTimeStamps = false, CsvNumberFormat numberFormat = CsvNumberFormat::Compatible,
+                size_t fileBufferCapacity = Config::DataExport::fileBufferCapacity, uint8_t numFormatWorkers = 1)
+        : Exporter(EXPORTER_PACKET_CAPACITY),
+          _filePath(outputDir),
+          _enableSystemTimeStamps(enableSystemTimeStamps),
+          _numberFormat(numberFormat),
+          _fileBufferCapacity(fileBufferCapacity)
     {
         if (!_filePath.empty() && _filePath.back() != std::filesystem::path::preferred_separator)
         {
             _filePath = _filePath + std::filesystem::path::preferred_separator;
         }
-    }
 
-    ~ExporterCsv() = default;
+        if (numFormatWorkers > 1)
+        {
+            for (size_t i = 0; i < numFormatWorkers * CHUNKS_PER_WORKER; ++i) { _chunks.push_back(std::make_unique<_Chunk>()); }
+            for (uint8_t i = 0; i < numFormatWorkers; ++i) { _workers.emplace_back(&ExporterCsv::_runWorker, this); }
+        }
+    }
 
-    struct CsvInfo
+    ~ExporterCsv()
     {
-        PacketDetails details;
-        OutputFile file;
-    };
+        {
+            std::lock_guard<std::mutex> lock(_workMutex);
+            _stopWorkers = true;
+        }
+        _workCv.notify_all();
+        for (auto& worker : _workers) { worker.join(); }
+    }
 
     struct DynamicCsvInfo
     {
         uint8_t measGroupNum;
         uint8_t measTypeNum;
-        OutputFile file;
+        BufferedOutputFile file;
     };
 
     void exportToFile() override
     {
+        if (!_workers.empty())
+        {
+            _exportParallel();
+            return;
+        }
+
         while (!_queue.isEmpty())
         {
             const auto p = _queue.get();
             if (!p) { return; }
 
-            if (_csvInfo.size() == _csvInfo.capacity())
-            {
-                VN_DEBUG_1("Packet dropped.");
-                continue;
-            }
-
-            OutputFile& csv = getFileHandle(p.get());
-            if (_enableSystemTimeStamps)
-            {
-                const auto timestamp =
-                    (p->details.syncByte == PacketDetails::SyncByte::Ascii) ? p->details.asciiMetadata.timestamp : p->details.faMetadata.timestamp;
-                const uint16_t num_bytes =
-                    std::snprintf(_tmpBuffer.data(), _tmpBuffer.size(), "%lld,",
-                                  static_cast<long long int>(std::chrono::duration_cast<Nanoseconds>(timestamp.time_since_epoch()).count()));
-                csv.write(_tmpBuffer.data(), num_bytes);
-            }
-
-            if (p->details.syncByte == PacketDetails::SyncByte::Ascii)
-            {
-                const size_t begin = p->details.asciiMetadata.delimiterIndices.front() + 1;
-                const size_t end = p->details.asciiMetadata.delimiterIndices.back();
-                csv.write(reinterpret_cast<const char*>(&p->buffer[begin]), end - begin);
-            }
-            else
-            {
-                OutputFile& csv = getFileHandle(p.get());
-                bool first_meas_of_line = true;
-                FaPacketExtractor extractor(p->buffer, p->details.faMetadata);
-                extractor.discard(p->details.faMetadata.header.size() + 1);
-
-                BinaryHeaderIterator iter(p->details.faMetadata.header);
-                while (iter.next())
-                {
-                    const auto typeInfo = csvTypeLookup(iter.group(), iter.field());
-                    if (!(typeInfo.type == CsvType::SAT || typeInfo.type == CsvType::RAW))
-                    {
-                        if (!first_meas_of_line) { csv.write(","); }
-                        first_meas_of_line = false;
-                        const uint16_t num_bytes = getMeasurementString(extractor, typeInfo, _tmpBuffer.data(), _tmpBuffer.size());
-                        csv.write(_tmpBuffer.data(), num_bytes);
-                    }
-                    else
-                    {
-                        OutputFile& dynamicCsv = getDynamicFileHandle(iter.group(), iter.field(), p->details.faMetadata.header);
-                        if (typeInfo.type == CsvType::SAT)
-                        {
-                            if (_enableSystemTimeStamps) { _writeTimestamp(dynamicCsv, p->details.faMetadata.timestamp); }
-
-                            const auto numSats = extractor.extract_unchecked<uint8_t>();
-                            int num_bytes = std::snprintf(_tmpBuffer.data(), _tmpBuffer.size(), "%u%s", numSats, (numSats == 0) ? "" : ",");
-                            dynamicCsv.write(_tmpBuffer.data(), num_bytes);
-
-                            extractor.discard(1);
-                            for (auto i = 0; i < GNSS_SAT_INFO_MAX_COUNT; i++)
-                            {
-                                if (i < numSats)
-                                {
-                                    num_bytes = getMeasurementString(extractor, typeInfo, _tmpBuffer.data(), _tmpBuffer.size());
-                                    dynamicCsv.write(_tmpBuffer.data(), num_bytes);
-                                    if (i < numSats - 1) { dynamicCsv.write(","); }
-                                }
-                                else { dynamicCsv.write(",0,0,0,0,0,0,0"); }
-                            }
-                            dynamicCsv.write("\n");
-                        }
-                        else
-                        {
-                            int offset = 0;
-                            if (_enableSystemTimeStamps)
-                            {
-                                offset +=
-                                    std::snprintf(_tmpBuffer.data(), _tmpBuffer.size(), "%lld,",
-                                                  static_cast<long long int>(
-                                                      std::chrono::duration_cast<Nanoseconds>(p->details.faMetadata.timestamp.time_since_epoch()).count()));
-                            }
-                            offset += extractToString<double>(extractor, 1, _tmpBuffer.data() + offset, _tmpBuffer.size());
-                            offset += std::snprintf(_tmpBuffer.data() + offset, _tmpBuffer.size() - offset, ",");
-
-                            offset += extractToString<uint16_t>(extractor, 1, _tmpBuffer.data() + offset, _tmpBuffer.size() - offset);
-                            offset += std::snprintf(_tmpBuffer.data() + offset, _tmpBuffer.size() - offset, ",");
-
-                            const auto numSats = extractor.extract_unchecked<uint8_t>();
-                            offset += std::snprintf(_tmpBuffer.data() + offset, _tmpBuffer.size() - offset, "%u,", numSats);
-
-                            extractor.discard(1);
-
-                            for (auto i = 0; i < numSats; i++)
-                            {
-                                const uint16_t num_bytes = getMeasurementString(extractor, typeInfo, _tmpBuffer.data() + offset, _tmpBuffer.size());
-                                dynamicCsv.write(_tmpBuffer.data(), offset + num_bytes);
-                                dynamicCsv.write("\n");
-                            }
-                        }
-                    }
-                }
-            }
-            csv.write("\n");
+            _FileSink sink{*this, getFileHandle(p.get()), *p};
+            _formatPacket(*p, sink, _tmpBuffer);
         }
     }
 
+    /// @brief Writes out everything formatted so far to every open file.
+    void flush()
+    {
+        _csvFiles.forEachOpen([](BufferedOutputFile& file) { file.flush(); });
+        for (auto& dynamicCsvInfo : _dynamicCsvInfo) { dynamicCsvInfo.file.flush(); }
+    }
+
 private:
-    void init_csv(CsvInfo& csvInfo, const Packet* p)
+    void init_csv(BufferedOutputFile& file, const Packet* p)
     {
-        if (_enableSystemTimeStamps) { csvInfo.file.write("systemTimeStamp,"); }
+        if (_enableSystemTimeStamps) { file.write("systemTimeStamp,"); }
 
-        if (csvInfo.details.syncByte == PacketDetails::SyncByte::Ascii)
+        if (p->details.syncByte == PacketDetails::SyncByte::Ascii)
         {
-            const AsciiPacketProtocol::AsciiMeasurementHeader asciiHeader = AsciiPacketProtocol::getMeasHeader(csvInfo.details.asciiMetadata.header);
-            csvInfo.file.write(getMeasurementString(asciiHeader));
+            const AsciiPacketProtocol::AsciiMeasurementHeader asciiHeader = AsciiPacketProtocol::getMeasHeader(p->details.asciiMetadata.header);
+            file.write(getMeasurementString(asciiHeader));
 
             if (std::find(&p->buffer[7], &p->buffer[p->details.asciiMetadata.length], 'S') != &p->buffer[p->details.asciiMetadata.length])
             {
-                csvInfo.file.write(",appendStatus");
+                file.write(",appendStatus");
             }
 
             if (std::find(&p->buffer[7], &p->buffer[p->details.asciiMetadata.length], 'T') != &p->buffer[p->details.asciiMetadata.length])
             {
-                csvInfo.file.write(",appendCount");
+                file.write(",appendCount");
             }
 
-            csvInfo.file.write("\n");
+            file.write("\n");
         }
         else
         {
@@ -211,11 +157,11 @@ private:
                 const auto typeInfo = csvTypeLookup(iter.group(), iter.field());
                 if ((typeInfo.type == CsvType::SAT || typeInfo.type == CsvType::RAW)) { continue; }
 
-                if (!firstMeas) { csvInfo.file.write(","); }
+                if (!firstMeas) { file.write(","); }
                 firstMeas = false;
-                csvInfo.file.write(getMeasurementName(iter.group(), iter.field()));
+                file.write(getMeasurementName(iter.group(), iter.field()));
             }
-            csvInfo.file.write("\n");
+            file.write("\n");
         }
     }
 
@@ -259,47 +205,358 @@ private:
         dynamicCsvInfo.file.write(_tmpBuffer.data(), num_chars);
     }
 
-    void _writeTimestamp(OutputFile& file, time_point timestamp)
+    // Keys files by the header of the packet's ASCII or binary message
+    struct _HeaderHash
+    {
+        size_t operator()(const PacketDetails& details) const noexcept
+        {
+            if (details.syncByte == PacketDetails::SyncByte::Ascii) { return std::hash<AsciiHeader>{}(details.asciiMetadata.header); }
+            return std::hash<BinaryHeader>{}(details.faMetadata.header);
+        }
+    };
+
+    struct _HeaderEqual
+    {
+        bool operator()(const PacketDetails& lhs, const PacketDetails& rhs) const noexcept
+        {
+            const bool isAscii = (lhs.syncByte == PacketDetails::SyncByte::Ascii);
+            if (isAscii != (rhs.syncByte == PacketDetails::SyncByte::Ascii)) { return false; }
+            return isAscii ? (lhs.asciiMetadata.header == rhs.asciiMetadata.header) : (lhs.faMetadata.header == rhs.faMetadata.header);
+        }
+    };
+
+    // Outputs for _formatPacket which write straight to the files, as the serial path does
+    struct _FileSink
     {
-        const uint16_t num_bytes = std::snprintf(_tmpBuffer.data(), _tmpBuffer.size(), "%lld,",
-                                                 static_cast<long long int>(std::chrono::duration_cast<Nanoseconds>(timestamp.time_since_epoch()).count()));
-        file.write(_tmpBuffer.data(), num_bytes);
+        ExporterCsv& exporter;
+        BufferedOutputFile& file;
+        const Packet& packet;
+
+        BufferedOutputFile& main() { return file; }
+        BufferedOutputFile& dynamic(const uint8_t group, const uint8_t field)
+        {
+            return exporter.getDynamicFileHandle(group, field, packet.details.faMetadata.header);
+        }
+    };
+
+    /// @brief A run of packets handed to a format worker, and the text formatted for them. The text is split into segments tagged with the
+    /// packet and file they belong to, in the order they were formatted.
+    struct _Chunk
+    {
+        static constexpr uint8_t MAIN_FILE = 0xFF;  // Segment group marking the packet's own file
+
+        struct Segment
+        {
+            uint16_t packetIndex;
+            uint8_t group;
+            uint8_t field;
+            size_t begin;
+            size_t end;
+        };
+
+        std::array<PacketQueue_Interface::OwningPtr, CHUNK_PACKET_CAPACITY> packets;
+        uint16_t numPackets = 0;
+        std::unique_ptr<char[]> text = nullptr;
+        size_t textSize = 0;
+        size_t textCapacity = 0;
+        std::vector<Segment> segments;
+        bool done = false;  // Guarded by _workMutex
+
+        /// @brief Makes room for count more bytes of text, returning where they go.
+        char* reserve(const size_t count)
+        {
+            if (textSize + count > textCapacity)
+            {
+                const size_t newCapacity = std::max({textCapacity * 2, textSize + count, Config::DataExport::fileBufferCapacity});
+                auto newText = std::make_unique<char[]>(newCapacity);
+                if (textSize != 0) { std::memcpy(newText.get(), text.get(), textSize); }
+                text = std::move(newText);
+                textCapacity = newCapacity;
+            }
+            return text.get() + textSize;
+        }
+
+        /// @brief Accepts count bytes written at reserve() as belonging to the given packet and file.
+        void commit(const uint16_t packetIndex, const uint8_t group, const uint8_t field, const size_t count)
+        {
+            if (segments.empty() || segments.back().packetIndex != packetIndex || segments.back().group != group || segments.back().field != field)
+            {
+                segments.push_back(Segment{packetIndex, group, field, textSize, textSize});
+            }
+            textSize += count;
+            segments.back().end = textSize;
+        }
+    };
+
+    // An output of _formatPacket which appends to a chunk's text
+    struct _ChunkStream
+    {
+        _Chunk& chunk;
+        uint16_t packetIndex;
+        uint8_t group;
+        uint8_t field;
+
+        char* reserve(const size_t count) { return chunk.reserve(count); }
+        void commit(const size_t count) { chunk.commit(packetIndex, group, field, count); }
+        void write(const char* buffer, const size_t count)
+        {
+            std::memcpy(chunk.reserve(count), buffer, count);
+            commit(count);
+        }
+        void write(const char* buffer) { write(buffer, std::strlen(buffer)); }
+    };
+
+    struct _ChunkSink
+    {
+        _Chunk& chunk;
+        uint16_t packetIndex;
+
+        _ChunkStream main() { return _ChunkStream{chunk, packetIndex, _Chunk::MAIN_FILE, 0}; }
+        _ChunkStream dynamic(const uint8_t group, const uint8_t field)
+        {
+            // The serial path opens the dynamic file even if nothing is written to it, so record the visit
+            chunk.commit(packetIndex, group, field, 0);
+            return _ChunkStream{chunk, packetIndex, group, field};
+        }
+    };
+
+    void _runWorker()
+    {
+        std::array<char, STRING_BUFFER_CAPACITY> tmpBuffer;
+        while (true)
+        {
+            _Chunk* chunk;
+            {
+                std::unique_lock<std::mutex> lock(_workMutex);
+                _workCv.wait(lock, [this] { return _stopWorkers || !_pendingChunks.empty(); });
+                if (_pendingChunks.empty()) { return; }
+                chunk = _pendingChunks.front();
+                _pendingChunks.pop_front();
+            }
+
+            for (uint16_t i = 0; i < chunk->numPackets; ++i)
+            {
+                _ChunkSink sink{*chunk, i};
+                _formatPacket(*chunk->packets[i], sink, tmpBuffer);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_workMutex);
+                chunk->done = true;
+            }
+            _doneCv.notify_one();
+        }
     }
 
-    OutputFile& getFileHandle(const Packet* p)
+    /// @brief Keeps every chunk in the ring either being formatted or waiting to be written, writing them out oldest first.
+    void _exportParallel()
     {
-        Filesystem::FilePath fileName;
-        if (p->details.syncByte == PacketDetails::SyncByte::Ascii)
+        const size_t ringSize = _chunks.size();
+        size_t oldest = 0;
+        size_t numInFlight = 0;
+        while (true)
         {
-            for (auto& tmp : _csvInfo)
+            while (numInFlight < ringSize)
             {
-                if (tmp.details.syncByte == PacketDetails::SyncByte::Ascii && p->details.asciiMetadata.header == tmp.details.asciiMetadata.header)
+                _Chunk& chunk = *_chunks[(oldest + numInFlight) % ringSize];
+                chunk.numPackets = _queue.getMany(chunk.packets.data(), CHUNK_PACKET_CAPACITY);
+                if (chunk.numPackets == 0) { break; }
+                chunk.textSize = 0;
+                chunk.segments.clear();
                 {
-                    return tmp.file;
+                    std::lock_guard<std::mutex> lock(_workMutex);
+                    chunk.done = false;
+                    _pendingChunks.push_back(&chunk);
                 }
+                _workCv.notify_one();
+                ++numInFlight;
             }
-            std::snprintf(fileName.begin(), fileName.capacity(), "%s%s.csv", _filePath.c_str(), p->details.asciiMetadata.header.c_str());
+            if (numInFlight == 0) { return; }
+
+            _Chunk& chunk = *_chunks[oldest];
+            {
+                std::unique_lock<std::mutex> lock(_workMutex);
+                _doneCv.wait(lock, [&chunk] { return chunk.done; });
+            }
+            _writeChunk(chunk);
+            oldest = (oldest + 1) % ringSize;
+            --numInFlight;
+        }
+    }
+
+    void _writeChunk(_Chunk& chunk)
+    {
+        auto segment = chunk.segments.cbegin();
+        for (uint16_t i = 0; i < chunk.numPackets; ++i)
+        {
+            const Packet* p = chunk.packets[i].get();
+            BufferedOutputFile& csv = getFileHandle(p);
+
+            for (; segment != chunk.segments.cend() && segment->packetIndex == i; ++segment)
+            {
+                BufferedOutputFile& file =
+                    (segment->group == _Chunk::MAIN_FILE) ? csv : getDynamicFileHandle(segment->group, segment->field, p->details.faMetadata.header);
+                file.write(chunk.text.get() + segment->begin, segment->end - segment->begin);
+            }
+            chunk.packets[i] = nullptr;  // Frees the queue slot
+        }
+    }
+
+    /// @brief Formats one packet into the sink: its line in the packet's own file, and any SatInfo or RawMeas lines in the dynamic files. The
+    /// serial and parallel paths both go through here, so they produce the same bytes.
+    template <class Sink>
+    void _formatPacket(const Packet& p, Sink& sink, std::array<char, STRING_BUFFER_CAPACITY>& tmpBuffer) const
+    {
+        auto&& csv = sink.main();
+        if (_enableSystemTimeStamps)
+        {
+            const auto timestamp =
+                (p.details.syncByte == PacketDetails::SyncByte::Ascii) ? p.details.asciiMetadata.timestamp : p.details.faMetadata.timestamp;
+            _writeTimestamp(csv, timestamp, tmpBuffer);
+        }
+
+        if (p.details.syncByte == PacketDetails::SyncByte::Ascii)
+        {
+            const size_t begin = p.details.asciiMetadata.delimiterIndices.front() + 1;
+            const size_t end = p.details.asciiMetadata.delimiterIndices.back();
+            csv.write(reinterpret_cast<const char*>(&p.buffer[begin]), end - begin);
         }
         else
         {
-            for (auto& tmp : _csvInfo)
+            bool first_meas_of_line = true;
+            FaPacketExtractor extractor(p.buffer, p.details.faMetadata);
+            extractor.discard(p.details.faMetadata.header.size() + 1);
+
+            BinaryHeaderIterator iter(p.details.faMetadata.header);
+            while (iter.next())
             {
-                if (tmp.details.syncByte == PacketDetails::SyncByte::FA && p->details.faMetadata.header == tmp.details.faMetadata.header) { return tmp.file; }
+                const auto typeInfo = csvTypeLookup(iter.group(), iter.field());
+                if (!(typeInfo.type == CsvType::SAT || typeInfo.type == CsvType::RAW))
+                {
+                    if (!first_meas_of_line) { csv.write(",", 1); }
+                    first_meas_of_line = false;
+                    _writeMeasurement(csv, extractor, typeInfo, tmpBuffer);
+                }
+                else
+                {
+                    auto&& dynamicCsv = sink.dynamic(iter.group(), iter.field());
+                    if (typeInfo.type == CsvType::SAT)
+                    {
+                        if (_enableSystemTimeStamps) { _writeTimestamp(dynamicCsv, p.details.faMetadata.timestamp, tmpBuffer); }
+
+                        const auto numSats = extractor.extract_unchecked<uint8_t>();
+                        char* const end = CsvFormat::toChars(tmpBuffer.data(), tmpBuffer.data() + tmpBuffer.size(), numSats);
+                        if (end != nullptr) { dynamicCsv.write(tmpBuffer.data(), end - tmpBuffer.data()); }
+                        if (numSats != 0) { dynamicCsv.write(",", 1); }
+
+                        extractor.discard(1);
+                        for (auto i = 0; i < GNSS_SAT_INFO_MAX_COUNT; i++)
+                        {
+                            if (i < numSats)
+                            {
+                                _writeMeasurement(dynamicCsv, extractor, typeInfo, tmpBuffer);
+                                if (i < numSats - 1) { dynamicCsv.write(",", 1); }
+                            }
+                            else { dynamicCsv.write(",0,0,0,0,0,0,0"); }
+                        }
+                        dynamicCsv.write("\n", 1);
+                    }
+                    else
+                    {
+                        // Every satellite line repeats the same prefix, so it is formatted once. Any step returns nullptr if the prefix does not fit.
+                        char* const last = tmpBuffer.data() + tmpBuffer.size();
+                        char* head = tmpBuffer.data();
+                        if (_enableSystemTimeStamps) { head += _timestampToString(p.details.faMetadata.timestamp, head, last - head); }
+                        head += extractToString<double>(extractor, 1, head, last - head, _numberFormat);
+                        head = CsvFormat::append(head, last, ',');
+
+                        const auto week = extractor.extract_unchecked<uint16_t>();
+                        if (head != nullptr) { head = CsvFormat::toChars(head, last, week, _numberFormat); }
+                        if (head != nullptr) { head = CsvFormat::append(head, last, ','); }
+
+                        const auto numSats = extractor.extract_unchecked<uint8_t>();
+                        if (head != nullptr) { head = CsvFormat::toChars(head, last, numSats); }
+                        if (head != nullptr) { head = CsvFormat::append(head, last, ','); }
+
+                        extractor.discard(1);
+
+                        for (auto i = 0; i < numSats; i++)
+                        {
+                            if (head == nullptr)
+                            {
+                                // The satellite is still extracted, to keep the following fields aligned, but not written
+                                getMeasurementString(extractor, typeInfo, tmpBuffer.data(), tmpBuffer.size(), _numberFormat);
+                                continue;
+                            }
+                            const int offset = static_cast<int>(head - tmpBuffer.data());
+                            const uint16_t num_bytes =
+                                getMeasurementString(extractor, typeInfo, tmpBuffer.data() + offset, tmpBuffer.size() - offset, _numberFormat);
+                            dynamicCsv.write(tmpBuffer.data(), offset + num_bytes);
+                            dynamicCsv.write("\n", 1);
+                        }
+                    }
+                }
             }
-            std::snprintf(fileName.begin(), fileName.capacity(), "%sFA%s.csv", _filePath.c_str(),
-                          binaryHeaderToString<64>(p->details.faMetadata.header).c_str());
-            std::replace(fileName.begin(), fileName.end(), ',', '_');
         }
+        csv.write("\n", 1);
+    }
 
-        if (_csvInfo.push_back(CsvInfo{p->details, OutputFile(fileName)})) { VN_ABORT(); }
-        // if we don't find the header we need to init a new csv
+    /// @brief Formats the timestamp in nanoseconds followed by a comma.
+    /// @return The number of characters written.
+    static int _timestampToString(const time_point timestamp, char* ptr, const uint16_t remaining)
+    {
+        const auto nanoseconds = static_cast<long long int>(std::chrono::duration_cast<Nanoseconds>(timestamp.time_since_epoch()).count());
+        char* end = CsvFormat::toChars(ptr, ptr + remaining, nanoseconds);
+        end = (end == nullptr) ? nullptr : CsvFormat::append(end, ptr + remaining, ',');
+        return (end == nullptr) ? 0 : static_cast<int>(end - ptr);
+    }
 
-        init_csv(_csvInfo.back(), p);
+    template <class Output>
+    static void _writeTimestamp(Output& file, time_point timestamp, std::array<char, STRING_BUFFER_CAPACITY>& tmpBuffer)
+    {
+        char* ptr = file.reserve(tmpBuffer.size());
+        if (ptr == nullptr) { file.write(tmpBuffer.data(), _timestampToString(timestamp, tmpBuffer.data(), tmpBuffer.size())); }
+        else { file.commit(_timestampToString(timestamp, ptr, tmpBuffer.size())); }
+    }
 
-        return _csvInfo.back().file;
+    /// @brief Formats the next measurement straight into the output's block, avoiding a copy through tmpBuffer when there is room.
+    template <class Output>
+    void _writeMeasurement(Output& file, FaPacketExtractor& extractor, const CsvTypeInfo& typeInfo, std::array<char, STRING_BUFFER_CAPACITY>& tmpBuffer) const
+    {
+        char* ptr = file.reserve(tmpBuffer.size());
+        if (ptr == nullptr) { file.write(tmpBuffer.data(), getMeasurementString(extractor, typeInfo, tmpBuffer.data(), tmpBuffer.size(), _numberFormat)); }
+        else { file.commit(getMeasurementString(extractor, typeInfo, ptr, tmpBuffer.size(), _numberFormat)); }
     }
 
-    OutputFile& getDynamicFileHandle(const uint8_t measGroupNum, const uint8_t measTypeNum, const BinaryHeader& header)
+    BufferedOutputFile& getFileHandle(const Packet* p)
+    {
+        if (BufferedOutputFile* file = _csvFiles.find(p->details)) { return *file; }
+
+        // if we don't find the header we need to init a new csv
+        Filesystem::FilePath fileName;
+        int fileNameLength = 0;
+        if (p->details.syncByte == PacketDetails::SyncByte::Ascii)
+        {
+            fileNameLength = std::snprintf(fileName.begin(), fileName.capacity(), "%s%s.csv", _filePath.c_str(), p->details.asciiMetadata.header.c_str());
+        }
+        else
+        {
+            fileNameLength = std::snprintf(fileName.begin(), fileName.capacity(), "%sFA%s.csv", _filePath.c_str(),
+                                           binaryHeaderToString<64>(p->details.faMetadata.header).c_str());
+            std::replace(fileName.begin(), fileName.end(), ',', '_');
+        }
+        if (fileNameLength >= static_cast<int>(fileName.capacity()))
+        {
+            VN_DEBUG_1("Output path too long for " + fileName);
+            VN_ABORT();
+        }
+
+        BufferedOutputFile& file = _csvFiles.insert(p->details, fileName, BufferedOutputFile(_fileBufferCapacity));
+        init_csv(file, p);
+        return file;
+    }
+
+    BufferedOutputFile& getDynamicFileHandle(const uint8_t measGroupNum, const uint8_t measTypeNum, const BinaryHeader& header)
     {
         for (auto& tmp : _dynamicCsvInfo)
         {
@@ -311,18 +568,26 @@ private:
         Filesystem::FilePath fileName;
         const char gnss_num = measGroupNum == 3 ? '1' : '2';
 
+        int fileNameLength = 0;
         if (typeInfo.type == CsvType::SAT)
         {
-            std::snprintf(fileName.begin(), fileName.capacity(), "%sFA%s_SatInfo%c.csv", _filePath.c_str(), binaryHeaderToString<64>(header).c_str(), gnss_num);
+            fileNameLength = std::snprintf(fileName.begin(), fileName.capacity(), "%sFA%s_SatInfo%c.csv", _filePath.c_str(),
+                                           binaryHeaderToString<64>(header).c_str(), gnss_num);
         }
         else if (typeInfo.type == CsvType::RAW)
         {
-            std::snprintf(fileName.begin(), fileName.capacity(), "%sFA%s_RawMeas%c.csv", _filePath.c_str(), binaryHeaderToString<64>(header).c_str(), gnss_num);
+            fileNameLength = std::snprintf(fileName.begin(), fileName.capacity(), "%sFA%s_RawMeas%c.csv", _filePath.c_str(),
+                                           binaryHeaderToString<64>(header).c_str(), gnss_num);
         }
         else { VN_ABORT(); }
+        if (fileNameLength >= static_cast<int>(fileName.capacity()))
+        {
+            VN_DEBUG_1("Output path too long for " + fileName);
+            VN_ABORT();
+        }
         std::replace(fileName.begin(), fileName.end(), ',', '_');
 
-        if (_dynamicCsvInfo.push_back(DynamicCsvInfo{measGroupNum, measTypeNum, OutputFile(fileName)})) { VN_ABORT(); }
+        if (_dynamicCsvInfo.push_back(DynamicCsvInfo{measGroupNum, measTypeNum, BufferedOutputFile(fileName, _fileBufferCapacity)})) { VN_ABORT(); }
 
         init_dynamic_csv(_dynamicCsvInfo.back(), measGroupNum, measTypeNum);
         return _dynamicCsvInfo.back().file;
@@ -331,10 +596,21 @@ private:
 private:
     Filesystem::FilePath _filePath;
     const bool _enableSystemTimeStamps = false;
+    const CsvNumberFormat _numberFormat = CsvNumberFormat::Compatible;
+    const size_t _fileBufferCapacity = Config::DataExport::fileBufferCapacity;
     std::array<char, STRING_BUFFER_CAPACITY> _tmpBuffer;
 
-    Vector<CsvInfo, MAX_NUM_FILES> _csvInfo;                // One entry per file created, which is per unique message type
-    Vector<DynamicCsvInfo, MAX_NUM_FILES> _dynamicCsvInfo;  // One entry per file created, which is per unique message type
+    OutputFileCache<PacketDetails, BufferedOutputFile, _HeaderHash, _HeaderEqual> _csvFiles;  // One file per unique message type
+    Vector<DynamicCsvInfo, MAX_NUM_DYNAMIC_FILES> _dynamicCsvInfo;                             // One entry per file created, which is per unique message type
+
+    // Parallel formatting, only used with more than one format worker
+    std::vector<std::unique_ptr<_Chunk>> _chunks;  // Ring of chunks, written out in order
+    std::vector<std::thread> _workers;
+    std::mutex _workMutex;
+    std::condition_variable _workCv;  // Signals workers that a chunk is pending
+    std::condition_variable _doneCv;  // Signals the exporting thread that a chunk is formatted
+    std::deque<_Chunk*> _pendingChunks;
+    bool _stopWorkers = false;
 };
 
 }  // namespace VN
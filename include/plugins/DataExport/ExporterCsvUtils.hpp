@@ -26,6 +26,10 @@
 
 #include <string>
 #include <stdint.h>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
 #include "Implementation/FaPacketProtocol.hpp"
 #include "Implementation/AsciiPacketProtocol.hpp"
 
@@ -57,27 +61,118 @@ struct CsvTypeInfo
 
 CsvTypeInfo csvTypeLookup(size_t i, size_t j);
 
+/// @brief How numeric CSV fields are rendered.
+enum class CsvNumberFormat : uint8_t
+{
+    Compatible,         ///< Byte-identical to the historical printf output: "%f" for float, "%12.8f" for double, "%d" below 64 bits, "%llu" for uint64.
+    ShortestRoundTrip,  ///< The shortest text which parses back to the same value. Unsigned 32 bit values are no longer printed as signed.
+};
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define VN_CSV_FLOAT_TO_CHARS 1
+#else
+#define VN_CSV_FLOAT_TO_CHARS 0  // Toolchains without floating point std::to_chars fall back to snprintf with the same output
+#endif
+
+namespace CsvFormat
+{
+
+constexpr uint8_t compatibleDoubleWidth = 12;
+
+template <class T>
+char* _floatToChars(char* first, char* last, const T value, const CsvNumberFormat format) noexcept
+{
+    if (format == CsvNumberFormat::ShortestRoundTrip)
+    {
+#if VN_CSV_FLOAT_TO_CHARS
+        const auto result = std::to_chars(first, last, value);
+        return result.ec == std::errc() ? result.ptr : nullptr;
+#else
+        const int length = std::snprintf(first, last - first, std::is_same_v<T, float> ? "%.9g" : "%.17g", static_cast<double>(value));
+        return (length < 0 || length >= last - first) ? nullptr : first + length;
+#endif
+    }
+
+#if VN_CSV_FLOAT_TO_CHARS
+    const auto result = std::to_chars(first, last, static_cast<double>(value), std::chars_format::fixed, std::is_same_v<T, float> ? 6 : 8);
+    if (result.ec != std::errc()) { return nullptr; }
+    const ptrdiff_t length = result.ptr - first;
+    if constexpr (std::is_same_v<T, float>) { return result.ptr; }
+    else
+    {
+        if (length >= compatibleDoubleWidth) { return result.ptr; }
+        if (last - first < compatibleDoubleWidth) { return nullptr; }
+        // Right-align as "%12.8f" does
+        const ptrdiff_t padding = compatibleDoubleWidth - length;
+        std::memmove(first + padding, first, length);
+        std::memset(first, ' ', padding);
+        return first + compatibleDoubleWidth;
+    }
+#else
+    const int length = std::snprintf(first, last - first, std::is_same_v<T, float> ? "%f" : "%12.8f", static_cast<double>(value));
+    return (length < 0 || length >= last - first) ? nullptr : first + length;
+#endif
+}
+
+/// @brief Writes the text of a single value into [first, last), without a null terminator.
+/// @return One past the last character written, or nullptr if the text does not fit.
+template <class T>
+char* toChars(char* first, char* last, const T value, const CsvNumberFormat format = CsvNumberFormat::Compatible) noexcept
+{
+    if constexpr (std::is_floating_point_v<T>) { return _floatToChars(first, last, value, format); }
+    else
+    {
+        std::to_chars_result result;
+        if constexpr (sizeof(T) < sizeof(uint64_t))
+        {
+            // "%d" reads every type below 64 bits as a signed int
+            if (format == CsvNumberFormat::Compatible) { result = std::to_chars(first, last, static_cast<int>(value)); }
+            else { result = std::to_chars(first, last, value); }
+        }
+        else { result = std::to_chars(first, last, value); }
+        return result.ec == std::errc() ? result.ptr : nullptr;
+    }
+}
+
+/// @brief Appends a single character to [first, last).
+/// @return One past the character, or nullptr if it does not fit.
+inline char* append(char* first, char* last, const char c) noexcept
+{
+    if (first == last) { return nullptr; }
+    *first = c;
+    return first + 1;
+}
+
+}  // namespace CsvFormat
+
+/// @brief Extracts numToExtract values of type T and writes them comma-separated, without a leading comma. Values which do not fit are still
+/// extracted so the extractor stays aligned with the packet.
+/// @return The number of characters written.
 template <class T>
-int extractToString(FaPacketExtractor& extractor, const size_t numToExtract, char* ptr, const uint16_t remaining) noexcept
+int extractToString(FaPacketExtractor& extractor, const size_t numToExtract, char* ptr, const uint16_t remaining,
+                    const CsvNumberFormat format = CsvNumberFormat::Compatible) noexcept
 {
-    int offset = 0;
-    uint8_t first_comma_skip = 1;  // Skip first comma of sentense
-    for (uint8_t i = 0; i < numToExtract; i++)
+    char* const last = ptr + remaining;
+    char* head = ptr;  // One past the last value written in full
+    bool full = false;
+    for (size_t i = 0; i < numToExtract; i++)
     {
-        constexpr const char* format = []() constexpr
+        const T value = extractor.extract_unchecked<T>();
+        if (full) { continue; }
+        char* next = (i == 0) ? head : CsvFormat::append(head, last, ',');
+        if (next != nullptr) { next = CsvFormat::toChars(next, last, value, format); }
+        if (next == nullptr)
         {
-            if constexpr (std::is_same_v<T, float>) { return ",%f"; }
-            else if constexpr (std::is_same_v<T, double>) { return ",%12.8f"; }
-            else if constexpr (std::is_same_v<T, uint64_t>) { return ",%llu"; }
-            else { return ",%d"; }
-        }();
-        offset += std::snprintf(ptr + offset, remaining - offset - first_comma_skip, format + first_comma_skip, extractor.extract_unchecked<T>());
-        first_comma_skip = 0;
+            full = true;
+            continue;
+        }
+        head = next;
     }
-    return offset;
+    return static_cast<int>(head - ptr);
 }
 
-int getMeasurementString(FaPacketExtractor& extractor, const CsvTypeInfo& typeInfo, char* ptr, const uint16_t remaining);
+int getMeasurementString(FaPacketExtractor& extractor, const CsvTypeInfo& typeInfo, char* ptr, const uint16_t remaining,
+                         const CsvNumberFormat format = CsvNumberFormat::Compatible);
 
 const char* getMeasurementString(const AsciiPacketProtocol::AsciiMeasurementHeader& msg);
 
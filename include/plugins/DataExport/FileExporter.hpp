@@ -36,6 +36,8 @@
 #include "Implementation/AsciiPacketDispatcher.hpp"
 #include "Implementation/FaPacketDispatcher.hpp"
 #include "Implementation/FbPacketDispatcher.hpp"
+#include "plugins/SimpleLogger/LogIndex.hpp"
+#include "plugins/SimpleLogger/CompactLog.hpp"
 
 namespace VN
 {
@@ -57,7 +59,72 @@ public:
 
         inputFile.read(reinterpret_cast<char*>(buffer.get()), fileSizeInBytes);
 
-        ByteBuffer byteBuffer(buffer.get(), fileSizeInBytes, fileSizeInBytes);
+        if (CompactLog::isCompactLog(buffer.get(), fileSizeInBytes)) { return _processCompact(buffer.get(), fileSizeInBytes, 0, LogIndexEntry::unknown); }
+        return _processBuffer(buffer.get(), fileSizeInBytes);
+    }
+
+    /// @brief Processes only the part of a log holding packets between begin and end, inclusive, in nanoseconds of the passed time base. Requires the
+    /// sidecar index SimpleLogger writes alongside the log, and seeks straight to the covering bytes. The range is widened to the index's entries, so
+    /// packets up to Config::DataExport::logIndexInterval either side may also be exported.
+    /// @return The log or its index could not be read.
+    bool processFile(const Filesystem::FilePath& fileName, const LogTimeBase timeBase, const uint64_t begin, const uint64_t end)
+    {
+        LogIndex logIndex;
+        if (logIndex.load(logIndexPath(fileName))) { return true; }
+
+        const uint64_t fileSizeInBytes = std::filesystem::file_size(fileName.c_str());
+        const auto [firstByte, lastByte] = logIndex.byteRange(timeBase, begin, end);
+        const uint64_t rangeBegin = std::min(firstByte, fileSizeInBytes);
+        const size_t rangeSizeInBytes = std::min(lastByte, fileSizeInBytes) - rangeBegin;
+
+        InputFile inputFile(fileName);
+        uint8_t magic[sizeof(CompactLog::FILE_MAGIC)]{};
+        if (!inputFile.read(reinterpret_cast<char*>(magic), sizeof(magic)) && CompactLog::isCompactLog(magic, sizeof(magic)))
+        {
+            // Index offsets are into the decoded bytes, so a compact log is decoded whole
+            auto compactBuffer = std::make_unique<uint8_t[]>(fileSizeInBytes);
+            if (inputFile.seek(0) || inputFile.read(reinterpret_cast<char*>(compactBuffer.get()), fileSizeInBytes)) { return true; }
+            return _processCompact(compactBuffer.get(), fileSizeInBytes, firstByte, lastByte);
+        }
+
+        auto buffer = std::make_unique<uint8_t[]>(rangeSizeInBytes);
+        if (inputFile.seek(rangeBegin)) { return true; }
+        if (rangeSizeInBytes != 0 && inputFile.read(reinterpret_cast<char*>(buffer.get()), rangeSizeInBytes)) { return true; }
+
+        return _processBuffer(buffer.get(), rangeSizeInBytes);
+    }
+
+    bool addExporter(std::unique_ptr<Exporter>&& exporterToAdd) { return _exporters.push_back(std::move(exporterToAdd)); };
+    void addSkippedByteExporter(std::unique_ptr<SkippedByteExporter>&& exporterToAdd) { _skippedByteExporter = std::move(exporterToAdd); }
+
+    struct ParsingStats
+    {
+        uint64_t validFaPacketCount = 0;
+        uint64_t invalidFaPacketCount = 0;
+        uint64_t validAsciiPacketCount = 0;
+        uint64_t invalidAsciiPacketCount = 0;
+        uint64_t validFbPacketCount = 0;
+        uint64_t invalidFbPacketCount = 0;
+        uint64_t skippedByteCount = 0;
+        uint64_t receivedByteCount = 0;
+    };
+
+    ParsingStats getParsingStats() { return _parsingStats; }
+
+private:
+    bool _processCompact(const uint8_t* compactLog, const size_t compactLogSize, const uint64_t firstByte, const uint64_t lastByte)
+    {
+        // A truncated or corrupt log still decodes up to the damage, and that prefix is exported as a truncated raw log would be
+        std::vector<uint8_t> decoded;
+        CompactLogDecoder().decode(compactLog, compactLogSize, decoded);
+        const size_t rangeBegin = std::min<uint64_t>(firstByte, decoded.size());
+        const size_t rangeEnd = std::min<uint64_t>(lastByte, decoded.size());
+        return _processBuffer(decoded.data() + rangeBegin, rangeEnd - rangeBegin);
+    }
+
+    bool _processBuffer(uint8_t* buffer, const size_t bufferSize)
+    {
+        ByteBuffer byteBuffer(buffer, bufferSize, bufferSize);
 
         PacketSynchronizer packetSynchronizer(byteBuffer, [this](AsyncError&& error) { _asyncErrorQueue.put(std::move(error)); });
         packetSynchronizer.addDispatcher(&_asciiPacketDispatcher);
@@ -73,8 +140,11 @@ public:
 
             e->start();
         }
-        packetSynchronizer.registerSkippedByteBuffer(_skippedByteExporter->getQueuePtr());
-        if (_skippedByteExporter) { _skippedByteExporter->start(); }
+        if (_skippedByteExporter)
+        {
+            packetSynchronizer.registerSkippedByteBuffer(_skippedByteExporter->getQueuePtr());
+            _skippedByteExporter->start();
+        }
 
         while (!packetSynchronizer.dispatchNextPacket()) {};
 
@@ -92,24 +162,6 @@ public:
         return false;
     }
 
-    bool addExporter(std::unique_ptr<Exporter>&& exporterToAdd) { return _exporters.push_back(std::move(exporterToAdd)); };
-    void addSkippedByteExporter(std::unique_ptr<SkippedByteExporter>&& exporterToAdd) { _skippedByteExporter = std::move(exporterToAdd); }
-
-    struct ParsingStats
-    {
-        uint64_t validFaPacketCount = 0;
-        uint64_t invalidFaPacketCount = 0;
-        uint64_t validAsciiPacketCount = 0;
-        uint64_t invalidAsciiPacketCount = 0;
-        uint64_t validFbPacketCount = 0;
-        uint64_t invalidFbPacketCount = 0;
-        uint64_t skippedByteCount = 0;
-        uint64_t receivedByteCount = 0;
-    };
-
-    ParsingStats getParsingStats() { return _parsingStats; }
-
-private:
     MeasurementQueue _measurementQueue{Config::PacketDispatchers::compositeDataQueueCapacity};
 
     CommandProcessor _commandProcessor{[]([[maybe_unused]] AsyncError&& error) {}};
@@ -0,0 +1,133 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef DATAEXPORT_OUTPUTFILECACHE_HPP
+#define DATAEXPORT_OUTPUTFILECACHE_HPP
+
+#include <functional>
+#include <list>
+#include <unordered_map>
+
+#include "Config.hpp"
+#include "Debug.hpp"
+#include "HAL/File.hpp"
+
+namespace VN
+{
+
+/// @brief Maps each key, such as a packet header, to the file written for it, with no limit on the number of files. Lookups are a hash and at most one
+/// list splice. At most maxOpenFiles are open at once: opening another closes the least recently used, and it is reopened to append when next needed.
+/// File must provide open(), openAppend(), close(), and is_open(), as OutputFile and BufferedOutputFile do.
+template <class Key, class File, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class OutputFileCache
+{
+public:
+    OutputFileCache(const size_t maxOpenFiles = Config::DataExport::maxOpenFiles) : _maxOpenFiles(maxOpenFiles > 0 ? maxOpenFiles : 1) {}
+
+    OutputFileCache(const OutputFileCache&) = delete;
+    OutputFileCache& operator=(const OutputFileCache&) = delete;
+
+    /// @brief Finds the file for the key and marks it most recently used, reopening it if it was closed to make room for others.
+    /// @return The file, or nullptr if none has been added for the key.
+    File* find(const Key& key)
+    {
+        const auto iter = _index.find(key);
+        if (iter == _index.end()) { return nullptr; }
+
+        const auto entry = iter->second;
+        if (entry->isOpen)
+        {
+            if (entry != _open.begin()) { _open.splice(_open.begin(), _open, entry); }
+        }
+        else
+        {
+            _makeRoom();
+            _open.splice(_open.begin(), _closed, entry);
+            entry->isOpen = true;
+            _openFile(*entry, true);
+        }
+        return &entry->file;
+    }
+
+    /// @brief Adds a new file for the key and opens it, truncating any file already at the path. Check is_open() on the result for failure.
+    /// @param file The unopened file, which carries any settings such as its buffer capacity.
+    File& insert(const Key& key, const Filesystem::FilePath& filePath, File&& file)
+    {
+        _makeRoom();
+        _open.push_front(Entry{filePath, std::move(file), true});
+        _index.emplace(key, _open.begin());
+        _openFile(_open.front(), false);
+        return _open.front().file;
+    }
+
+    /// @brief Calls the function with each open file. Closed files have nothing left to flush.
+    template <class Function>
+    void forEachOpen(Function&& function)
+    {
+        for (auto& entry : _open) { function(entry.file); }
+    }
+
+    size_t size() const noexcept { return _index.size(); }
+    size_t numOpen() const noexcept { return _open.size(); }
+
+private:
+    struct Entry
+    {
+        Filesystem::FilePath filePath;
+        File file;
+        bool isOpen;  // Which of _open and _closed the entry is in
+    };
+
+    void _makeRoom()
+    {
+        if (_open.size() >= _maxOpenFiles) { _closeLeastRecentlyUsed(); }
+    }
+
+    void _closeLeastRecentlyUsed()
+    {
+        const auto entry = std::prev(_open.end());
+        entry->file.close();
+        entry->isOpen = false;
+        _closed.splice(_closed.begin(), _open, entry);
+    }
+
+    /// @brief Opens the file, closing others while the open fails and others remain, in case the process has run out of file descriptors.
+    void _openFile(Entry& entry, const bool append)
+    {
+        while ((append ? entry.file.openAppend(entry.filePath) : entry.file.open(entry.filePath)) && _open.size() > 1)
+        {
+            VN_DEBUG_1("Failed to open file, closing the least recently used.");
+            _closeLeastRecentlyUsed();
+        }
+    }
+
+    size_t _maxOpenFiles;
+    std::list<Entry> _open;    // Most recently used first
+    std::list<Entry> _closed;  // Closed to stay within _maxOpenFiles
+    std::unordered_map<Key, typename std::list<Entry>::iterator, Hash, KeyEqual> _index;
+};
+
+}  // namespace VN
+
+#endif  // DATAEXPORT_OUTPUTFILECACHE_HPP
@@ -46,6 +46,9 @@ public:
     SkippedByteExporter(const Filesystem::FilePath& outputDir, const size_t& byteCapacity = SKIPPED_BYTE_BUFFER_CAPACITY)
         : _filePath{outputDir}, _queue{byteCapacity}
     {
+#if THREADING_ENABLE
+        _queue.setConsumerSignal(&_consumerSignal);
+#endif
         if (!_filePath.empty() && _filePath.back() != std::filesystem::path::preferred_separator)
         {
             _filePath = _filePath + std::filesystem::path::preferred_separator;
@@ -77,6 +80,7 @@ public:
     void stop()
     {
         _logging = false;
+        _consumerSignal.interrupt();
         _thread->join();
     }
 
@@ -92,12 +96,17 @@ private:
 #if THREADING_ENABLE
     std::atomic<bool> _logging = false;
     std::unique_ptr<Thread> _thread = nullptr;
+    ConsumerSignal _consumerSignal{_queue.capacity() / Config::DataExport::wakeFillDivisor, Config::DataExport::wakeMaxLatency};
 #endif
 
     void _init_file()
     {
         Filesystem::FilePath fileName;
-        std::snprintf(fileName.begin(), fileName.capacity(), "%sskippedBytes.bin", _filePath.c_str());
+        if (std::snprintf(fileName.begin(), fileName.capacity(), "%sskippedBytes.bin", _filePath.c_str()) >= static_cast<int>(fileName.capacity()))
+        {
+            VN_DEBUG_1("Output path too long for skippedBytes.bin.");
+            VN_ABORT();
+        }
         _file = OutputFile(fileName);
     }
 
@@ -107,7 +116,7 @@ private:
         _init_file();
         while (_logging)
         {
-            thisThread::sleepFor(1ms);
+            _consumerSignal.waitForBatch();
             exportToFile();
         }
         exportToFile();
@@ -0,0 +1,251 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef LOGREPLAY_SERIALREPLAY_HPP
+#define LOGREPLAY_SERIALREPLAY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <utility>
+#include <vector>
+
+#include "HAL/File.hpp"
+#include "HAL/Mutex.hpp"
+#include "HAL/Serial_Base.hpp"
+#include "HAL/Timer.hpp"
+#include "Implementation/CoreUtils.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+#include "plugins/SimpleLogger/CompactLog.hpp"
+#include "plugins/SimpleLogger/LogIndex.hpp"
+
+namespace VN
+{
+
+/// @brief A Serial_Base which replays a log recorded by SimpleLogger, raw or compact, so recordings can be fed through the whole Sensor pipeline without
+/// hardware. Install it with Sensor::useSerial<SerialReplay>(logPath), then connect with any port name. The log is loaded when the port is opened, and
+/// replayed from the start each time it is.
+///
+/// Commands sent are answered from a table of canned responses, and otherwise go unanswered, as from a sensor not streaming ASCII replies.
+class SerialReplay : public Serial_Base
+{
+public:
+    enum class Pacing : uint8_t
+    {
+        BaudRate,  // As fast as the connected baud rate carries the bytes, at 10 bits per byte
+        Recorded,  // As the bytes were received while logging, from the log's sidecar index. Falls back to BaudRate if the log has none.
+        Unpaced,   // As fast as the main buffer has room for them. Never drops bytes, but give the Sensor a main buffer at least two reads deep so
+                   // the synchronizer does not skip packets left split at the end of a full buffer.
+    };
+
+    /// @param speed Multiplies the rate of paced replays.
+    /// @param loop Restarts the replay from the start of the log once it ends, rather than going quiet.
+    SerialReplay(ByteBuffer& byteBuffer, const Filesystem::FilePath& logPath, const Pacing pacing = Pacing::Recorded, const double speed = 1.0,
+                 const bool loop = false)
+        : Serial_Base(byteBuffer), _logPath(logPath), _pacing(pacing), _speed(speed), _loop(loop)
+    {
+    }
+
+    /// @brief Answers every command starting with command (e.g. "RRG,01", for $VNRRG,01*XX) with response (e.g. "VNRRG,01,VN-100"). The response is
+    /// framed with $ and a checksum, and reaches the main buffer on the next getData, ahead of any log bytes. The first matching entry added is used.
+    void addResponse(const AsciiMessage& command, const AsciiMessage& response) { _responses.emplace_back(command, response); }
+
+    // ***********
+    // Port access
+    // ***********
+    Error open(const PortName& portName, const uint32_t baudRate) noexcept override final
+    {
+        if (_isOpen) { close(); }
+        if (!Filesystem::exists(_logPath)) { return Error::InvalidPortName; }
+        if (_load()) { return Error::SerialReadFailed; }
+
+        _portName = portName;
+        _baudRate = baudRate;
+        _restart();
+        _numBytesReplayed = 0;
+        _isOpen = true;
+        return Error::None;
+    }
+
+    void close() noexcept override final
+    {
+        _isOpen = false;
+        LockGuard lock(_pendingMutex);
+        _pendingResponses.clear();
+    }
+
+    Error changeBaudRate(const uint32_t baudRate) noexcept override final
+    {
+        if (!_isOpen) { return Error::SerialPortClosed; }
+        _baudRate = baudRate;
+        if (_pacing == Pacing::Recorded && !_schedule.empty()) { return Error::None; }
+        // Keep the replay position, pacing the rest of the log at the new rate
+        _startPosition = _position;
+        _startTime = now();
+        return Error::None;
+    }
+
+    // ***************
+    // Port read/write
+    // ***************
+    Error getData() noexcept override final
+    {
+        if (!_isOpen) { return Error::SerialPortClosed; }
+        {
+            LockGuard lock(_pendingMutex);
+            if (!_pendingResponses.empty())
+            {
+                const size_t numBytes = std::min(_pendingResponses.size(), _byteBuffer.capacity() - _byteBuffer.size());
+                _byteBuffer.put(_pendingResponses.data(), numBytes);
+                _pendingResponses.erase(_pendingResponses.begin(), _pendingResponses.begin() + numBytes);
+            }
+        }
+
+        if (_position == _log.size())
+        {
+            if (!_loop || _log.empty()) { return Error::None; }
+            _restart();
+        }
+
+        const size_t position = _position;
+        size_t numBytes = std::min<size_t>(_dueBytes() - position, _numBytesToReadPerGetData);
+        if (_pacing == Pacing::Unpaced) { numBytes = std::min(numBytes, _byteBuffer.capacity() - _byteBuffer.size()); }
+        if (numBytes == 0) { return Error::None; }
+
+        const bool isFull = _byteBuffer.put(_log.data() + position, numBytes);
+        _position = position + numBytes;  // A paced replay drops what does not fit, as a serial port would
+        _numBytesReplayed += numBytes;
+        return isFull ? Error::PrimaryBufferFull : Error::None;
+    }
+
+    Error send(const AsciiMessage& message) noexcept override final
+    {
+        if (!_isOpen) { return Error::SerialPortClosed; }
+        // Sent as $VN<command>*<crc>\r\n
+        const char* commandBegin = message.c_str() + std::min<size_t>(3, message.length());
+        const char* commandEnd = std::find(commandBegin, message.c_str() + message.length(), '*');
+        for (const auto& [command, response] : _responses)
+        {
+            if (static_cast<size_t>(commandEnd - commandBegin) < command.length() || std::memcmp(commandBegin, command.c_str(), command.length()) != 0)
+            {
+                continue;
+            }
+            char framed[AsciiMessage::capacity() + 8];
+            const int length = std::snprintf(framed, sizeof(framed), "$%s*%02X\r\n", response.c_str(),
+                                              CalculateCheckSum(reinterpret_cast<uint8_t*>(const_cast<char*>(response.c_str())), response.length()));
+            LockGuard lock(_pendingMutex);
+            _pendingResponses.insert(_pendingResponses.end(), framed, framed + length);
+            break;
+        }
+        return Error::None;
+    }
+
+    /// @brief Whether the whole log has been put into the main buffer. Never true when looping.
+    bool isFinished() const noexcept { return _isOpen && !_loop && _position == _log.size(); }
+
+    /// @brief Log bytes replayed since the port was opened, including any dropped for want of room in the main buffer.
+    uint64_t numBytesReplayed() const noexcept { return _numBytesReplayed; }
+
+private:
+    const Filesystem::FilePath _logPath;
+    const Pacing _pacing;
+    const double _speed;
+    const bool _loop;
+
+    std::vector<uint8_t> _log;
+    std::vector<std::pair<int64_t, uint64_t>> _schedule;  // (nanoseconds after the first byte was received, byte offset) from the sidecar index
+    std::atomic<size_t> _position = 0;
+    size_t _startPosition = 0;
+    time_point _startTime;
+    std::atomic<uint64_t> _numBytesReplayed = 0;
+
+    std::vector<std::pair<AsciiMessage, AsciiMessage>> _responses;
+    Mutex _pendingMutex;
+    std::vector<uint8_t> _pendingResponses;
+
+    /// @return An error occurred.
+    bool _load()
+    {
+        _log.clear();
+        _schedule.clear();
+
+        const auto fileSizeInBytes = std::filesystem::file_size(_logPath.c_str());
+        std::vector<uint8_t> fileBytes(fileSizeInBytes);
+        InputFile inputFile(_logPath);
+        if (fileSizeInBytes != 0 && inputFile.read(reinterpret_cast<char*>(fileBytes.data()), fileSizeInBytes)) { return true; }
+        if (CompactLog::isCompactLog(fileBytes.data(), fileBytes.size()))
+        {
+            if (CompactLogDecoder().decode(fileBytes.data(), fileBytes.size(), _log)) { return true; }
+        }
+        else { _log = std::move(fileBytes); }
+
+        LogIndex logIndex;
+        if (_pacing == Pacing::Recorded && !logIndex.load(logIndexPath(_logPath)) && !logIndex.entries().empty())
+        {
+            const uint64_t firstHostTime = logIndex.entries().front().hostTime;
+            for (const auto& entry : logIndex.entries())
+            {
+                if (entry.hostTime < firstHostTime) { continue; }
+                _schedule.emplace_back(static_cast<int64_t>(entry.hostTime - firstHostTime), std::min<uint64_t>(entry.byteOffset, _log.size()));
+            }
+        }
+        return false;
+    }
+
+    void _restart() noexcept
+    {
+        _position = 0;
+        _startPosition = 0;
+        _startTime = now();
+    }
+
+    /// @return The offset into the log up to which bytes should have been replayed by now.
+    size_t _dueBytes() const noexcept
+    {
+        if (_pacing == Pacing::Unpaced) { return _log.size(); }
+        const double elapsed = std::chrono::duration<double>(now() - _startTime).count() * _speed;
+
+        if (_pacing == Pacing::Recorded && !_schedule.empty())
+        {
+            const int64_t elapsedNs = static_cast<int64_t>(elapsed * 1e9);
+            const auto next = std::upper_bound(_schedule.begin(), _schedule.end(), elapsedNs,
+                                               [](const int64_t time, const std::pair<int64_t, uint64_t>& entry) { return time < entry.first; });
+            if (next == _schedule.end()) { return _log.size(); }
+            if (next == _schedule.begin()) { return std::min<size_t>(next->second, _log.size()); }
+            // Bytes between entries arrived at an even rate, as far as the index can tell
+            const auto previous = std::prev(next);
+            const double fraction = static_cast<double>(elapsedNs - previous->first) / static_cast<double>(next->first - previous->first);
+            return std::max(_position.load(), static_cast<size_t>(previous->second + fraction * (next->second - previous->second)));
+        }
+
+        const double dueBytes = _startPosition + elapsed * _baudRate / 10.0;
+        return std::max(_position.load(), static_cast<size_t>(std::min(dueBytes, static_cast<double>(_log.size()))));
+    }
+};
+
+}  // namespace VN
+
+#endif  // LOGREPLAY_SERIALREPLAY_HPP
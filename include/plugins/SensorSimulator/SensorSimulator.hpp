@@ -0,0 +1,472 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef SENSORSIMULATOR_SENSORSIMULATOR_HPP
+#define SENSORSIMULATOR_SENSORSIMULATOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "Implementation/BinaryMeasurementDefinitions.hpp"
+#include "Implementation/CoreUtils.hpp"
+#include "Interface/Errors.hpp"
+#include "Interface/Registers.hpp"
+
+namespace VN
+{
+
+/// @brief Simulates a sensor at the far end of a pseudo-terminal, so the host's real serial path can be exercised and load tested without hardware. Runs
+/// on a Linux host only. open() creates the pty pair; connect a Sensor to portName() as to any serial port.
+///
+/// Register reads and writes are answered with the same checksum or crc framing as the command, from a table of register values. Writing a binary output
+/// register (75-77) reconfigures that output's stream, at the IMU rate over its rate divisor. Every other command is acknowledged by echoing it back.
+///
+/// Streamed FA packets carry the nanoseconds since open() in their TimeStartup and other 8 byte fields, and a sine wave as floats in the rest, with
+/// optional gaussian noise. Bit errors can be injected into everything sent, after checksums are computed.
+class SensorSimulator
+{
+public:
+    using BinaryOutputMeasurements = Registers::System::BinaryOutputMeasurements;
+    static constexpr uint8_t numBinaryOutputs = 3;
+
+    struct LinkConfig
+    {
+        uint32_t baudRate = 921600;  // Paces the bytes sent at 10 bits per byte, whatever rate the host opens the pty at. 0 sends as fast as the pty takes them.
+        uint16_t imuRateHz = 800;    // Divided by the rate divisor written to a binary output register
+        double noiseStdDev = 0;      // Added to every synthetic value
+        double bitErrorRate = 0;     // The probability that each bit sent is flipped
+        size_t outputBufferCapacity = 16384;  // Bytes waiting for the link beyond which packets are dropped, as the unit's output buffer overflows
+        uint32_t seed = 0;
+    };
+
+    struct Stats
+    {
+        uint64_t packetsSent = 0;
+        uint64_t packetsDropped = 0;  // Because the link was backed up past outputBufferCapacity
+        uint64_t bytesSent = 0;
+        uint64_t bitsFlipped = 0;
+        uint64_t commandsAnswered = 0;
+    };
+
+    SensorSimulator() : SensorSimulator(LinkConfig{}) {}
+
+    explicit SensorSimulator(const LinkConfig& linkConfig) : _linkConfig(linkConfig), _random(linkConfig.seed)
+    {
+        _registers[1] = "VN-100 Simulator";
+        _registers[2] = "1";
+        _registers[3] = "0";
+        _registers[4] = "0.0.0.0";
+        const Registers::System::BinaryOutput1 disabledOutput;
+        for (uint8_t i = 0; i < numBinaryOutputs; ++i) { _registers[_binaryOutputRegisterId + i] = disabledOutput.toString().c_str(); }
+        if (_linkConfig.bitErrorRate > 0) { _bitsUntilFlip = _nextFlipDistance(); }
+    }
+
+    ~SensorSimulator() { close(); }
+
+    SensorSimulator(const SensorSimulator&) = delete;
+    SensorSimulator& operator=(const SensorSimulator&) = delete;
+
+    // ***********
+    // Port access
+    // ***********
+
+    /// @brief Creates the pty pair and starts simulating.
+    Error open() noexcept
+    {
+        close();
+        _masterHandle = ::posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+        if (_masterHandle == -1) { return Error::UnexpectedSerialError; }
+        const char* slaveName = (::grantpt(_masterHandle) == 0 && ::unlockpt(_masterHandle) == 0) ? ::ptsname(_masterHandle) : nullptr;
+        if (slaveName == nullptr)
+        {
+            ::close(_masterHandle);
+            _masterHandle = -1;
+            return Error::UnexpectedSerialError;
+        }
+        _portName = slaveName;
+
+        // Without raw mode the line discipline would echo and translate the bytes
+        termios portSettings;
+        if (tcgetattr(_masterHandle, &portSettings) == 0)
+        {
+            cfmakeraw(&portSettings);
+            tcsetattr(_masterHandle, TCSANOW, &portSettings);
+        }
+
+        _startTime = Clock::now();
+        _stopRequested = false;
+        _thread = std::thread(&SensorSimulator::_run, this);
+        return Error::None;
+    }
+
+    void close() noexcept
+    {
+        _stopRequested = true;
+        if (_thread.joinable()) { _thread.join(); }
+        if (_masterHandle != -1) { ::close(_masterHandle); }
+        _masterHandle = -1;
+    }
+
+    /// @brief The path of the pty's slave side, e.g. /dev/pts/3, which the host opens.
+    const std::string& portName() const noexcept { return _portName; }
+
+    // *************
+    // Configuration
+    // *************
+
+    /// @brief Streams a binary output directly, at any rate, rather than through its register.
+    /// @param rateHz Packets per second, or 0 to stop the output.
+    void setBinaryOutput(const uint8_t index, const BinaryOutputMeasurements& measurements, const double rateHz) noexcept
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (index >= numBinaryOutputs) { return; }
+        _outputs[index] = _compile(measurements, rateHz, _elapsedSeconds());
+    }
+
+    /// @brief Sets the value a register reads back as, the part of the response after its id.
+    void setRegister(const uint8_t id, const std::string& value) noexcept
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _registers[id] = value;
+    }
+
+    Stats stats() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _stats;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    static constexpr uint8_t _binaryOutputRegisterId = 75;
+    static constexpr double _bitsPerByte = 10.0;  // Start bit, 8 data bits, stop bit
+    static constexpr double _maxBurstSeconds = 0.001;
+    static constexpr double _signalFrequencyHz = 0.5;
+
+    enum class FieldKind : uint8_t
+    {
+        Time,    // Nanoseconds since open
+        Zeros,   // Status words, and GNSS SatInfo and RawMeas carrying no satellites
+        Floats,  // A noisy sine wave
+    };
+
+    struct Field
+    {
+        FieldKind kind;
+        uint8_t size;
+    };
+
+    struct Output
+    {
+        std::vector<uint8_t> header;  // Sync byte, groups, and types
+        std::vector<Field> fields;
+        double rateHz = 0;
+        double startSeconds = 0;
+        uint64_t numPackets = 0;  // Due since startSeconds, sent or dropped
+    };
+
+    LinkConfig _linkConfig;
+    std::string _portName;
+    int _masterHandle = -1;
+    std::thread _thread;
+    std::atomic<bool> _stopRequested = false;
+    Clock::time_point _startTime;
+
+    mutable std::mutex _mutex;
+    std::array<Output, numBinaryOutputs> _outputs{};
+    std::map<uint8_t, std::string> _registers;
+    Stats _stats;
+
+    std::mt19937_64 _random;
+    uint64_t _bitsUntilFlip = UINT64_MAX;
+    std::vector<uint8_t> _pending;  // Bytes waiting for the link, from _pendingOffset
+    size_t _pendingOffset = 0;
+    std::string _commandLine;
+
+    double _elapsedSeconds() const noexcept { return std::chrono::duration<double>(Clock::now() - _startTime).count(); }
+
+    void _run() noexcept
+    {
+        double byteCredit = 0;
+        double prevSeconds = _elapsedSeconds();
+        while (!_stopRequested)
+        {
+            _serviceCommands();
+            const double seconds = _elapsedSeconds();
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (auto& output : _outputs)
+                {
+                    if (output.rateHz <= 0) { continue; }
+                    const uint64_t numPacketsDue = static_cast<uint64_t>((seconds - output.startSeconds) * output.rateHz);
+                    for (; output.numPackets < numPacketsDue; ++output.numPackets)
+                    {
+                        if (_pending.size() - _pendingOffset > _linkConfig.outputBufferCapacity) { ++_stats.packetsDropped; }
+                        else { _appendPacket(output, output.startSeconds + output.numPackets / output.rateHz); }
+                    }
+                }
+            }
+
+            size_t numBytes = _pending.size() - _pendingOffset;
+            if (_linkConfig.baudRate != 0)
+            {
+                const double bytesPerSecond = _linkConfig.baudRate / _bitsPerByte;
+                byteCredit = std::min(byteCredit + (seconds - prevSeconds) * bytesPerSecond, std::max(bytesPerSecond * _maxBurstSeconds, 1.0));
+                numBytes = std::min(numBytes, static_cast<size_t>(byteCredit));
+            }
+            prevSeconds = seconds;
+
+            const ssize_t numBytesWritten = (numBytes == 0) ? 0 : ::write(_masterHandle, _pending.data() + _pendingOffset, numBytes);
+            if (numBytesWritten > 0)
+            {
+                byteCredit -= numBytesWritten;
+                _pendingOffset += static_cast<size_t>(numBytesWritten);
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stats.bytesSent += static_cast<uint64_t>(numBytesWritten);
+            }
+            if (_pendingOffset == _pending.size())
+            {
+                _pending.clear();
+                _pendingOffset = 0;
+            }
+            else if (_pendingOffset > _pending.size() / 2)
+            {
+                _pending.erase(_pending.begin(), _pending.begin() + static_cast<std::ptrdiff_t>(_pendingOffset));
+                _pendingOffset = 0;
+            }
+            if (numBytesWritten <= 0) { std::this_thread::sleep_for(std::chrono::microseconds(100)); }
+        }
+    }
+
+    // *******
+    // Packets
+    // *******
+
+    static Output _compile(const BinaryOutputMeasurements& measurements, const double rateHz, const double startSeconds) noexcept
+    {
+        Output output;
+        const std::array<std::pair<uint8_t, uint32_t>, 8> groups{{{0, uint32_t(measurements.common)},
+                                                                  {1, uint32_t(measurements.time)},
+                                                                  {2, uint32_t(measurements.imu)},
+                                                                  {3, uint32_t(measurements.gnss)},
+                                                                  {4, uint32_t(measurements.attitude)},
+                                                                  {5, uint32_t(measurements.ins)},
+                                                                  {6, uint32_t(measurements.gnss2)},
+                                                                  {12, uint32_t(measurements.gnss3)}}};
+        for (const auto& [group, types] : groups)
+        {
+            for (uint8_t field = 0; field < 32; ++field)
+            {
+                if (((field % 16) == 15) || !(types & (uint32_t(1) << field))) { continue; }  // Extension bit
+                const bool isGnssGroup = (group == 3) || (group == 6) || (group == 12);
+                if (isGnssGroup && (field == 14)) { output.fields.push_back({FieldKind::Zeros, 2}); }
+                else if (isGnssGroup && (field == 16)) { output.fields.push_back({FieldKind::Zeros, 12}); }
+                else
+                {
+                    const uint8_t size = getStaticBinaryTypeSize(group, field).value_or(0);
+                    const FieldKind kind = (size == 8) ? FieldKind::Time : ((size % 4) == 0) ? FieldKind::Floats : FieldKind::Zeros;
+                    output.fields.push_back({kind, size});
+                }
+            }
+        }
+        if (output.fields.empty()) { return output; }
+
+        const BinaryHeader header = measurements.toBinaryHeader();
+        output.header.push_back(0xFA);
+        for (const uint8_t group : header.outputGroups) { output.header.push_back(group); }
+        for (const uint16_t type : header.outputTypes)
+        {
+            output.header.push_back(static_cast<uint8_t>(type));
+            output.header.push_back(static_cast<uint8_t>(type >> 8));
+        }
+        output.rateHz = rateHz;
+        output.startSeconds = startSeconds;
+        return output;
+    }
+
+    void _appendPacket(const Output& output, const double seconds) noexcept
+    {
+        std::vector<uint8_t> packet(output.header);
+        const uint64_t nanoseconds = static_cast<uint64_t>(seconds * 1e9);
+        std::normal_distribution<float> noise(0.0f, static_cast<float>(_linkConfig.noiseStdDev));
+        size_t numValues = 0;
+        for (const Field& field : output.fields)
+        {
+            const size_t offset = packet.size();
+            packet.resize(offset + field.size, 0);
+            if (field.kind == FieldKind::Time) { std::memcpy(packet.data() + offset, &nanoseconds, sizeof(nanoseconds)); }
+            else if (field.kind == FieldKind::Floats)
+            {
+                for (size_t i = 0; i < field.size; i += sizeof(float), ++numValues)
+                {
+                    float value = static_cast<float>(std::sin(2.0 * M_PI * _signalFrequencyHz * seconds + numValues));
+                    if (_linkConfig.noiseStdDev > 0) { value += noise(_random); }
+                    std::memcpy(packet.data() + offset + i, &value, sizeof(value));
+                }
+            }
+        }
+        const uint16_t crc = CalculateCRC(packet.data() + 1, packet.size() - 1);
+        packet.push_back(static_cast<uint8_t>(crc >> 8));
+        packet.push_back(static_cast<uint8_t>(crc));
+        _send(packet.data(), packet.size());
+        ++_stats.packetsSent;
+    }
+
+    void _send(const uint8_t* data, const size_t size) noexcept
+    {
+        const size_t begin = _pending.size();
+        _pending.insert(_pending.end(), data, data + size);
+        if (_linkConfig.bitErrorRate <= 0) { return; }
+
+        const uint64_t numBits = static_cast<uint64_t>(size) * 8;
+        uint64_t bitIndex = 0;
+        while (_bitsUntilFlip < numBits - bitIndex)
+        {
+            bitIndex += _bitsUntilFlip;
+            _pending[begin + bitIndex / 8] ^= static_cast<uint8_t>(1 << (bitIndex % 8));
+            ++_stats.bitsFlipped;
+            ++bitIndex;
+            _bitsUntilFlip = _nextFlipDistance();
+        }
+        _bitsUntilFlip -= numBits - bitIndex;
+    }
+
+    uint64_t _nextFlipDistance() noexcept
+    {
+        // The number of bits sent intact before the next flip
+        return std::geometric_distribution<uint64_t>(std::min(_linkConfig.bitErrorRate, 1.0))(_random);
+    }
+
+    // ********
+    // Commands
+    // ********
+
+    void _serviceCommands() noexcept
+    {
+        char buffer[256];
+        const ssize_t numBytesRead = ::read(_masterHandle, buffer, sizeof(buffer));
+        if (numBytesRead <= 0) { return; }
+        for (ssize_t i = 0; i < numBytesRead; ++i)
+        {
+            if (buffer[i] == '\n')
+            {
+                _answer(_commandLine);
+                _commandLine.clear();
+            }
+            else if (buffer[i] != '\r') { _commandLine.push_back(buffer[i]); }
+        }
+        if (_commandLine.size() > Config::CommandProcessor::messageMaxLength) { _commandLine.clear(); }  // Never terminated, so never a command
+    }
+
+    void _answer(const std::string& line) noexcept
+    {
+        const size_t start = line.find('$');
+        const size_t asterisk = line.find('*', start);
+        if ((start == std::string::npos) || (asterisk == std::string::npos)) { return; }
+        const std::string body = line.substr(start + 1, asterisk - start - 1);
+        const std::string checksum = line.substr(asterisk + 1);
+        const bool useCrc = checksum.size() == 4;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_isValidChecksum(body, checksum)) { return _respondWithError(Error::InvalidChecksum, useCrc); }
+        if (body.compare(0, 2, "VN") != 0) { return _respondWithError(Error::InvalidCommand, useCrc); }
+        const std::string command = body.substr(2);
+
+        const bool isRead = command.compare(0, 4, "RRG,") == 0;
+        const bool isWrite = command.compare(0, 4, "WRG,") == 0;
+        if (!isRead && !isWrite) { return _respond(body, useCrc); }
+
+        const size_t valueStart = command.find(',', 4);
+        const int id = std::atoi(command.c_str() + 4);
+        if ((id <= 0) || (id > UINT8_MAX)) { return _respondWithError(Error::InvalidRegister, useCrc); }
+        if (isWrite)
+        {
+            if (valueStart == std::string::npos) { return _respondWithError(Error::NotEnoughParameters, useCrc); }
+            const std::string value = command.substr(valueStart + 1);
+            if ((id >= _binaryOutputRegisterId) && (id < _binaryOutputRegisterId + numBinaryOutputs))
+            {
+                Registers::System::BinaryOutput1 binaryOutput;
+                if (binaryOutput.fromString(AsciiMessage(value.c_str()))) { return _respondWithError(Error::InvalidParameter, useCrc); }
+                const bool isEnabled = (uint16_t(binaryOutput.asyncMode) != 0) && (binaryOutput.rateDivisor != 0);
+                _outputs[id - _binaryOutputRegisterId] =
+                    _compile(binaryOutput, isEnabled ? double(_linkConfig.imuRateHz) / binaryOutput.rateDivisor : 0.0, _elapsedSeconds());
+            }
+            _registers[static_cast<uint8_t>(id)] = value;
+        }
+
+        const auto reg = _registers.find(static_cast<uint8_t>(id));
+        if (reg == _registers.end()) { return _respondWithError(Error::InvalidRegister, useCrc); }
+        char response[Config::CommandProcessor::messageMaxLength];
+        std::snprintf(response, sizeof(response), "VN%s,%02d,%s", isRead ? "RRG" : "WRG", id, reg->second.c_str());
+        _respond(response, useCrc);
+    }
+
+    static bool _isValidChecksum(std::string body, const std::string& checksum) noexcept
+    {
+        uint8_t* bytes = reinterpret_cast<uint8_t*>(body.data());
+        if (checksum == "XX" || checksum == "XXXX") { return true; }  // The protocol's wildcard
+        if (checksum.size() == 2) { return std::strtoul(checksum.c_str(), nullptr, 16) == CalculateCheckSum(bytes, body.size()); }
+        if (checksum.size() == 4) { return std::strtoul(checksum.c_str(), nullptr, 16) == CalculateCRC(bytes, body.size()); }
+        return false;
+    }
+
+    void _respondWithError(const Error error, const bool useCrc) noexcept
+    {
+        char response[16];
+        std::snprintf(response, sizeof(response), "VNERR,%02X", static_cast<uint16_t>(error));
+        _respond(response, useCrc);
+    }
+
+    void _respond(std::string body, const bool useCrc) noexcept
+    {
+        uint8_t* bytes = reinterpret_cast<uint8_t*>(body.data());
+        char checksum[8];
+        if (useCrc) { std::snprintf(checksum, sizeof(checksum), "*%04X\r\n", CalculateCRC(bytes, body.size())); }
+        else { std::snprintf(checksum, sizeof(checksum), "*%02X\r\n", CalculateCheckSum(bytes, body.size())); }
+        const std::string response = "$" + body + checksum;
+        _send(reinterpret_cast<const uint8_t*>(response.data()), response.size());
+        ++_stats.commandsAnswered;
+    }
+};
+
+}  // namespace VN
+
+#endif  // SENSORSIMULATOR_SENSORSIMULATOR_HPP
@@ -0,0 +1,361 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef SIMPLELOGGER_COMPACTLOG_HPP
+#define SIMPLELOGGER_COMPACTLOG_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Config.hpp"
+#include "Implementation/CoreUtils.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+
+namespace VN
+{
+
+/// @brief A lossless compact encoding of a sensor byte stream. Each distinct FA header is written once to a dictionary, after which each packet is a
+/// single tag byte followed by its payload, delta encoded against the previous packet of the same header. The sync byte, header and CRC are rebuilt when
+/// decoding. All other bytes (ASCII messages, FB packets, corrupt data) are stored verbatim.
+///
+/// The stream is the magic "VNCLOG01" followed by records, each starting with a tag byte:
+///     RAW     varint length, then that many bytes
+///     DEFINE  varint header length, header bytes (group byte through the last type word), varint payload length. Takes the next free header id.
+///     2..255  A packet of header id (tag - 2): a bitmap of which 32-bit payload lanes changed from their prediction, then a zigzag varint residual for
+///             each which did. A trailing partial lane is zero padded.
+/// Each lane is predicted from its previous value, or extrapolated from its previous two where that was the better fit for the lane's last value.
+namespace CompactLog
+{
+
+constexpr char FILE_MAGIC[8] = {'V', 'N', 'C', 'L', 'O', 'G', '0', '1'};
+
+enum Tag : uint8_t
+{
+    RAW = 0,
+    DEFINE = 1,
+    FIRST_PACKET = 2,
+};
+constexpr size_t MAX_NUM_HEADERS = 256 - FIRST_PACKET;
+
+inline bool isCompactLog(const uint8_t* data, const size_t size) noexcept
+{
+    return size >= sizeof(FILE_MAGIC) && std::memcmp(data, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0;
+}
+
+inline void putVarint(std::vector<uint8_t>& output, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        output.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    output.push_back(static_cast<uint8_t>(value));
+}
+
+/// @return An error occurred.
+inline bool getVarint(const uint8_t*& data, const uint8_t* end, uint64_t& value) noexcept
+{
+    value = 0;
+    for (uint8_t shift = 0; shift < 64; shift += 7)
+    {
+        if (data == end) { return true; }
+        const uint8_t byte = *data++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) { return false; }
+    }
+    return true;
+}
+
+inline uint32_t zigzag(const uint32_t residual) noexcept { return (residual << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(residual) >> 31); }
+inline uint32_t unzigzag(const uint32_t value) noexcept { return (value >> 1) ^ (0u - (value & 1)); }
+
+struct Lane
+{
+    uint32_t previous = 0;
+    uint32_t beforePrevious = 0;
+    bool isLinear = false;
+
+    uint32_t extrapolate() const noexcept { return 2 * previous - beforePrevious; }
+    uint32_t predict() const noexcept { return isLinear ? extrapolate() : previous; }
+
+    void update(const uint32_t value) noexcept
+    {
+        isLinear = _magnitude(value - extrapolate()) < _magnitude(value - previous);
+        beforePrevious = previous;
+        previous = value;
+    }
+
+private:
+    static uint32_t _magnitude(const uint32_t difference) noexcept
+    {
+        return (static_cast<int32_t>(difference) < 0) ? (0u - difference) : difference;
+    }
+};
+
+struct HeaderEntry
+{
+    std::vector<uint8_t> header;
+    size_t payloadLength;
+    std::vector<Lane> lanes;
+
+    HeaderEntry(const uint8_t* headerBytes, const size_t headerLength, const size_t payloadLength_)
+        : header(headerBytes, headerBytes + headerLength), payloadLength(payloadLength_), lanes((payloadLength_ + 3) / 4)
+    {
+    }
+};
+
+inline uint32_t loadLane(const uint8_t* payload, const size_t payloadLength, const size_t lane) noexcept
+{
+    uint32_t value = 0;
+    const size_t numBytes = std::min<size_t>(4, payloadLength - lane * 4);
+    for (size_t i = 0; i < numBytes; ++i) { value |= static_cast<uint32_t>(payload[lane * 4 + i]) << (8 * i); }
+    return value;
+}
+
+inline void storeLane(uint8_t* payload, const size_t payloadLength, const size_t lane, const uint32_t value) noexcept
+{
+    const size_t numBytes = std::min<size_t>(4, payloadLength - lane * 4);
+    for (size_t i = 0; i < numBytes; ++i) { payload[lane * 4 + i] = static_cast<uint8_t>(value >> (8 * i)); }
+}
+
+}  // namespace CompactLog
+
+/// @brief Encodes the bytes of a sensor stream, in order, to the CompactLog format. Packets split across calls are held back until complete.
+class CompactLogEncoder
+{
+public:
+    /// @brief Encodes the next bytes of the stream. The first call also emits the file magic.
+    /// @return The encoded bytes, valid until the next call.
+    const std::vector<uint8_t>& consume(const uint8_t* data, const size_t count)
+    {
+        _output.clear();
+        if (!_hasStarted)
+        {
+            _output.insert(_output.end(), std::begin(CompactLog::FILE_MAGIC), std::end(CompactLog::FILE_MAGIC));
+            _hasStarted = true;
+        }
+        _pending.insert(_pending.end(), data, data + count);
+        const ByteBuffer byteBuffer(_pending.data(), _pending.size(), _pending.size());
+
+        size_t index = 0;
+        size_t rawBegin = 0;
+        while (index < _pending.size())
+        {
+            if (_pending[index] != 0xFA)
+            {
+                ++index;
+                continue;
+            }
+
+            const auto findPacketRetVal = FaPacketProtocol::findPacket(byteBuffer, index);
+            if (findPacketRetVal.validity == FaPacketProtocol::Validity::Incomplete && (_pending.size() - index) < Config::PacketFinders::faPacketMaxLength)
+            {
+                break;
+            }
+            if (findPacketRetVal.validity != FaPacketProtocol::Validity::Valid)
+            {
+                ++index;
+                continue;
+            }
+
+            const auto& header = findPacketRetVal.metadata.header;
+            const size_t headerLength = header.outputGroups.size() + header.outputTypes.size() * 2;
+            const size_t payloadLength = findPacketRetVal.metadata.length - 1 - headerLength - 2;
+            const size_t id = _findHeader(_pending.data() + index + 1, headerLength, payloadLength);
+            if (id < CompactLog::MAX_NUM_HEADERS)
+            {
+                _putRaw(rawBegin, index);
+                _putPacket(id, _pending.data() + index + 1 + headerLength);
+                rawBegin = index + findPacketRetVal.metadata.length;
+            }
+            index += findPacketRetVal.metadata.length;
+        }
+
+        _putRaw(rawBegin, index);
+        _pending.erase(_pending.begin(), _pending.begin() + index);
+        return _output;
+    }
+
+    /// @brief Emits any bytes held back as the start of an incomplete packet. Call once the stream has ended.
+    /// @return The encoded bytes, valid until the next call.
+    const std::vector<uint8_t>& finish()
+    {
+        _output.clear();
+        _putRaw(0, _pending.size());
+        _pending.clear();
+        return _output;
+    }
+
+private:
+    bool _hasStarted = false;
+    std::vector<uint8_t> _pending;
+    std::vector<uint8_t> _output;
+    std::vector<CompactLog::HeaderEntry> _headers;
+    size_t _lastId = 0;
+
+    /// @return The header's id, defining it if new, or MAX_NUM_HEADERS if the dictionary is full.
+    size_t _findHeader(const uint8_t* headerBytes, const size_t headerLength, const size_t payloadLength)
+    {
+        const auto matches = [&](const CompactLog::HeaderEntry& entry)
+        {
+            return entry.payloadLength == payloadLength && entry.header.size() == headerLength &&
+                   std::memcmp(entry.header.data(), headerBytes, headerLength) == 0;
+        };
+        if (_lastId < _headers.size() && matches(_headers[_lastId])) { return _lastId; }
+        for (size_t id = 0; id < _headers.size(); ++id)
+        {
+            if (matches(_headers[id])) { return _lastId = id; }
+        }
+        if (_headers.size() == CompactLog::MAX_NUM_HEADERS) { return CompactLog::MAX_NUM_HEADERS; }
+
+        _headers.emplace_back(headerBytes, headerLength, payloadLength);
+        _output.push_back(CompactLog::DEFINE);
+        CompactLog::putVarint(_output, headerLength);
+        _output.insert(_output.end(), headerBytes, headerBytes + headerLength);
+        CompactLog::putVarint(_output, payloadLength);
+        return _lastId = _headers.size() - 1;
+    }
+
+    void _putRaw(const size_t begin, const size_t end)
+    {
+        if (begin >= end) { return; }
+        _output.push_back(CompactLog::RAW);
+        CompactLog::putVarint(_output, end - begin);
+        _output.insert(_output.end(), _pending.begin() + begin, _pending.begin() + end);
+    }
+
+    void _putPacket(const size_t id, const uint8_t* payload)
+    {
+        auto& entry = _headers[id];
+        _output.push_back(static_cast<uint8_t>(CompactLog::FIRST_PACKET + id));
+        const size_t bitmapIndex = _output.size();
+        _output.resize(_output.size() + (entry.lanes.size() + 7) / 8, 0);
+        for (size_t lane = 0; lane < entry.lanes.size(); ++lane)
+        {
+            const uint32_t value = CompactLog::loadLane(payload, entry.payloadLength, lane);
+            const uint32_t residual = value - entry.lanes[lane].predict();
+            if (residual != 0)
+            {
+                _output[bitmapIndex + lane / 8] |= static_cast<uint8_t>(1 << (lane % 8));
+                CompactLog::putVarint(_output, CompactLog::zigzag(residual));
+            }
+            entry.lanes[lane].update(value);
+        }
+    }
+};
+
+/// @brief Reconstructs the original byte stream from a CompactLog.
+class CompactLogDecoder
+{
+public:
+    /// @brief Decodes a whole CompactLog, appending the original bytes to output.
+    /// @return An error occurred, as the log is truncated or corrupt. Output holds the bytes decoded before it.
+    bool decode(const uint8_t* data, const size_t size, std::vector<uint8_t>& output)
+    {
+        if (!CompactLog::isCompactLog(data, size)) { return true; }
+        _headers.clear();
+        const uint8_t* const end = data + size;
+        data += sizeof(CompactLog::FILE_MAGIC);
+
+        uint64_t length = 0;
+        while (data < end)
+        {
+            const uint8_t tag = *data++;
+            switch (tag)
+            {
+                case CompactLog::RAW:
+                {
+                    if (CompactLog::getVarint(data, end, length) || length > static_cast<uint64_t>(end - data)) { return true; }
+                    output.insert(output.end(), data, data + length);
+                    data += length;
+                    break;
+                }
+                case CompactLog::DEFINE:
+                {
+                    if (_headers.size() == CompactLog::MAX_NUM_HEADERS) { return true; }
+                    if (CompactLog::getVarint(data, end, length) || length > static_cast<uint64_t>(end - data)) { return true; }
+                    const uint8_t* headerBytes = data;
+                    data += length;
+                    uint64_t payloadLength = 0;
+                    if (CompactLog::getVarint(data, end, payloadLength) || payloadLength > Config::PacketFinders::faPacketMaxLength) { return true; }
+                    _headers.emplace_back(headerBytes, length, payloadLength);
+                    break;
+                }
+                default:
+                {
+                    const size_t id = tag - CompactLog::FIRST_PACKET;
+                    if (id >= _headers.size() || _putPacket(_headers[id], data, end, output)) { return true; }
+                    break;
+                }
+            }
+        }
+        return false;
+    }
+
+private:
+    std::vector<CompactLog::HeaderEntry> _headers;
+
+    bool _putPacket(CompactLog::HeaderEntry& entry, const uint8_t*& data, const uint8_t* end, std::vector<uint8_t>& output)
+    {
+        const size_t bitmapLength = (entry.lanes.size() + 7) / 8;
+        if (bitmapLength > static_cast<size_t>(end - data)) { return true; }
+        const uint8_t* bitmap = data;
+        data += bitmapLength;
+
+        const size_t packetIndex = output.size();
+        output.push_back(0xFA);
+        output.insert(output.end(), entry.header.begin(), entry.header.end());
+        const size_t payloadIndex = output.size();
+        output.resize(payloadIndex + entry.payloadLength + 2);
+
+        uint64_t residual = 0;
+        for (size_t lane = 0; lane < entry.lanes.size(); ++lane)
+        {
+            residual = 0;
+            if (bitmap[lane / 8] & (1 << (lane % 8)))
+            {
+                if (CompactLog::getVarint(data, end, residual) || residual > UINT32_MAX)
+                {
+                    output.resize(packetIndex);  // Drop the partial packet, so output ends on the last whole one
+                    return true;
+                }
+            }
+            const uint32_t value = entry.lanes[lane].predict() + CompactLog::unzigzag(static_cast<uint32_t>(residual));
+            CompactLog::storeLane(output.data() + payloadIndex, entry.payloadLength, lane, value);
+            entry.lanes[lane].update(value);
+        }
+
+        const size_t crcIndex = payloadIndex + entry.payloadLength;
+        const uint16_t crc = CalculateCRC(output.data() + packetIndex + 1, crcIndex - packetIndex - 1);
+        output[crcIndex] = static_cast<uint8_t>(crc >> 8);
+        output[crcIndex + 1] = static_cast<uint8_t>(crc);
+        return false;
+    }
+};
+
+}  // namespace VN
+
+#endif  // SIMPLELOGGER_COMPACTLOG_HPP
@@ -0,0 +1,215 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef SIMPLELOGGER_LOGINDEX_HPP
+#define SIMPLELOGGER_LOGINDEX_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "Config.hpp"
+#include "HAL/File.hpp"
+#include "HAL/Timer.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "Interface/CompositeDataView.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+
+namespace VN
+{
+
+/// @brief One entry of a log's sidecar index. Every entry marks the start of an FA packet in the log, so parsing can begin at its byteOffset. Times are
+/// in nanoseconds, and are LogIndexEntry::unknown where the packet did not carry them.
+struct LogIndexEntry
+{
+    static constexpr uint64_t unknown = std::numeric_limits<uint64_t>::max();
+
+    uint64_t byteOffset;    // Into the bytes as received, which for a compact log is its decoded form
+    uint64_t packetNumber;  // Number of FA packets in the log before this one
+    uint64_t hostTime;      // Steady clock time the logger took the packet's bytes, as in ExporterCsv's systemTimeStamp
+    uint64_t timeStartup;
+    uint64_t timeGps;
+};
+static_assert(sizeof(LogIndexEntry) == 40, "Entries are written to the index as-is.");
+
+enum class LogTimeBase : uint8_t
+{
+    Host,
+    Startup,
+    Gps,
+};
+
+/// @brief The index file written alongside a log, which is the log's path with ".idx" appended.
+inline Filesystem::FilePath logIndexPath(const Filesystem::FilePath& logPath) { return Filesystem::FilePath(logPath + ".idx"); }
+
+/// @brief Builds a log's sidecar index from the bytes written to the log, in order. The index is the magic "VNIDX001" followed by little-endian
+/// LogIndexEntry records, one every interval of host or sensor startup time, whichever passes first.
+class LogIndexWriter
+{
+public:
+    static constexpr char FILE_MAGIC[8] = {'V', 'N', 'I', 'D', 'X', '0', '0', '1'};
+
+    LogIndexWriter(const Filesystem::FilePath& indexPath, const Microseconds interval = Config::DataExport::logIndexInterval)
+        : _interval(std::chrono::duration_cast<Nanoseconds>(interval).count())
+    {
+        if (!_file.open(indexPath)) { _file.write(FILE_MAGIC, sizeof(FILE_MAGIC)); }
+    }
+
+    bool is_open() const { return _file.is_open(); }
+
+    /// @brief Scans the next bytes written to the log. Packets split across calls are held back until complete.
+    void consume(const uint8_t* data, const size_t count, const time_point hostTime)
+    {
+        _pending.insert(_pending.end(), data, data + count);
+        const ByteBuffer byteBuffer(_pending.data(), _pending.size(), _pending.size());
+
+        size_t index = 0;
+        while (index < _pending.size())
+        {
+            if (_pending[index] != 0xFA)
+            {
+                ++index;
+                continue;
+            }
+
+            const auto findPacketRetVal = FaPacketProtocol::findPacket(byteBuffer, index);
+            if (findPacketRetVal.validity == FaPacketProtocol::Validity::Incomplete && (_pending.size() - index) < Config::PacketFinders::faPacketMaxLength)
+            {
+                break;
+            }
+            if (findPacketRetVal.validity != FaPacketProtocol::Validity::Valid)
+            {
+                ++index;
+                continue;
+            }
+
+            _onPacket(_pending.data() + index, findPacketRetVal.metadata, _pendingOffset + index, hostTime);
+            index += findPacketRetVal.metadata.length;
+        }
+
+        _pending.erase(_pending.begin(), _pending.begin() + index);
+        _pendingOffset += index;
+    }
+
+private:
+    OutputFile _file;
+    const uint64_t _interval;
+    std::vector<uint8_t> _pending;  // Bytes not yet scanned, as they may hold the start of an incomplete packet
+    uint64_t _pendingOffset = 0;    // Log offset of _pending[0]
+    uint64_t _numPackets = 0;
+    LogIndexEntry _lastEntry{LogIndexEntry::unknown, 0, 0, LogIndexEntry::unknown, LogIndexEntry::unknown};
+    CompositeDataView::OffsetTable _offsetTable;
+
+    void _onPacket(const uint8_t* packet, const FaPacketProtocol::Metadata& metadata, const uint64_t byteOffset, const time_point hostTime)
+    {
+        const CompositeDataView view(packet, metadata, _offsetTable);
+        const auto timeStartup = view.time().timeStartup();
+        const auto timeGps = view.time().timeGps();
+
+        LogIndexEntry entry{byteOffset, _numPackets++, static_cast<uint64_t>(std::chrono::duration_cast<Nanoseconds>(hostTime.time_since_epoch()).count()),
+                            timeStartup.has_value() ? timeStartup->nanoseconds() : LogIndexEntry::unknown,
+                            timeGps.has_value() ? timeGps->nanoseconds() : LogIndexEntry::unknown};
+
+        // A startup time going backwards is a sensor restart, which also warrants an entry
+        const bool isDue = (_lastEntry.byteOffset == LogIndexEntry::unknown) || (entry.hostTime - _lastEntry.hostTime >= _interval) ||
+                           (entry.timeStartup != LogIndexEntry::unknown &&
+                            (_lastEntry.timeStartup == LogIndexEntry::unknown || entry.timeStartup - _lastEntry.timeStartup >= _interval));
+        if (!isDue) { return; }
+
+        _file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+        _lastEntry = entry;
+    }
+};
+
+/// @brief Reads a log's sidecar index to find which bytes of the log cover a time range.
+class LogIndex
+{
+public:
+    /// @return An error occurred.
+    bool load(const Filesystem::FilePath& indexPath)
+    {
+        _entries.clear();
+        for (auto& times : _times) { times.clear(); }
+        if (!Filesystem::exists(indexPath)) { return true; }
+
+        const auto fileSizeInBytes = std::filesystem::file_size(indexPath.c_str());
+        if (fileSizeInBytes < sizeof(LogIndexWriter::FILE_MAGIC)) { return true; }
+        auto buffer = std::make_unique<char[]>(fileSizeInBytes);
+        InputFile inputFile(indexPath);
+        if (inputFile.read(buffer.get(), fileSizeInBytes)) { return true; }
+        if (std::memcmp(buffer.get(), LogIndexWriter::FILE_MAGIC, sizeof(LogIndexWriter::FILE_MAGIC)) != 0) { return true; }
+
+        const size_t numEntries = (fileSizeInBytes - sizeof(LogIndexWriter::FILE_MAGIC)) / sizeof(LogIndexEntry);
+        _entries.resize(numEntries);
+        std::memcpy(_entries.data(), buffer.get() + sizeof(LogIndexWriter::FILE_MAGIC), numEntries * sizeof(LogIndexEntry));
+
+        for (const auto& entry : _entries)
+        {
+            _addTime(LogTimeBase::Host, entry.hostTime, entry.byteOffset);
+            _addTime(LogTimeBase::Startup, entry.timeStartup, entry.byteOffset);
+            _addTime(LogTimeBase::Gps, entry.timeGps, entry.byteOffset);
+        }
+        return false;
+    }
+
+    const std::vector<LogIndexEntry>& entries() const noexcept { return _entries; }
+
+    /// @brief Finds the bytes of the log to parse for every packet between begin and end, inclusive. The range is widened to the nearest entries, so may
+    /// hold up to one index interval of packets either side. Only entries which carry the time base are used.
+    /// @return The offset of the first byte and one past the last, which is LogIndexEntry::unknown to read to the end of the log.
+    std::pair<uint64_t, uint64_t> byteRange(const LogTimeBase timeBase, const uint64_t begin, const uint64_t end) const
+    {
+        const auto& times = _times[static_cast<size_t>(timeBase)];
+        const auto byTime = [](const std::pair<uint64_t, uint64_t>& lhs, const std::pair<uint64_t, uint64_t>& rhs) { return lhs.first < rhs.first; };
+
+        // The last entry at or before begin, and the first after end
+        auto first = std::upper_bound(times.begin(), times.end(), std::make_pair(begin, uint64_t{0}), byTime);
+        const uint64_t firstByte = (first == times.begin()) ? 0 : std::prev(first)->second;
+        const auto last = std::upper_bound(times.begin(), times.end(), std::make_pair(end, uint64_t{0}), byTime);
+        const uint64_t lastByte = (last == times.end()) ? LogIndexEntry::unknown : last->second;
+        return {firstByte, std::max(firstByte, lastByte)};
+    }
+
+private:
+    std::vector<LogIndexEntry> _entries;
+    std::array<std::vector<std::pair<uint64_t, uint64_t>>, 3> _times;  // Per time base, the (time, byteOffset) of each entry which carries it
+
+    void _addTime(const LogTimeBase timeBase, const uint64_t time, const uint64_t byteOffset)
+    {
+        if (time == LogIndexEntry::unknown) { return; }
+        auto& times = _times[static_cast<size_t>(timeBase)];
+        // Keep times sorted for searching. A sensor restart resets startup time, after which only the latest run is searchable.
+        if (!times.empty() && time < times.back().first) { times.clear(); }
+        times.emplace_back(time, byteOffset);
+    }
+};
+
+}  // namespace VN
+
+#endif  // SIMPLELOGGER_LOGINDEX_HPP
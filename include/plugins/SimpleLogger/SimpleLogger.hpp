@@ -29,23 +29,46 @@
 #include "Interface/Sensor.hpp"
 #include "HAL/File.hpp"
 #include "TemplateLibrary/ByteBuffer.hpp"
+#include "LogIndex.hpp"
+#include "CompactLog.hpp"
 
 namespace VN
 {
 
+enum class LogFormat : uint8_t
+{
+    Raw,      // The bytes exactly as received
+    Compact,  // CompactLog encoded, which FileExporter decodes back to the received bytes
+};
+
 class SimpleLogger
 {
 public:
-    SimpleLogger(ByteBuffer& bufferToLog, const Filesystem::FilePath& filePath) : _bufferToLog(bufferToLog) { _logFile.open(filePath); }
+    /// @param writeIndex Also writes a sidecar index to logIndexPath(filePath), which lets FileExporter process a time range of the log without parsing
+    /// all of it.
+    SimpleLogger(ByteBuffer& bufferToLog, const Filesystem::FilePath& filePath, const bool writeIndex = false, const LogFormat format = LogFormat::Raw)
+        : _bufferToLog(bufferToLog), _consumerSignal(bufferToLog.capacity() / Config::DataExport::wakeFillDivisor, Config::DataExport::wakeMaxLatency)
+    {
+        _logFile.open(filePath);
+        if (writeIndex) { _indexWriter = std::make_unique<LogIndexWriter>(logIndexPath(filePath)); }
+        if (format == LogFormat::Compact) { _encoder = std::make_unique<CompactLogEncoder>(); }
+        _bufferToLog.setConsumerSignal(&_consumerSignal);
+    }
 
-    ~SimpleLogger() { stop(); }
+    ~SimpleLogger()
+    {
+        stop();
+        _bufferToLog.setConsumerSignal(nullptr);
+    }
 
     SimpleLogger(const SimpleLogger&) = delete;
     SimpleLogger& operator=(const SimpleLogger&) = delete;
     SimpleLogger(SimpleLogger&&) = delete;
     SimpleLogger& operator=(SimpleLogger&&) = delete;
 
-    static int32_t logBuffer(OutputFile& outputFile, ByteBuffer& buffer)
+    /// @param encoder Writes the bytes CompactLog encoded, rather than as received.
+    /// @return The number of bytes taken from the buffer, or -1 on error.
+    static int32_t logBuffer(OutputFile& outputFile, ByteBuffer& buffer, LogIndexWriter* indexWriter = nullptr, CompactLogEncoder* encoder = nullptr)
     {
         if (!outputFile.is_open()) { return -1; }
         const size_t bufferSize = buffer.size();
@@ -53,14 +76,17 @@ public:
         size_t numLinearBytes = buffer.numLinearBytes();
 
         const size_t bytesToLog = std::min(bufferSize, numLinearBytes);
-        if (outputFile.write(reinterpret_cast<const char*>(buffer.head()), bytesToLog)) { return -1; }
+        if (_write(outputFile, buffer.head(), bytesToLog, encoder)) { return -1; }
+        const time_point loggedTime = now();
+        if (indexWriter) { indexWriter->consume(buffer.head(), bytesToLog, loggedTime); }
         size_t bytesLogged = bytesToLog;
         buffer.discard(bytesLogged);
         if (bufferSize > numLinearBytes)
         {
             numLinearBytes = buffer.numLinearBytes();
             bytesLogged += numLinearBytes;
-            if (outputFile.write(reinterpret_cast<const char*>(buffer.head()), numLinearBytes)) { return -1; }  // Write the second section
+            if (_write(outputFile, buffer.head(), numLinearBytes, encoder)) { return -1; }  // Write the second section
+            if (indexWriter) { indexWriter->consume(buffer.head(), numLinearBytes, loggedTime); }
             buffer.discard(numLinearBytes);
         }
         return bytesLogged;
@@ -79,6 +105,7 @@ public:
         if (_logging)
         {
             _logging = false;
+            _consumerSignal.interrupt();
             _loggingThread->join();
         }
     }
@@ -88,22 +115,36 @@ public:
     size_t numBytesLogged() { return _numBytesLogged; }
 
 protected:
+    static bool _write(OutputFile& outputFile, const uint8_t* data, const size_t count, CompactLogEncoder* encoder)
+    {
+        if (!encoder) { return outputFile.write(reinterpret_cast<const char*>(data), count); }
+        const auto& encoded = encoder->consume(data, count);
+        return !encoded.empty() && outputFile.write(reinterpret_cast<const char*>(encoded.data()), encoded.size());
+    }
+
     void _log()
     {
         while (_logging)
         {
-            _numBytesLogged += logBuffer(_logFile, _bufferToLog);
-            thisThread::sleepFor(sleepDuration);
+            _consumerSignal.waitForBatch();
+            _numBytesLogged += logBuffer(_logFile, _bufferToLog, _indexWriter.get(), _encoder.get());
+        }
+        _numBytesLogged += logBuffer(_logFile, _bufferToLog, _indexWriter.get(), _encoder.get());
+        if (_encoder)
+        {
+            const auto& encoded = _encoder->finish();
+            if (!encoded.empty()) { _logFile.write(reinterpret_cast<const char*>(encoded.data()), encoded.size()); }
         }
-        _numBytesLogged += logBuffer(_logFile, _bufferToLog);
         _logFile.close();
     }
 
-    Microseconds sleepDuration = 1ms;
     std::atomic<bool> _logging = false;
     OutputFile _logFile;
     ByteBuffer& _bufferToLog;
+    ConsumerSignal _consumerSignal;
     std::unique_ptr<Thread> _loggingThread = nullptr;
+    std::unique_ptr<LogIndexWriter> _indexWriter = nullptr;
+    std::unique_ptr<CompactLogEncoder> _encoder = nullptr;
     size_t _numBytesLogged = 0;
 };
 
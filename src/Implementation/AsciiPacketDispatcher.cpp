@@ -37,6 +37,7 @@ void AsciiPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const s
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
     bool packetHasBeenConsumed = false;
+    if (_linkMonitor != nullptr) { _linkMonitor->onAsciiPacket(_latestPacketMetadata.header); }
     if (StringUtils::startsWith(_latestPacketMetadata.header, "VN"))
     {
         AsciiPacketProtocol::AsciiMeasurementHeader asciiHeader = AsciiPacketProtocol::getMeasHeader(_latestPacketMetadata.header);
@@ -45,9 +46,14 @@ void AsciiPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const s
             if (AsciiPacketProtocol::asciiIsParsable(asciiHeader))
             {
                 _invokeSubscribers(byteBuffer, syncByteIndex, _latestPacketMetadata);
+                if (_latestMeasurements != nullptr) { _latestMeasurements->publish(byteBuffer, syncByteIndex, _latestPacketMetadata, asciiHeader); }
                 if constexpr (Config::PacketDispatchers::compositeDataQueueCapacity > 0)
                 {
-                    packetHasBeenConsumed |= _tryPushToCompositeDataQueue(byteBuffer, syncByteIndex, _latestPacketMetadata, asciiHeader);
+                    if (_deferredPacketQueue != nullptr)
+                    {
+                        packetHasBeenConsumed |= !_tryPushToPacketQueue(byteBuffer, syncByteIndex, _latestPacketMetadata, _deferredPacketQueue);
+                    }
+                    else { packetHasBeenConsumed |= _tryPushToCompositeDataQueue(byteBuffer, syncByteIndex, _latestPacketMetadata, asciiHeader); }
                 }
             }
         }
@@ -55,7 +61,9 @@ void AsciiPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const s
         {  // Data is not a measurement. This includes vnerrs.
             VN_DEBUG_1("Passing command response.");
             AsciiMessage packet{};
-            for (size_t idx = 0; idx < _latestPacketMetadata.length; idx++) { packet.push_back(byteBuffer.peek_unchecked(syncByteIndex + idx)); }
+            const size_t numBytesToCopy = std::min(static_cast<size_t>(_latestPacketMetadata.length), AsciiMessage::capacity());
+            byteBuffer.peek_unchecked(reinterpret_cast<uint8_t*>(packet.data()), numBytesToCopy, syncByteIndex);
+            packet.setLength(numBytesToCopy);
             _commandProcessor->matchResponse(packet, _latestPacketMetadata);
         }
     }
@@ -65,6 +73,15 @@ void AsciiPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const s
     }
 }
 
+bool AsciiPacketDispatcher::parseDeferredPacket(const Packet& packet) noexcept
+{
+    if (packet.details.syncByte != PacketDetails::SyncByte::Ascii) { return true; }
+    const AsciiPacketProtocol::Metadata& metadata = packet.details.asciiMetadata;
+    const ByteBuffer byteBuffer(packet.buffer, metadata.length, metadata.length);
+    const AsciiPacketProtocol::AsciiMeasurementHeader asciiHeader = AsciiPacketProtocol::getMeasHeader(metadata.header);
+    return !_tryPushToCompositeDataQueue(byteBuffer, 0, metadata, asciiHeader);
+}
+
 bool AsciiPacketDispatcher::addSubscriber(PacketQueue_Interface* subscriber, const AsciiHeader& headerToUse, SubscriberFilterType filterType) noexcept
 {
     if (subscriber == nullptr) { return true; }
@@ -121,28 +138,30 @@ void AsciiPacketDispatcher::_invokeSubscribers(const ByteBuffer& byteBuffer, con
         {
             if (subscriber.filterType == SubscriberFilterType::StartsWith)
             {
-                [[maybe_unused]] const bool failed = _tryPushToSubscriber(byteBuffer, syncByteIndex, metadata, subscriber);
+                [[maybe_unused]] const bool failed = _tryPushToPacketQueue(byteBuffer, syncByteIndex, metadata, subscriber.queueToPush);
             }
         }
         else
         {
             if (subscriber.filterType == SubscriberFilterType::DoesNotStartWith)
             {
-                [[maybe_unused]] const bool failed = _tryPushToSubscriber(byteBuffer, syncByteIndex, metadata, subscriber);
+                [[maybe_unused]] const bool failed = _tryPushToPacketQueue(byteBuffer, syncByteIndex, metadata, subscriber.queueToPush);
             }
         }
     }
 }
 
-bool AsciiPacketDispatcher::_tryPushToSubscriber(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata,
-                                                 Subscriber& subscriber) noexcept
+bool AsciiPacketDispatcher::_tryPushToPacketQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata,
+                                                  PacketQueue_Interface* packetQueue) noexcept
 {
-    auto putSlot = subscriber.queueToPush->put();
+    auto putSlot = packetQueue->put();
     if (putSlot)
     {
         putSlot->details.syncByte = PacketDetails::SyncByte::Ascii;
         putSlot->details.asciiMetadata = metadata;
         byteBuffer.peek_unchecked(putSlot->buffer, metadata.length, syncByteIndex);
+        putSlot = nullptr;  // Releases the packet into the queue before waking its consumer
+        packetQueue->notifyConsumer();
     }
     else
     {
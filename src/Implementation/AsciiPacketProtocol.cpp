@@ -25,7 +25,9 @@
 
 #include "Config.hpp"
 #include "Interface/CompositeData.hpp"
+#include <array>
 #include <cstdint>
+#include <cstring>
 #include "TemplateLibrary/String.hpp"
 #include "Implementation/CoreUtils.hpp"
 #include "HAL/Timer.hpp"
@@ -38,15 +40,181 @@ namespace AsciiPacketProtocol
 // namespace {
 struct AsciiMeasurementIndices
 {
-    AsciiMeasurementIndices() {};
-    AsciiMeasurementIndices(uint8_t MeasGroupIndex, uint8_t MeasTypeIndex) : measGroupIndex(MeasGroupIndex), measTypeIndex(MeasTypeIndex) {};
+    constexpr AsciiMeasurementIndices() : measGroupIndex(0), measTypeIndex(0) {};
+    constexpr AsciiMeasurementIndices(uint8_t MeasGroupIndex, uint8_t MeasTypeIndex) : measGroupIndex(MeasGroupIndex), measTypeIndex(MeasTypeIndex) {};
     uint8_t measGroupIndex;
     uint8_t measTypeIndex;
 };
 
-std::optional<Vector<AsciiMeasurementIndices, 9>> _getAsciiMeasurementIndices(const AsciiMeasurementHeader asciiHeader);
-bool _parseAsciiMessage(const AsciiMeasurementHeader asciiHeader, const ByteBuffer& buffer, const size_t syncByteIdx, const Metadata& metadata,
-                        CompositeData& compositeData);
+/// @brief Describes the fields of an ASCII measurement message, in order. Indexed by AsciiMeasurementHeader.
+struct AsciiMeasurementSchema
+{
+    AsciiMeasurementHeader header;
+    bool isMeasurement;
+    uint8_t numParameters;
+    uint8_t numMeasurements;
+    std::array<AsciiMeasurementIndices, 9> measurements;
+
+    constexpr const AsciiMeasurementIndices* begin() const noexcept { return measurements.data(); }
+    constexpr const AsciiMeasurementIndices* end() const noexcept { return measurements.data() + numMeasurements; }
+};
+
+constexpr std::array<AsciiMeasurementSchema, 23> asciiMeasurementSchemas = {
+    AsciiMeasurementSchema{AsciiMeasurementHeader::None, false, 0, 0, {{}}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::INS, true, 15, 9, {{
+                               AsciiMeasurementIndices(1, 2),  // GpsTow
+                               AsciiMeasurementIndices(1, 3),  // GpsWeek
+                               AsciiMeasurementIndices(5, 0),  // InsStatus
+                               AsciiMeasurementIndices(4, 1),  // Ypr
+                               AsciiMeasurementIndices(5, 1),  // PosLla
+                               AsciiMeasurementIndices(5, 4),  // VelNed
+                               AsciiMeasurementIndices(4, 13),  // AttU
+                               AsciiMeasurementIndices(5, 9),  // PosU
+                               AsciiMeasurementIndices(5, 10),  // VelU
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::YPR, true, 3, 1, {{
+                               AsciiMeasurementIndices(4, 1),  // Ypr
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::QTN, true, 4, 1, {{
+                               AsciiMeasurementIndices(4, 2),  // Quaternion
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::QMR, true, 13, 4, {{
+                               AsciiMeasurementIndices(4, 2),  // Quaternion
+                               AsciiMeasurementIndices(2, 8),  // Mag
+                               AsciiMeasurementIndices(2, 9),  // Accel
+                               AsciiMeasurementIndices(2, 10),  // AngularRate
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::MAG, true, 3, 1, {{
+                               AsciiMeasurementIndices(2, 8),  // Mag
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::ACC, true, 3, 1, {{
+                               AsciiMeasurementIndices(2, 9),  // Accel
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::GYR, true, 3, 1, {{
+                               AsciiMeasurementIndices(2, 10),  // AngularRate
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::MAR, true, 9, 3, {{
+                               AsciiMeasurementIndices(2, 8),  // Mag
+                               AsciiMeasurementIndices(2, 9),  // Accel
+                               AsciiMeasurementIndices(2, 10),  // AngularRate
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::YMR, true, 12, 4, {{
+                               AsciiMeasurementIndices(4, 1),  // Ypr
+                               AsciiMeasurementIndices(2, 8),  // Mag
+                               AsciiMeasurementIndices(2, 9),  // Accel
+                               AsciiMeasurementIndices(2, 10),  // AngularRate
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::YBA, true, 9, 3, {{
+                               AsciiMeasurementIndices(4, 1),  // Ypr
+                               AsciiMeasurementIndices(4, 6),  // LinBodyAcc
+                               AsciiMeasurementIndices(2, 10),  // AngularRate
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::YIA, true, 9, 3, {{
+                               AsciiMeasurementIndices(4, 1),  // Ypr
+                               AsciiMeasurementIndices(4, 7),  // LinAccelNed
+                               AsciiMeasurementIndices(2, 10),  // AngularRate
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::IMU, true, 11, 5, {{
+                               AsciiMeasurementIndices(2, 1),  // UncompMag
+                               AsciiMeasurementIndices(2, 2),  // UncompAccel
+                               AsciiMeasurementIndices(2, 3),  // UncompGyro
+                               AsciiMeasurementIndices(2, 4),  // Temperature
+                               AsciiMeasurementIndices(2, 5),  // Pressure
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::GPS, true, 15, 9, {{
+                               AsciiMeasurementIndices(3, 1),  // GpsTow
+                               AsciiMeasurementIndices(3, 2),  // GpsWeek
+                               AsciiMeasurementIndices(3, 4),  // GnssFix
+                               AsciiMeasurementIndices(3, 3),  // NumSats
+                               AsciiMeasurementIndices(3, 5),  // GnssPosLla
+                               AsciiMeasurementIndices(3, 7),  // GnssVelNed
+                               AsciiMeasurementIndices(3, 9),  // GnssPosUncertainty
+                               AsciiMeasurementIndices(3, 10),  // GnssVelUncertainty
+                               AsciiMeasurementIndices(3, 11),  // GnssTimeUncertainty
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::GPE, true, 15, 9, {{
+                               AsciiMeasurementIndices(3, 1),  // GpsTow
+                               AsciiMeasurementIndices(3, 2),  // GpsWeek
+                               AsciiMeasurementIndices(3, 4),  // GnssFix
+                               AsciiMeasurementIndices(3, 3),  // NumSats
+                               AsciiMeasurementIndices(3, 6),  // GnssPosEcef
+                               AsciiMeasurementIndices(3, 8),  // GnssVelEcef
+                               AsciiMeasurementIndices(3, 9),  // GnssPosUncertaintyEcef
+                               AsciiMeasurementIndices(3, 10),  // GnssVelUncertainty
+                               AsciiMeasurementIndices(3, 11),  // GnssTimeUncertainty
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::INE, true, 15, 9, {{
+                               AsciiMeasurementIndices(1, 2),  // GpsTow
+                               AsciiMeasurementIndices(1, 3),  // GpsWeek
+                               AsciiMeasurementIndices(5, 0),  // InsStatus
+                               AsciiMeasurementIndices(4, 1),  // Ypr
+                               AsciiMeasurementIndices(5, 2),  // PosEcef
+                               AsciiMeasurementIndices(5, 5),  // VelEcef
+                               AsciiMeasurementIndices(4, 13),  // AttU
+                               AsciiMeasurementIndices(5, 9),  // PosU
+                               AsciiMeasurementIndices(5, 10),  // VelU
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::ISL, true, 15, 5, {{
+                               AsciiMeasurementIndices(4, 1),  // Ypr
+                               AsciiMeasurementIndices(5, 1),  // PosLla
+                               AsciiMeasurementIndices(5, 4),  // VelNed
+                               AsciiMeasurementIndices(2, 9),  // Accel
+                               AsciiMeasurementIndices(2, 10),  // AngularRate
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::ISE, true, 15, 5, {{
+                               AsciiMeasurementIndices(4, 1),  // Ypr
+                               AsciiMeasurementIndices(5, 2),  // PosEcef
+                               AsciiMeasurementIndices(5, 5),  // VelEcef
+                               AsciiMeasurementIndices(2, 9),  // Accel
+                               AsciiMeasurementIndices(2, 10),  // AngularRate
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::DTV, true, 7, 2, {{
+                               AsciiMeasurementIndices(2, 6),  // DeltaTheta
+                               AsciiMeasurementIndices(2, 7),  // DeltaVel
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::G2S, true, 15, 9, {{
+                               AsciiMeasurementIndices(6, 1),  // GpsTow
+                               AsciiMeasurementIndices(6, 2),  // GpsWeek
+                               AsciiMeasurementIndices(6, 4),  // GnssFix
+                               AsciiMeasurementIndices(6, 3),  // NumSats
+                               AsciiMeasurementIndices(6, 5),  // GnssPosLla
+                               AsciiMeasurementIndices(6, 7),  // GnssVelNed
+                               AsciiMeasurementIndices(6, 9),  // GnssPosUncertainty
+                               AsciiMeasurementIndices(6, 10),  // GnssVelUncertainty
+                               AsciiMeasurementIndices(6, 11),  // GnssTimeUncertainty
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::G2E, true, 15, 9, {{
+                               AsciiMeasurementIndices(6, 1),  // GpsTow
+                               AsciiMeasurementIndices(6, 2),  // GpsWeek
+                               AsciiMeasurementIndices(6, 4),  // GnssFix
+                               AsciiMeasurementIndices(6, 3),  // NumSats
+                               AsciiMeasurementIndices(6, 6),  // GnssPosEcef
+                               AsciiMeasurementIndices(6, 8),  // GnssVelEcef
+                               AsciiMeasurementIndices(6, 9),  // GnssPosUncertaintyEcef
+                               AsciiMeasurementIndices(6, 10),  // GnssVelUncertainty
+                               AsciiMeasurementIndices(6, 11),  // GnssTimeUncertainty
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::HVE, true, 3, 1, {{
+                               AsciiMeasurementIndices(4, 12),  // Heave
+                           }}},
+    AsciiMeasurementSchema{AsciiMeasurementHeader::RTK, true, 0, 0, {{}}},  // Deprecated or unused measurements
+};
+
+constexpr bool _schemasAreIndexedByHeader() noexcept
+{
+    for (size_t i = 0; i < asciiMeasurementSchemas.size(); ++i)
+    {
+        if (static_cast<size_t>(asciiMeasurementSchemas[i].header) != i) { return false; }
+    }
+    return true;
+}
+static_assert(_schemasAreIndexedByHeader(), "asciiMeasurementSchemas must be ordered as AsciiMeasurementHeader.");
+
+constexpr const AsciiMeasurementSchema& _getSchema(const AsciiMeasurementHeader header) noexcept
+{
+    const size_t index = static_cast<size_t>(header);
+    return (index < asciiMeasurementSchemas.size()) ? asciiMeasurementSchemas[index] : asciiMeasurementSchemas[0];
+}
 
 using HeaderChars = std::array<char, 5>;
 
@@ -64,93 +232,48 @@ constexpr std::array<std::tuple<HeaderChars, AsciiMeasurementHeader>, 22> header
     std::make_tuple(HeaderChars{"G2S"}, AsciiMeasurementHeader::G2S), std::make_tuple(HeaderChars{"G2E"}, AsciiMeasurementHeader::G2E),
     std::make_tuple(HeaderChars{"HVE"}, AsciiMeasurementHeader::HVE), std::make_tuple(HeaderChars{"RTK"}, AsciiMeasurementHeader::RTK)};
 
-uint8_t _getNumAsciiParameters(const AsciiMeasurementHeader header)
+// Hashes the three measurement characters of a header (e.g. "YPR" of "VNYPR"). The constants are chosen so every entry of headerMapping lands in its own
+// slot, which is checked below, so a lookup is a single hash and compare.
+constexpr uint8_t _hashMeasHeader(const char* chars) noexcept
 {
-    switch (header)
+    return ((static_cast<uint8_t>(chars[0]) * 5 + static_cast<uint8_t>(chars[1]) * 48 + static_cast<uint8_t>(chars[2])) >> 2) & 0x1F;
+}
+
+struct HeaderHashTable
+{
+    std::array<uint8_t, 32> slots{};  // One plus the index into headerMapping, or 0 if empty
+    bool isPerfect = true;
+};
+
+constexpr HeaderHashTable _buildHeaderHashTable() noexcept
+{
+    HeaderHashTable retVal;
+    for (size_t i = 0; i < headerMapping.size(); ++i)
     {
-        case AsciiMeasurementHeader::QTN:
-        {
-            return 4;
-        }
-        case AsciiMeasurementHeader::QMR:
-        {
-            return 13;
-        }
-        case AsciiMeasurementHeader::YPR:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::MAG:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::ACC:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::HVE:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::GYR:
-        {
-            return 3;
-        }
-        case AsciiMeasurementHeader::YMR:
-        {
-            return 12;
-        }
-        case AsciiMeasurementHeader::MAR:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::YBA:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::YIA:
-        {
-            return 9;
-        }
-        case AsciiMeasurementHeader::IMU:
-        {
-            return 11;
-        }
-        case AsciiMeasurementHeader::GPS:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::GPE:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::G2S:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::G2E:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::INS:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::INE:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::ISL:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::ISE:
-        {
-            return 15;
-        }
-        case AsciiMeasurementHeader::DTV:
-        {
-            return 7;
-        }
-        case AsciiMeasurementHeader::RTK:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::None:
-        {
-            return 0;
-        }
-        default:
-            return 0;
+        const uint8_t hash = _hashMeasHeader(std::get<0>(headerMapping[i]).data());
+        if (retVal.slots[hash] != 0) { retVal.isPerfect = false; }
+        retVal.slots[hash] = static_cast<uint8_t>(i + 1);
     }
+    return retVal;
 }
 
+constexpr HeaderHashTable headerHashTable = _buildHeaderHashTable();
+static_assert(headerHashTable.isPerfect, "_hashMeasHeader has a collision over headerMapping.");
+
 AsciiMeasurementHeader getMeasHeader(AsciiHeader headerChars)
 {
-    for (const auto& mapEntry : headerMapping)
-    {
-        if (std::memcmp(headerChars.data() + 2, std::get<0>(mapEntry).data(), sizeof(char) * 3) == 0) { return std::get<1>(mapEntry); }
-    }
+    const char* measChars = headerChars.data() + 2;
+    const uint8_t slot = headerHashTable.slots[_hashMeasHeader(measChars)];
+    if (slot == 0) { return AsciiMeasurementHeader::None; }
+    const auto& mapEntry = headerMapping[slot - 1];
+    if (std::memcmp(measChars, std::get<0>(mapEntry).data(), sizeof(char) * 3) == 0) { return std::get<1>(mapEntry); }
     return AsciiMeasurementHeader::None;
 }
 
 EnabledMeasurements asciiHeaderToMeasHeader(const AsciiMeasurementHeader header) noexcept
 {
     EnabledMeasurements presentMeasurements = {};
-    auto asciiMeasurementIndices = _getAsciiMeasurementIndices(header).value();
-    for (const auto& currentMeasField : asciiMeasurementIndices)
+    for (const auto& currentMeasField : _getSchema(header))
     {
         VN_ASSERT((presentMeasurements.size() > static_cast<uint8_t>(currentMeasField.measGroupIndex - 1)));  // Subtructing 1 because of Common group offset
         presentMeasurements.at(currentMeasField.measGroupIndex - 1) |= 1 << currentMeasField.measTypeIndex;   // Subtructing 1 because of Common group offset
@@ -170,11 +293,12 @@ bool allDataIsEnabled(const AsciiMeasurementHeader header, const EnabledMeasurem
     return (isEnabled);
 }
 
-bool asciiIsMeasurement(const AsciiMeasurementHeader header) noexcept { return _getAsciiMeasurementIndices(header).has_value(); }
+bool asciiIsMeasurement(const AsciiMeasurementHeader header) noexcept { return _getSchema(header).isMeasurement; }
 
 bool asciiIsParsable(const AsciiPacketProtocol::AsciiMeasurementHeader header) noexcept
 {
-    return (_getAsciiMeasurementIndices(header).has_value() && !_getAsciiMeasurementIndices(header).value().empty());
+    const AsciiMeasurementSchema& schema = _getSchema(header);
+    return (schema.isMeasurement && schema.numMeasurements != 0);
 }
 
 bool anyDataIsEnabled(const AsciiMeasurementHeader header, const EnabledMeasurements& measurementsToCheck) noexcept
@@ -202,33 +326,26 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
     Metadata details;
     details.timestamp = now();
 
-    auto tmpByte = byteBuffer.peek_unchecked(syncByteIndex);
-    if (tmpByte != static_cast<uint8_t>('$')) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }  // It was a mistake to come here.
-
-    // Search for the end of the packet (\n)
-    const auto newlineCharacterIndex = byteBuffer.find('\n', syncByteIndex);
-    if (!newlineCharacterIndex.has_value())
+    if (byteBuffer.peek_unchecked(syncByteIndex) != static_cast<uint8_t>('$'))
     {
-        if (byteBuffer.size() - syncByteIndex > Config::PacketFinders::asciiPacketMaxLength)
-        {
-            return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}};
-        }
-        else { return {PacketDispatcher::FindPacketRetVal::Validity::Incomplete, Metadata{}}; }
+        return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}};  // It was a mistake to come here.
     }
 
-    const bool isMissingCarriageReturn = byteBuffer.peek_unchecked(newlineCharacterIndex.value() - 1) != '\r';
-
-    details.length = newlineCharacterIndex.value() - syncByteIndex + 1;
-
-    if (details.length > Config::PacketFinders::asciiPacketMaxLength) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }
+    // Take one linear copy of everything that could belong to this packet, then tokenize, validate, and checksum it in a single pass.
+    const size_t numBytesAvailable = byteBuffer.size() - syncByteIndex;
+    const size_t numBytesToScan = std::min(numBytesAvailable, static_cast<size_t>(Config::PacketFinders::asciiPacketMaxLength));
+    std::array<uint8_t, Config::PacketFinders::asciiPacketMaxLength> packet;
+    byteBuffer.peek_unchecked(packet.data(), numBytesToScan, syncByteIndex);
 
+    std::array<char, Config::PacketFinders::asciiHeaderMaxLength> headerChars;
+    size_t headerLength = 0;
     bool processingHeader = true;
     uint8_t checksum8 = 0;
     uint16_t crc16 = 0;
-    for (size_t fromSyncByteIndex = 1; fromSyncByteIndex < details.length; ++fromSyncByteIndex)
-    {                                                              // Beginning one after the sync byte, but mark it as checked
-        size_t fromTailIndex = syncByteIndex + fromSyncByteIndex;  // Should be zero-based, but is relative to current absolute tail.
-        tmpByte = byteBuffer.peek_unchecked(fromTailIndex);
+    size_t asteriskIndex = 0;
+    for (size_t fromSyncByteIndex = 1; fromSyncByteIndex < numBytesToScan; ++fromSyncByteIndex)
+    {
+        const uint8_t tmpByte = packet[fromSyncByteIndex];
         if (tmpByte == ',')
         {
             details.delimiterIndices.push_back(fromSyncByteIndex);
@@ -237,23 +354,38 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
         else if (tmpByte == '*')
         {
             details.delimiterIndices.push_back(fromSyncByteIndex);
-            processingHeader = false;
+            asteriskIndex = fromSyncByteIndex;
             break;
         }
         else if (((tmpByte < ' ') || (tmpByte > '~') || (tmpByte == '$')) && (tmpByte != '\r'))
         {
-            // Contains a non-ascii character
+            // Contains a non-ascii character (including a newline before the checksum), so this can never become a valid packet.
             return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}};
         }
         if (processingHeader)
         {
             if (fromSyncByteIndex > Config::PacketFinders::asciiHeaderMaxLength) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }
-            details.header.push_back(tmpByte);
+            headerChars[headerLength++] = static_cast<char>(tmpByte);
         }
         _calculateCheckSum(&checksum8, tmpByte);
         _calculateCRC(&crc16, tmpByte);
     }
 
+    // Search for the end of the packet (\n)
+    const uint8_t* newline = (asteriskIndex == 0)
+                                 ? nullptr
+                                 : static_cast<const uint8_t*>(std::memchr(packet.data() + asteriskIndex, '\n', numBytesToScan - asteriskIndex));
+    if (newline == nullptr)
+    {
+        if (numBytesAvailable > Config::PacketFinders::asciiPacketMaxLength) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }
+        else { return {PacketDispatcher::FindPacketRetVal::Validity::Incomplete, Metadata{}}; }
+    }
+    const size_t newlineIndex = static_cast<size_t>(newline - packet.data());
+
+    details.header = AsciiHeader(headerChars.data(), headerLength);
+    details.length = newlineIndex + 1;
+    const bool isMissingCarriageReturn = packet[newlineIndex - 1] != '\r';
+
     const size_t bytesBetweenAstereskAndNewline = details.length - details.delimiterIndices.back();
     uint8_t crcLength;
     uint16_t calculatedChecksum;
@@ -278,13 +410,12 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
     uint16_t reportedChecksum;
 
     // Verify Check Sum
-    char crcStr[4] = {0, 0, 0, 0};
+    const size_t crcBeginIndex = (details.length - 1) - (crcLength + 1 - isMissingCarriageReturn);
+    const char* crcStr = reinterpret_cast<const char*>(packet.data() + crcBeginIndex);
     switch (crcLength)
     {
         case 2:
         {
-            const size_t crcBeginIndex = (details.length - 1) - (crcLength + 1 - isMissingCarriageReturn);
-            byteBuffer.peek_unchecked(reinterpret_cast<uint8_t*>(crcStr), 2, syncByteIndex + crcBeginIndex);
             const std::optional<uint8_t> reportedCrc8 = StringUtils::fromStringHex<uint8_t>(crcStr, crcStr + 2);
             if (!reportedCrc8.has_value()) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }
             reportedChecksum = reportedCrc8.value();
@@ -292,8 +423,6 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
         }
         case 4:
         {
-            const size_t crcBeginIndex = (details.length - 1) - (crcLength + 1 - isMissingCarriageReturn);
-            byteBuffer.peek_unchecked(reinterpret_cast<uint8_t*>(crcStr), 4, syncByteIndex + crcBeginIndex);
             const std::optional<uint16_t> reportedCrc16 = StringUtils::fromStringHex<uint16_t>(crcStr, crcStr + 4);
             if (!reportedCrc16.has_value()) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }
             reportedChecksum = reportedCrc16.value();
@@ -311,16 +440,16 @@ std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
 
-    const uint8_t numExpectedDelimeters = _getNumAsciiParameters(measEnum) + 1;
+    const AsciiMeasurementSchema& schema = _getSchema(measEnum);
+    const uint8_t numExpectedDelimeters = schema.numParameters + 1;
     // delimeters are wrong or there are too many appended messages
     if (!(numExpectedDelimeters <= metadata.delimiterIndices.size() && metadata.delimiterIndices.size() - numExpectedDelimeters < 3)) { return std::nullopt; }
 
     CompositeData compositeData{metadata.header};
+    compositeData.timestamp = metadata.timestamp;
     AsciiPacketExtractor extractor(buffer, metadata, syncByteIndex);
 
-    auto asciiParsingData = _getAsciiMeasurementIndices(measEnum).value();
-
-    for (const auto& measIndex : asciiParsingData)
+    for (const auto& measIndex : schema)
     {
         if (compositeData.copyFromBuffer(extractor, measIndex.measGroupIndex, measIndex.measTypeIndex)) { return std::nullopt; }
     }
@@ -348,216 +477,6 @@ std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t
     return std::make_optional(compositeData);
 }
 
-std::optional<Vector<AsciiMeasurementIndices, 9>> _getAsciiMeasurementIndices(AsciiMeasurementHeader asciiHeader)
-{
-    if (asciiHeader == AsciiMeasurementHeader::YPR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),  // Ypr
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::QTN)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 2),  // Quaternion
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::QMR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 2),   // Quaternion
-            AsciiMeasurementIndices(2, 8),   // Mag
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::MAG)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 8),  // Mag
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::ACC)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-
-            AsciiMeasurementIndices(2, 9),  // Accel
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::GYR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::MAR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 8),   // Mag
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::YMR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(2, 8),   // Mag
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::YBA)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(4, 6),   // LinBodyAcc
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::YIA)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(4, 7),   // LinAccelNed
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::IMU)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 1),  // UncompMag
-            AsciiMeasurementIndices(2, 2),  // UncompAccel
-            AsciiMeasurementIndices(2, 3),  // UncompGyro
-            AsciiMeasurementIndices(2, 4),  // Temperature
-            AsciiMeasurementIndices(2, 5),  // Pressure
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::GPS)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(3, 1),   // GpsTow
-            AsciiMeasurementIndices(3, 2),   // GpsWeek
-            AsciiMeasurementIndices(3, 4),   // GnssFix
-            AsciiMeasurementIndices(3, 3),   // NumSats
-            AsciiMeasurementIndices(3, 5),   // GnssPosLla
-            AsciiMeasurementIndices(3, 7),   // GnssVelNed
-            AsciiMeasurementIndices(3, 9),   // GnssPosUncertainty
-            AsciiMeasurementIndices(3, 10),  // GnssVelUncertainty
-            AsciiMeasurementIndices(3, 11),  // GnssTimeUncertainty
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::GPE)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(3, 1),   // GpsTow
-            AsciiMeasurementIndices(3, 2),   // GpsWeek
-            AsciiMeasurementIndices(3, 4),   // GnssFix
-            AsciiMeasurementIndices(3, 3),   // NumSats
-            AsciiMeasurementIndices(3, 6),   // GnssPosEcef
-            AsciiMeasurementIndices(3, 8),   // GnssVelEcef
-            AsciiMeasurementIndices(3, 9),   // GnssPosUncertaintyEcef
-            AsciiMeasurementIndices(3, 10),  // GnssVelUncertainty
-            AsciiMeasurementIndices(3, 11),  // GnssTimeUncertainty
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::INS)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(1, 2),   // GpsTow
-            AsciiMeasurementIndices(1, 3),   // GpsWeek
-            AsciiMeasurementIndices(5, 0),   // InsStatus
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(5, 1),   // PosLla
-            AsciiMeasurementIndices(5, 4),   // VelNed
-            AsciiMeasurementIndices(4, 13),  // AttU
-            AsciiMeasurementIndices(5, 9),   // PosU
-            AsciiMeasurementIndices(5, 10),  // VelU
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::INE)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(1, 2),   // GpsTow
-            AsciiMeasurementIndices(1, 3),   // GpsWeek
-            AsciiMeasurementIndices(5, 0),   // InsStatus
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(5, 2),   // PosEcef
-            AsciiMeasurementIndices(5, 5),   // VelEcef
-            AsciiMeasurementIndices(4, 13),  // AttU
-            AsciiMeasurementIndices(5, 9),   // PosU
-            AsciiMeasurementIndices(5, 10),  // VelU
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::ISL)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(5, 1),   // PosLla
-            AsciiMeasurementIndices(5, 4),   // VelNed
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::ISE)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(5, 2),   // PosEcef
-            AsciiMeasurementIndices(5, 5),   // VelEcef
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::DTV)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 6),  // DeltaTheta
-            AsciiMeasurementIndices(2, 7),  // DeltaVel
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::G2S)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(6, 1),   // GpsTow
-            AsciiMeasurementIndices(6, 2),   // GpsWeek
-            AsciiMeasurementIndices(6, 4),   // GnssFix
-            AsciiMeasurementIndices(6, 3),   // NumSats
-            AsciiMeasurementIndices(6, 5),   // GnssPosLla
-            AsciiMeasurementIndices(6, 7),   // GnssVelNed
-            AsciiMeasurementIndices(6, 9),   // GnssPosUncertainty
-            AsciiMeasurementIndices(6, 10),  // GnssVelUncertainty
-            AsciiMeasurementIndices(6, 11),  // GnssTimeUncertainty
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::G2E)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(6, 1),   // GpsTow
-            AsciiMeasurementIndices(6, 2),   // GpsWeek
-            AsciiMeasurementIndices(6, 4),   // GnssFix
-            AsciiMeasurementIndices(6, 3),   // NumSats
-            AsciiMeasurementIndices(6, 6),   // GnssPosEcef
-            AsciiMeasurementIndices(6, 8),   // GnssVelEcef
-            AsciiMeasurementIndices(6, 9),   // GnssPosUncertaintyEcef
-            AsciiMeasurementIndices(6, 10),  // GnssVelUncertainty
-            AsciiMeasurementIndices(6, 11),  // GnssTimeUncertainty
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::HVE)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 12),  // Heave
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::RTK)
-    {
-        // Deprecated or unused measurements
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{});
-    }
-    else { return std::nullopt; }
-};
-
 uint8_t _getNumAppendedFields(const uint8_t numFieldsPresent, const uint8_t numFieldsExpected) { return numFieldsPresent - numFieldsExpected; }
 
 }  // namespace AsciiPacketProtocol
@@ -0,0 +1,80 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "Implementation/BufferAutoTuner.hpp"
+
+#include <algorithm>
+
+namespace VN
+{
+
+void BufferAutoTuner::start(const uint32_t baudRate) noexcept
+{
+    _isTuning = true;
+    _hasBaseline = false;
+    _isInitialWindow = true;
+    _baudRate = baudRate;
+    _numBytesRead = 0;
+    _maxBytesPerRead = 0;
+}
+
+std::optional<BufferAutoTuner::Recommendation> BufferAutoTuner::observe(const size_t numBytesRead, const size_t numPacketsTotal) noexcept
+{
+    if (!_isTuning) { return std::nullopt; }
+    const time_point currentTime = now();
+    if (!_hasBaseline)
+    {  // Counting starts from the first read, so that time spent connecting is not mistaken for a quiet link.
+        _hasBaseline = true;
+        _startTime = currentTime;
+        _startPacketCount = numPacketsTotal;
+        return std::nullopt;
+    }
+    _numBytesRead += numBytesRead;
+    _maxBytesPerRead = std::max(_maxBytesPerRead, numBytesRead);
+
+    const auto elapsed = std::chrono::duration_cast<Microseconds>(currentTime - _startTime);
+    if (elapsed < Config::Sensor::bufferAutoTuneWindow) { return std::nullopt; }
+
+    const double elapsedSeconds = std::chrono::duration<double>(elapsed).count();
+    const double observedBytesPerSecond = _numBytesRead / elapsedSeconds;
+    const double bytesPerSecond = std::max(observedBytesPerSecond, _baudRate / 10.0);  // 10 bits per byte on the wire, with start and stop bits
+    const double packetsPerSecond = (numPacketsTotal - _startPacketCount) / elapsedSeconds;
+
+    // The main buffer must hold whatever accumulates while the listening thread is stalled, on top of the largest single read and a packet in progress.
+    const double stallBytes = bytesPerSecond * std::chrono::duration<double>(Config::Sensor::mainBufferStallTolerance).count();
+    size_t mainBufferCapacity = static_cast<size_t>(stallBytes) + 2 * _maxBytesPerRead;
+    mainBufferCapacity = std::max<size_t>(mainBufferCapacity, Config::Serial::numBytesToReadPerGetData);
+
+    const double stallPackets = packetsPerSecond * std::chrono::duration<double>(Config::Sensor::measurementQueueStallTolerance).count();
+    const uint16_t measurementQueueCapacity = static_cast<uint16_t>(std::min<double>(stallPackets + 1.0, Config::PacketDispatchers::compositeDataQueueCapacity));
+
+    const bool isInitial = _isInitialWindow;
+    _isInitialWindow = false;
+    _startTime = currentTime;  // The next window starts here
+    _startPacketCount = numPacketsTotal;
+    _numBytesRead = 0;
+    _maxBytesPerRead = 0;
+    return Recommendation{mainBufferCapacity, measurementQueueCapacity, isInitial};
+}
+
+}  // namespace VN
@@ -23,6 +23,7 @@
 
 #include "Implementation/CommandProcessor.hpp"
 #include <cstdint>
+#include <cstdio>
 #include <optional>
 #include "Debug.hpp"
 #include "Interface/Command.hpp"
@@ -51,10 +52,12 @@ CommandProcessor::RegisterCommandReturn CommandProcessor::registerCommand(Comman
     }
 
     pCommand->prepareToSend();
-    AsciiMessage messageToSend;
-    sprintf(messageToSend.begin(), "$VN%s", pCommand->getCommandString().c_str());
+    AsciiMessage messageToSend{"$VN"};
+    messageToSend.append(pCommand->getCommandString());
     uint16_t crcValue = CalculateCRC((uint8_t*)messageToSend.c_str() + 1, messageToSend.length() - 1);
-    sprintf(messageToSend.end(), "*%04X\r\n", crcValue);
+    char crcString[8];
+    std::snprintf(crcString, sizeof(crcString), "*%04X\r\n", crcValue);
+    messageToSend.append(crcString, sizeof(crcString));
     VN_DEBUG_1("TX: " + messageToSend);
 
     {
@@ -27,20 +27,136 @@ namespace VN
 {
 PacketDispatcher::FindPacketRetVal FaPacketDispatcher::findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
 {
+    _latestPacketIsFastPath = (_fastPath != nullptr) && _findFastPathPacket(byteBuffer, syncByteIndex);
+    if (_latestPacketIsFastPath) { return {FaPacketProtocol::Validity::Valid, _latestPacketMetadata.length}; }
+
     FaPacketProtocol::FindPacketReturn findPacketRetVal = FaPacketProtocol::findPacket(byteBuffer, syncByteIndex);
     if (findPacketRetVal.validity == FaPacketProtocol::Validity::Valid) { _latestPacketMetadata = findPacketRetVal.metadata; }
     return {findPacketRetVal.validity, findPacketRetVal.metadata.length};
 }
 
+bool FaPacketDispatcher::dispatchReassembledPacket(const ByteBuffer& byteBuffer) noexcept
+{
+    const FaPacketProtocol::FindPacketReturn findPacketRetVal = FaPacketProtocol::findPacket(byteBuffer, 0, false);
+    if (findPacketRetVal.validity != FaPacketProtocol::Validity::Valid || findPacketRetVal.metadata.length != byteBuffer.size()) { return true; }
+    _latestPacketMetadata = findPacketRetVal.metadata;
+    _latestPacketIsFastPath = false;
+    dispatchPacket(byteBuffer, 0);
+    return false;
+}
+
 void FaPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
-    bool packetConsumed = false;
+    if (_linkMonitor != nullptr) { _reportToLinkMonitor(byteBuffer, syncByteIndex); }
     _invokeSubscribers(byteBuffer, syncByteIndex, _latestPacketMetadata);
+    _publishLatestMeasurements(byteBuffer, syncByteIndex, _latestPacketMetadata);
+    if (_latestPacketIsFastPath)
+    {
+        _fastPath->dispatch(byteBuffer, syncByteIndex, _latestPacketMetadata.timestamp);  // A full queue drops the packet, as the measurement queue does
+        return;
+    }
     if constexpr (Config::PacketDispatchers::compositeDataQueueCapacity > 0)
     {
-        packetConsumed |= _tryPushToCompositeDataQueue(byteBuffer, syncByteIndex, _latestPacketMetadata);
+        if (_deferredPacketQueue != nullptr)
+        {
+            if (anyDataIsEnabled(_latestPacketMetadata.header.toMeasurementHeader(), _enabledMeasurements))
+            {
+                _tryPushToPacketQueue(byteBuffer, syncByteIndex, _latestPacketMetadata, _deferredPacketQueue);
+            }
+        }
+        else if (_compactMeasurementQueue != nullptr) { _tryPushToCompactMeasurementQueue(byteBuffer, syncByteIndex, _latestPacketMetadata); }
+        else { _tryPushToCompositeDataQueue(byteBuffer, syncByteIndex, _latestPacketMetadata); }
+    }
+}
+
+bool FaPacketDispatcher::parseDeferredPacket(const Packet& packet) noexcept
+{
+    if (packet.details.syncByte != PacketDetails::SyncByte::FA) { return true; }
+    const FaPacketProtocol::Metadata& metadata = packet.details.faMetadata;
+    if (_compactMeasurementQueue != nullptr) { return _tryPushToCompactMeasurementQueue(packet.buffer, metadata); }
+    const ByteBuffer byteBuffer(packet.buffer, metadata.length, metadata.length);
+    return !_tryPushToCompositeDataQueue(byteBuffer, 0, metadata);
+}
+
+bool FaPacketDispatcher::setCompactMeasurementQueue(DirectAccessQueue_Interface<CompactCompositeData>* const compactMeasurementQueue,
+                                                    CompactGnssSlab* const gnssSlab) noexcept
+{
+    if ((compactMeasurementQueue != nullptr) && !_compactLinearBuffer)
+    {
+        _compactLinearBuffer.reset(new (std::nothrow) uint8_t[Config::PacketFinders::faPacketMaxLength]);
+        if (!_compactLinearBuffer) { return true; }
+    }
+    _compactMeasurementQueue = compactMeasurementQueue;
+    _compactGnssSlab = gnssSlab;
+    return false;
+}
+
+bool FaPacketDispatcher::_findFastPathPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
+{
+    // Anything short of a complete, matching packet is left to the generic finder, which reports Incomplete or Invalid as appropriate.
+    const size_t length = _fastPath->length();
+    if ((byteBuffer.size() - syncByteIndex) < length) { return false; }
+    if (!_fastPath->matches(byteBuffer, syncByteIndex)) { return false; }
+    _latestPacketMetadata.header = _fastPath->header();
+    _latestPacketMetadata.length = length;
+    _latestPacketMetadata.timestamp = now();
+    return true;
+}
+
+void FaPacketDispatcher::_reportToLinkMonitor(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
+{
+    // TimeStartup is the first field of its group, and both the Common and Time groups precede all others, so if output it is always the first 8 bytes of
+    // the payload. This avoids parsing the packet.
+    const BinaryHeader& header = _latestPacketMetadata.header;
+    std::optional<uint64_t> timeStartup;
+    if (!header.outputGroups.empty() && !header.outputTypes.empty())
+    {
+        const uint8_t groups = header.outputGroups[0];
+        const bool firstGroupIsCommonOrTime = (groups & COMMON_BIT) || (groups & TIME_BIT);
+        if (firstGroupIsCommonOrTime && (header.outputTypes[0] & 0x01))  // TimeStartup is bit 0 in both groups
+        {
+            uint64_t value;
+            const size_t payloadIndex = syncByteIndex + 1 + header.size();
+            if (!byteBuffer.peek(reinterpret_cast<uint8_t*>(&value), sizeof(value), payloadIndex)) { timeStartup = value; }
+        }
+    }
+    // Otherwise fall back to SyncOutCnt. Its offset depends on which Common and Time fields precede it, so is only found again when the output changes.
+    std::optional<uint32_t> syncOutCnt;
+    if (!timeStartup.has_value() && !header.outputGroups.empty())
+    {
+        if (!(header == _syncOutCntHeader))
+        {
+            _syncOutCntHeader = header;
+            _syncOutCntOffset = _findSyncOutCntOffset(header);
+        }
+        if (_syncOutCntOffset.has_value())
+        {
+            uint32_t value;
+            const size_t payloadIndex = syncByteIndex + 1 + header.size() + *_syncOutCntOffset;
+            if (!byteBuffer.peek(reinterpret_cast<uint8_t*>(&value), sizeof(value), payloadIndex)) { syncOutCnt = value; }
+        }
     }
+    _linkMonitor->onFaPacket(header, timeStartup, syncOutCnt);
+}
+
+std::optional<uint16_t> FaPacketDispatcher::_findSyncOutCntOffset(const BinaryHeader& header) noexcept
+{
+    // SyncOutCnt is Time group field 8, and only the Common group precedes the Time group. Neither holds a dynamically sized field.
+    constexpr uint8_t timeGroup = 1;
+    constexpr uint8_t syncOutCntField = 8;
+    size_t offset = 0;
+    BinaryHeaderIterator iter(header);
+    while (iter.next())
+    {
+        if (iter.group() > timeGroup) { break; }
+        if (iter.group() == timeGroup && iter.field() == syncOutCntField) { return static_cast<uint16_t>(offset); }
+        if (iter.group() == timeGroup && iter.field() > syncOutCntField) { break; }
+        const auto size = getStaticBinaryTypeSize(iter.group(), iter.field());
+        if (!size.has_value()) { break; }
+        offset += *size;
+    }
+    return std::nullopt;
 }
 
 bool FaPacketDispatcher::addSubscriber(PacketQueue_Interface* subscriber, EnabledMeasurements headerToUse, SubscriberFilterType filterType) noexcept
@@ -91,6 +207,40 @@ bool FaPacketDispatcher::_tryPushToCompositeDataQueue(const ByteBuffer& byteBuff
     return true;
 }
 
+bool FaPacketDispatcher::_tryPushToCompactMeasurementQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex,
+                                                           const FaPacketProtocol::Metadata& packetDetails) noexcept
+{
+    if (byteBuffer.numLinearBytes(syncByteIndex) >= packetDetails.length)
+    {
+        return _tryPushToCompactMeasurementQueue(byteBuffer.peek_linear_unchecked(syncByteIndex), packetDetails);
+    }
+    if (packetDetails.length > Config::PacketFinders::faPacketMaxLength) { return true; }
+    byteBuffer.peek_unchecked(_compactLinearBuffer.get(), packetDetails.length, syncByteIndex);
+    return _tryPushToCompactMeasurementQueue(_compactLinearBuffer.get(), packetDetails);
+}
+
+bool FaPacketDispatcher::_tryPushToCompactMeasurementQueue(const uint8_t* packet, const FaPacketProtocol::Metadata& packetDetails) noexcept
+{
+    VN_PROFILER_TIME_CURRENT_SCOPE();
+    if (!anyDataIsEnabled(packetDetails.header.toMeasurementHeader(), _enabledMeasurements)) { return false; }
+    // Checked before putting, as a put slot can not be handed back
+    if (_compactOffsetTable.update(packet, packetDetails)) { return true; }
+
+    auto pCompactData = _compactMeasurementQueue->put();
+    if (!pCompactData) { return true; }
+    *pCompactData = CompactCompositeData(_compactGnssSlab);  // Returns any GNSS blocks held by the slot's previous measurement to the slab
+    pCompactData->populate(packet, packetDetails, _compactOffsetTable);
+    return false;
+}
+
+void FaPacketDispatcher::_publishLatestMeasurements(const ByteBuffer& byteBuffer, const size_t syncByteIndex,
+                                                    const FaPacketProtocol::Metadata& packetDetails) noexcept
+{
+    if (_latestMeasurements == nullptr) { return; }
+    if (!anyDataIsEnabled(packetDetails.header.toMeasurementHeader(), _enabledMeasurements)) { return; }
+    _latestMeasurements->publish(byteBuffer, syncByteIndex, packetDetails);
+}
+
 void FaPacketDispatcher::_invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails) noexcept
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
@@ -126,12 +276,20 @@ void FaPacketDispatcher::_invokeSubscribers(const ByteBuffer& byteBuffer, const
 bool FaPacketDispatcher::_tryPushToSubscriber(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
                                               Subscriber& subscriber) noexcept
 {
-    auto putSlot = subscriber.queueToPush->put();
+    return _tryPushToPacketQueue(byteBuffer, syncByteIndex, packetDetails, subscriber.queueToPush);
+}
+
+bool FaPacketDispatcher::_tryPushToPacketQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
+                                               PacketQueue_Interface* packetQueue) noexcept
+{
+    auto putSlot = packetQueue->put();
     if (putSlot)
     {
         putSlot->details.syncByte = PacketDetails::SyncByte::FA;
         putSlot->details.faMetadata = packetDetails;
         byteBuffer.peek_unchecked(putSlot->buffer, packetDetails.length, syncByteIndex);
+        putSlot = nullptr;  // Releases the packet into the queue before waking its consumer
+        packetQueue->notifyConsumer();
     }
     else
     {
@@ -199,7 +199,7 @@ PacketDispatcher::FindPacketRetVal::Validity _populateHeader(const ByteBuffer& b
 
 }  // namespace
 
-FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
+FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const bool validateCrc) noexcept
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
     Metadata metadata;
@@ -263,7 +263,7 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
     metadata.header = header;
     metadata.length = requiredPacketLength;
 
-    const bool isValidCrc = _isValidBinaryCrc(byteBuffer, syncByteIndex, requiredPacketLength);
+    const bool isValidCrc = !validateCrc || _isValidBinaryCrc(byteBuffer, syncByteIndex, requiredPacketLength);
     return isValidCrc ? FindPacketReturn{Validity::Valid, metadata} : FindPacketReturn{Validity::Invalid, metadata};
 }
 
@@ -272,6 +272,7 @@ std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
     CompositeData compositeData(metadata.header);
+    compositeData.timestamp = metadata.timestamp;
 
     FaPacketExtractor extractor(buffer, metadata, syncByteIndex);
     extractor.discard(metadata.header.size() + 1);
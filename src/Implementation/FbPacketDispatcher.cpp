@@ -61,10 +61,8 @@ void FbPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const size
     if (packetIsFinalOfMessage)
     {
         _addFaPacketCrc();
-
-        const auto retVal = _faPacketDispatcher->findPacket(_fbByteBuffer, 0);
-
-        if (retVal.validity == PacketDispatcher::FindPacketRetVal::Validity::Valid) { _faPacketDispatcher->dispatchPacket(_fbByteBuffer, 0); }
+        // Every fragment passed its own CRC and the FA CRC was accumulated while copying, so only the FA header needs to be read.
+        _faPacketDispatcher->dispatchReassembledPacket(_fbByteBuffer);
         _fbByteBuffer.reset();
     }
     _previousPacketMetadata = _latestPacketMetadata;
@@ -73,11 +71,21 @@ void FbPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const size
 bool FbPacketDispatcher::_moveBytesFromMainBufferToFbBuffer(SplitPacketDetails splitPacketDetails, const ByteBuffer& byteBuffer, const size_t numOfBytesToMove,
                                                             const size_t startingIndex) noexcept
 {
-    if (splitPacketDetails.payloadLength > byteBuffer.size()) { return true; }
-    for (size_t i = 0; i < numOfBytesToMove; i++)
+    if (splitPacketDetails.payloadLength > byteBuffer.size() || (startingIndex + numOfBytesToMove) > byteBuffer.size()) { return true; }
+    // Copy a linear span at a time (at most two, if the payload wraps around the main buffer), accumulating the FA CRC as we go.
+    size_t numBytesMoved = 0;
+    while (numBytesMoved < numOfBytesToMove)
     {
-        auto tmpByte = byteBuffer.peek_unchecked(startingIndex + i);
-        _fbByteBuffer.put(&tmpByte, 1);
+        const size_t spanStartIndex = startingIndex + numBytesMoved;
+        const size_t spanLength = std::min(byteBuffer.numLinearBytes(spanStartIndex), numOfBytesToMove - numBytesMoved);
+        const uint8_t* span = byteBuffer.peek_linear_unchecked(spanStartIndex);
+        if (_fbByteBuffer.put(span, spanLength))
+        {
+            _fbByteBuffer.reset();
+            return true;
+        }
+        for (size_t i = 0; i < spanLength; ++i) { _calculateCRC(&_runningCrc, span[i]); }
+        numBytesMoved += spanLength;
     }
     return false;
 }
@@ -87,14 +95,12 @@ void FbPacketDispatcher::_resetFbBuffer() noexcept
     _fbByteBuffer.reset();
     const uint8_t faSyncByte = 0xFA;
     _fbByteBuffer.put(&faSyncByte, 1);
+    _runningCrc = 0;
 }
 
 void FbPacketDispatcher::_addFaPacketCrc() noexcept
 {
-    uint16_t crc = 0;
-
-    // Calculate a CRC over everything but the sync byte
-    for (size_t i = 1; i < _fbByteBuffer.size(); ++i) { _calculateCRC(&crc, _fbByteBuffer.peek(i).value()); }
+    const uint16_t crc = _runningCrc;
 
     // Crc is put in big endian
     uint8_t data = 0;
@@ -48,12 +48,13 @@ FbPacketProtocol::FindPacketReturn findPacket(const ByteBuffer& byteBuffer, cons
     const uint8_t syncByte = byteBuffer.peek_unchecked(syncByteIndex);
     if (syncByte != 0xFB) { return FindPacketReturn{Validity::Invalid, Metadata{}}; }  // It was a mistake to come here.
 
-    // Verify this is a message type that we support; the only supported message type is 0
+    // Verify this is a message type that we support; the only supported message type is 0. Until it has arrived, the byte past the sync byte is
+    // whatever was last in the buffer.
+    const size_t numPacketBytesInBuffer = byteBuffer.size() - syncByteIndex;
+    if (numPacketBytesInBuffer < 2) { return FindPacketReturn{Validity::Incomplete, Metadata{}}; }
     metadata.header.messageType = byteBuffer.peek_unchecked(++currentFromHeadIndex);
     if (metadata.header.messageType != 0) { return FindPacketReturn{Validity::Invalid, Metadata{}}; }
 
-    const size_t numPacketBytesInBuffer = byteBuffer.size() - syncByteIndex;
-
     const size_t minPossiblePacketLength = 1 + headerSize + 1 + 2;  // Sync byte + FB header (5) + 1 Payload + CRC
     if (numPacketBytesInBuffer < minPossiblePacketLength) { return FindPacketReturn{Validity::Incomplete, Metadata{}}; }
 
@@ -0,0 +1,166 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "Implementation/LinkMonitor.hpp"
+
+#include <algorithm>
+
+namespace VN
+{
+
+void LinkMonitor::onFaPacket(const BinaryHeader& header, const std::optional<uint64_t> timeStartup, const std::optional<uint32_t> syncOutCnt) noexcept
+{
+    auto counter = std::find_if(_messageTypes.begin(), _messageTypes.end(),
+                                [&header](const MessageTypeCounter& c) { return c.stats.syncByte == 0xFA && c.stats.binaryHeader == header; });
+    if (counter == _messageTypes.end())
+    {
+        MessageTypeCounter newCounter;
+        newCounter.stats.syncByte = 0xFA;
+        newCounter.stats.binaryHeader = header;
+        if (_messageTypes.push_back(newCounter)) { return; }  // Outputs beyond the capacity are neither broken out nor checked for gaps
+        counter = _messageTypes.end() - 1;
+        ++counter->stats.packets;
+        if (timeStartup.has_value()) { counter->lastCount = *timeStartup; }
+        else if (syncOutCnt.has_value()) { counter->lastCount = *syncOutCnt; }
+        return;
+    }
+    ++counter->stats.packets;
+    if (timeStartup.has_value()) { _trackGap(*counter, *timeStartup); }
+    else if (syncOutCnt.has_value() && (*syncOutCnt != counter->lastCount))
+    {  // An unchanged SyncOutCnt means SyncOut fires less often than the output, which says nothing about gaps
+        _trackGap(*counter, *syncOutCnt);
+    }
+}
+
+void LinkMonitor::onAsciiPacket(const AsciiHeader& header) noexcept
+{
+    auto counter = std::find_if(_messageTypes.begin(), _messageTypes.end(),
+                                [&header](const MessageTypeCounter& c) { return c.stats.syncByte == '$' && c.stats.asciiHeader == header; });
+    if (counter == _messageTypes.end())
+    {
+        MessageTypeCounter newCounter;
+        newCounter.stats.syncByte = '$';
+        newCounter.stats.asciiHeader = header;
+        if (_messageTypes.push_back(newCounter)) { return; }
+        counter = _messageTypes.end() - 1;
+    }
+    ++counter->stats.packets;
+}
+
+void LinkMonitor::_trackGap(MessageTypeCounter& counter, const uint64_t count) noexcept
+{
+    if (count <= counter.lastCount)
+    {  // The unit has restarted, or SyncOutCnt has wrapped
+        counter.lastCount = count;
+        counter.period = 0;
+        return;
+    }
+    const uint64_t interval = count - counter.lastCount;
+    counter.lastCount = count;
+    if ((counter.period == 0) || (interval < counter.period / 2))
+    {  // Either the first interval, or the first was itself across a gap
+        counter.period = interval;
+        return;
+    }
+    if (interval > counter.period + counter.period / 2)
+    {
+        const uint64_t missed = (interval + counter.period / 2) / counter.period - 1;
+        counter.stats.missedPackets += missed;
+        _missedFaPackets += missed;
+        return;
+    }
+    counter.period = (counter.period * 7 + interval) / 8;
+}
+
+void LinkMonitor::update(const PacketSynchronizer& packetSynchronizer, const size_t mainBufferSize, const uint16_t measurementQueueHighWatermark) noexcept
+{
+    _mainBufferHighWatermark = std::max(_mainBufferHighWatermark, mainBufferSize);
+
+    const time_point currentTime = now();
+    constexpr auto bucketLength = Config::Sensor::linkStatsWindow / _numBuckets;
+    if ((_numSamples != 0) && ((currentTime - _samples[_newestSample].time) < bucketLength)) { return; }
+
+    const uint8_t nextSample = (_numSamples == 0) ? 0 : static_cast<uint8_t>((_newestSample + 1) % _samples.size());
+    Sample& sample = _samples[nextSample];
+    sample.time = currentTime;
+    sample.receivedBytes = packetSynchronizer.getReceivedByteCount();
+    sample.skippedBytes = packetSynchronizer.getSkippedByteCount();
+    sample.faPackets = packetSynchronizer.getValidPacketCount(PacketSynchronizer::SyncBytes{0xFA});
+    sample.invalidFaPackets = packetSynchronizer.getInvalidPacketCount(PacketSynchronizer::SyncBytes{0xFA});
+    sample.asciiPackets = packetSynchronizer.getValidPacketCount(PacketSynchronizer::SyncBytes{'$'});
+    sample.invalidAsciiPackets = packetSynchronizer.getInvalidPacketCount(PacketSynchronizer::SyncBytes{'$'});
+    sample.fbPackets = packetSynchronizer.getValidPacketCount(PacketSynchronizer::SyncBytes{0xFB});
+    sample.messageTypePackets.fill(0);
+    for (size_t i = 0; i < _messageTypes.size(); ++i) { sample.messageTypePackets[i] = _messageTypes[i].stats.packets; }
+    _newestSample = nextSample;
+    _numSamples = std::min<uint8_t>(_numSamples + 1, static_cast<uint8_t>(_samples.size()));
+
+    const Sample& oldest = _samples[(_numSamples < _samples.size()) ? 0 : (_newestSample + 1) % _samples.size()];
+    LinkStats stats;
+    stats.windowSeconds = std::chrono::duration<double>(sample.time - oldest.time).count();
+    if (stats.windowSeconds > 0)
+    {
+        const auto rate = [&stats](const uint64_t newer, const uint64_t older) { return (newer - older) / stats.windowSeconds; };
+        stats.receivedBytesPerSecond = rate(sample.receivedBytes, oldest.receivedBytes);
+        stats.skippedBytesPerSecond = rate(sample.skippedBytes, oldest.skippedBytes);
+        stats.faPacketsPerSecond = rate(sample.faPackets, oldest.faPackets);
+        stats.invalidFaPacketsPerSecond = rate(sample.invalidFaPackets, oldest.invalidFaPackets);
+        stats.asciiPacketsPerSecond = rate(sample.asciiPackets, oldest.asciiPackets);
+        stats.invalidAsciiPacketsPerSecond = rate(sample.invalidAsciiPackets, oldest.invalidAsciiPackets);
+        stats.fbPacketsPerSecond = rate(sample.fbPackets, oldest.fbPackets);
+        const double faFound = stats.faPacketsPerSecond + stats.invalidFaPacketsPerSecond;
+        stats.faCrcFailureRatio = (faFound > 0) ? stats.invalidFaPacketsPerSecond / faFound : 0;
+    }
+    stats.receivedBytes = sample.receivedBytes;
+    stats.skippedBytes = sample.skippedBytes;
+    stats.faPackets = sample.faPackets;
+    stats.invalidFaPackets = sample.invalidFaPackets;
+    stats.asciiPackets = sample.asciiPackets;
+    stats.invalidAsciiPackets = sample.invalidAsciiPackets;
+    stats.fbPackets = sample.fbPackets;
+    stats.missedFaPackets = _missedFaPackets;
+    stats.mainBufferHighWatermark = _mainBufferHighWatermark;
+    stats.measurementQueueHighWatermark = measurementQueueHighWatermark;
+    for (size_t i = 0; i < _messageTypes.size(); ++i)
+    {
+        MessageTypeStats messageType = _messageTypes[i].stats;
+        const uint64_t packets = sample.messageTypePackets[i];
+        messageType.packets = packets;
+        if (stats.windowSeconds > 0) { messageType.packetsPerSecond = (packets - oldest.messageTypePackets[i]) / stats.windowSeconds; }
+        stats.messageTypes.push_back(messageType);
+    }
+    _stats.store(stats);
+}
+
+void LinkMonitor::reset() noexcept
+{
+    _samples = {};
+    _numSamples = 0;
+    _newestSample = 0;
+    _messageTypes.clear();
+    _missedFaPackets = 0;
+    _mainBufferHighWatermark = 0;
+    _stats.store(LinkStats{});
+}
+
+}  // namespace VN
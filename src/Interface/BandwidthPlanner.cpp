@@ -0,0 +1,136 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "Interface/BandwidthPlanner.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Implementation/BinaryMeasurementDefinitions.hpp"
+#include "Debug.hpp"
+
+namespace VN
+{
+namespace BandwidthPlanner
+{
+
+namespace
+{
+constexpr std::array<BaudRate, 9> baudRates{BaudRate::Baud9600,   BaudRate::Baud19200,  BaudRate::Baud38400,  BaudRate::Baud57600,  BaudRate::Baud115200,
+                                            BaudRate::Baud128000, BaudRate::Baud230400, BaudRate::Baud460800, BaudRate::Baud921600};
+
+constexpr double bitsPerByte = 10.0;  // Start bit, 8 data bits, stop bit
+
+size_t _worstCaseFieldSize(const uint8_t group, const uint8_t field) noexcept
+{
+    const bool isGnssGroup = (group == 3) || (group == 6) || (group == 12);
+    if (isGnssGroup && (field == 14)) { return 2 + 8 * Config::PacketFinders::gnssSatInfoMaxCount; }
+    if (isGnssGroup && (field == 16)) { return 12 + 28 * Config::PacketFinders::gnssRawMeasMaxCount; }
+    return getStaticBinaryTypeSize(group, field).value_or(0);
+}
+
+bool _isSentToPort(const Registers::System::BinaryOutput& output, const SerialPort serialPort) noexcept
+{
+    switch (serialPort)
+    {
+        case SerialPort::Serial1:
+            return output.asyncMode.serial1;
+        case SerialPort::Serial2:
+            return output.asyncMode.serial2;
+        default:
+            return output.asyncMode.serial1 || output.asyncMode.serial2;
+    }
+}
+}  // namespace
+
+uint16_t worstCasePacketLength(const Registers::System::BinaryOutputMeasurements& measurements) noexcept
+{
+    const std::array<std::pair<uint8_t, uint32_t>, 8> groups{{{0, uint32_t(measurements.common)},
+                                                              {1, uint32_t(measurements.time)},
+                                                              {2, uint32_t(measurements.imu)},
+                                                              {3, uint32_t(measurements.gnss)},
+                                                              {4, uint32_t(measurements.attitude)},
+                                                              {5, uint32_t(measurements.ins)},
+                                                              {6, uint32_t(measurements.gnss2)},
+                                                              {12, uint32_t(measurements.gnss3)}}};
+    size_t payloadLength = 0;
+    for (const auto& [group, types] : groups)
+    {
+        for (uint8_t field = 0; field < 32; ++field)
+        {
+            if ((field % 16) == 15) { continue; }  // Extension bit
+            if (types & (uint32_t(1) << field)) { payloadLength += _worstCaseFieldSize(group, field); }
+        }
+    }
+    if (payloadLength == 0) { return 0; }
+    const size_t headerLength = measurements.toBinaryHeader().size();
+    return static_cast<uint16_t>(1 + headerLength + payloadLength + 2);
+}
+
+Plan plan(const Registers::System::BinaryOutput* const* outputs, const uint8_t numOutputs, const BaudRate baudRate, const SerialPort serialPort,
+          const uint16_t imuRateHz, const double maxUtilization) noexcept
+{
+    Plan retVal;
+    retVal.numOutputs = std::min(numOutputs, maxNumOutputs);
+    for (uint8_t i = 0; i < retVal.numOutputs; ++i)
+    {
+        const auto* output = outputs[i];
+        if ((output == nullptr) || (output->rateDivisor == 0) || !_isSentToPort(*output, serialPort)) { continue; }
+        OutputLoad& load = retVal.outputs[i];
+        load.packetLength = worstCasePacketLength(*output);
+        load.packetsPerSecond = (load.packetLength == 0) ? 0 : static_cast<double>(imuRateHz) / output->rateDivisor;
+        load.bytesPerSecond = load.packetLength * load.packetsPerSecond;
+        retVal.bytesPerSecond += load.bytesPerSecond;
+    }
+
+    retVal.linkBytesPerSecond = static_cast<uint32_t>(baudRate) / bitsPerByte;
+    const double maxBytesPerSecond = retVal.linkBytesPerSecond * maxUtilization;
+    retVal.utilization = retVal.bytesPerSecond / retVal.linkBytesPerSecond;
+    retVal.fits = retVal.bytesPerSecond <= maxBytesPerSecond;
+
+    for (const auto rate : baudRates)
+    {
+        if (retVal.bytesPerSecond <= static_cast<uint32_t>(rate) / bitsPerByte * maxUtilization)
+        {
+            retVal.suggestedBaudRate = rate;
+            break;
+        }
+    }
+
+    for (uint8_t i = 0; i < retVal.numOutputs; ++i)
+    {
+        OutputLoad& load = retVal.outputs[i];
+        if (load.packetLength == 0) { continue; }
+        const double budget = maxBytesPerSecond - (retVal.bytesPerSecond - load.bytesPerSecond);
+        if (budget <= 0) { continue; }  // The other outputs alone overload the link
+        // imuRateHz / divisor * packetLength <= budget
+        const double minDivisor = std::ceil(static_cast<double>(imuRateHz) * load.packetLength / budget);
+        if (minDivisor <= std::numeric_limits<uint16_t>::max()) { load.suggestedRateDivisor = static_cast<uint16_t>(std::max(minDivisor, 1.0)); }
+    }
+    VN_DEBUG_1("Binary outputs use " + std::to_string(retVal.utilization * 100.0) + "% of the link.");
+    return retVal;
+}
+
+}  // namespace BandwidthPlanner
+}  // namespace VN
@@ -94,8 +94,8 @@ bool Command::matchResponse(const AsciiMessage& responseToCheck, const time_poin
     LockGuard lock(_mutex);
     _awaitingResponse = false;
     _responseMatched = false;
-    AsciiMessage stringToMatch{};
-    std::snprintf(stringToMatch.begin(), 3 + 1 + _numCharToMatch, "$VN%s", _commandString.c_str());
+    AsciiMessage stringToMatch{"$VN"};
+    stringToMatch.append(_commandString.c_str(), _numCharToMatch);
     if (StringUtils::startsWith(responseToCheck, stringToMatch)) { _responseMatched = true; }
     else
     {
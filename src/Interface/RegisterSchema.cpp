@@ -0,0 +1,202 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "Interface/RegisterSchema.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+#include "TemplateLibrary/String.hpp"
+
+namespace VN
+{
+namespace Registers
+{
+
+Vector<const char*, Config::PacketFinders::asciiMaxFieldCount> findIndexOfFieldSeparators(const AsciiMessage& input)
+{
+    Vector<const char*, Config::PacketFinders::asciiMaxFieldCount> indexes;
+    const size_t inputLength = input.length();
+    size_t offset = 7;
+    if (input[0] != '$')
+    {
+        indexes.push_back(input.begin() - 1);
+        offset = 0;
+    }
+
+    for (size_t i = input.find(',', offset); i < inputLength; i++)
+    {
+        if (input[i] == ',' || input[i] == '*') { indexes.push_back(&input[i]); }
+    }
+
+    if (input[0] != '$') { indexes.push_back(input.end()); }
+
+    return indexes;
+}
+
+namespace Schema
+{
+
+template <class T>
+bool _parseDecimal(const char* start, const char* end, const FieldRef& field) noexcept
+{
+    std::optional<T> parsed = StringUtils::fromString<T>(start, end);
+    if (!parsed.has_value()) { return true; }
+    if constexpr (std::is_floating_point_v<T>) { parsed = static_cast<T>(parsed.value() * field.scale); }
+    else
+    {
+        const int64_t asInteger = static_cast<int64_t>(parsed.value());
+        if ((asInteger < field.range.min) || (asInteger > field.range.max)) { return true; }
+    }
+    std::memcpy(field.value, &parsed.value(), sizeof(T));
+    return false;
+}
+
+template <class T>
+bool _parseHex(const char* start, const char* end, void* value) noexcept
+{
+    const std::optional<T> parsed = StringUtils::fromStringHex<T>(start, end);
+    if (!parsed.has_value()) { return true; }
+    std::memcpy(value, &parsed.value(), sizeof(T));
+    return false;
+}
+
+template <class T>
+T _load(const void* value) noexcept
+{
+    T retVal;
+    std::memcpy(&retVal, value, sizeof(T));
+    return retVal;
+}
+
+template <class T>
+T _loadUnscaled(const ConstFieldRef& field) noexcept
+{
+    return static_cast<T>(_load<T>(field.value) / field.scale);
+}
+
+bool parseFields(const AsciiMessage& response, const FieldRef* fields, const size_t numFields, const size_t numRequiredFields) noexcept
+{
+    const auto tokens = findIndexOfFieldSeparators(response);
+    if (tokens.size() < numRequiredFields + 1 || tokens.size() > numFields + 1) { return true; }
+
+    const size_t numFieldsPresent = tokens.size() - 1;
+    for (size_t i = 0; i < numFieldsPresent; ++i)
+    {
+        const char* start = tokens[i] + 1;
+        const char* end = tokens[i + 1];
+        bool failed = false;
+        switch (fields[i].kind)
+        {
+            case FieldKind::Float:
+                failed = _parseDecimal<float>(start, end, fields[i]);
+                break;
+            case FieldKind::Double:
+                failed = _parseDecimal<double>(start, end, fields[i]);
+                break;
+            case FieldKind::Uint8:
+                failed = _parseDecimal<uint8_t>(start, end, fields[i]);
+                break;
+            case FieldKind::Uint16:
+                failed = _parseDecimal<uint16_t>(start, end, fields[i]);
+                break;
+            case FieldKind::Uint32:
+                failed = _parseDecimal<uint32_t>(start, end, fields[i]);
+                break;
+            case FieldKind::Int32:
+                failed = _parseDecimal<int32_t>(start, end, fields[i]);
+                break;
+            case FieldKind::Hex8:
+                failed = _parseHex<uint8_t>(start, end, fields[i].value);
+                break;
+            case FieldKind::Hex16:
+                failed = _parseHex<uint16_t>(start, end, fields[i].value);
+                break;
+            case FieldKind::Hex32:
+                failed = _parseHex<uint32_t>(start, end, fields[i].value);
+                break;
+            case FieldKind::Text:
+                *static_cast<AsciiMessage*>(fields[i].value) = AsciiMessage(start, end);
+                break;
+        }
+        if (failed) { return true; }
+    }
+    return false;
+}
+
+AsciiMessage formatFields(const ConstFieldRef* fields, const size_t numFields) noexcept
+{
+    AsciiMessage result;
+    char* buffer = result.data();
+    size_t length = 0;
+    for (size_t i = 0; i < numFields && length + 1 < result.capacity(); ++i)
+    {
+        char* head = buffer + length;
+        const size_t available = result.capacity() - length;
+        const char* separator = (i == 0) ? "" : ",";
+        int numWritten = 0;
+        switch (fields[i].kind)
+        {
+            case FieldKind::Float:
+                numWritten = std::snprintf(head, available, "%s%f", separator, _loadUnscaled<float>(fields[i]));
+                break;
+            case FieldKind::Double:
+                numWritten = std::snprintf(head, available, "%s%f", separator, _loadUnscaled<double>(fields[i]));
+                break;
+            case FieldKind::Uint8:
+                numWritten = std::snprintf(head, available, "%s%u", separator, _load<uint8_t>(fields[i].value));
+                break;
+            case FieldKind::Uint16:
+                numWritten = std::snprintf(head, available, "%s%u", separator, _load<uint16_t>(fields[i].value));
+                break;
+            case FieldKind::Uint32:
+                numWritten = std::snprintf(head, available, "%s%u", separator, static_cast<unsigned int>(_load<uint32_t>(fields[i].value)));
+                break;
+            case FieldKind::Int32:
+                numWritten = std::snprintf(head, available, "%s%d", separator, static_cast<int>(_load<int32_t>(fields[i].value)));
+                break;
+            case FieldKind::Hex8:
+                numWritten = std::snprintf(head, available, "%s%X", separator, _load<uint8_t>(fields[i].value));
+                break;
+            case FieldKind::Hex16:
+                numWritten = std::snprintf(head, available, "%s%X", separator, _load<uint16_t>(fields[i].value));
+                break;
+            case FieldKind::Hex32:
+                numWritten = std::snprintf(head, available, "%s%X", separator, static_cast<unsigned int>(_load<uint32_t>(fields[i].value)));
+                break;
+            case FieldKind::Text:
+                numWritten = std::snprintf(head, available, "%s%s", separator, static_cast<const AsciiMessage*>(fields[i].value)->c_str());
+                break;
+        }
+        if (numWritten < 0) { break; }
+        length = std::min(length + static_cast<size_t>(numWritten), result.capacity() - 1);
+    }
+    result.setLength(length);
+    return result;
+}
+
+}  // namespace Schema
+}  // namespace Registers
+}  // namespace VN
@@ -21,6 +21,8 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <algorithm>
+
 #include "Debug.hpp"
 #include "Interface/Sensor.hpp"
 #include "Interface/Command.hpp"
@@ -34,12 +36,34 @@ namespace VN
 // Constructor and Desctructor
 // ------------------------------------------
 
-Sensor::Sensor()
+Sensor::Sensor() { _addDispatchers(); }
+
+Sensor::Sensor(const BufferConfig& bufferConfig)
+    : _mainByteBuffer(std::max<size_t>(bufferConfig.mainBufferCapacity, Config::Serial::numBytesToReadPerGetData)), _autoTuneBuffers(bufferConfig.autoTune)
+{
+    _measurementQueue.setCapacityLimit(bufferConfig.measurementQueueCapacity);
+    _addDispatchers();
+}
+
+void Sensor::_addDispatchers() noexcept
 {
     // Set up packet synchronizer
     _packetSynchronizer.addDispatcher(&_faPacketDispatcher);
     _packetSynchronizer.addDispatcher(&_asciiPacketDispatcher);
     _packetSynchronizer.addDispatcher(&_fbPacketDispatcher);
+#if (LATEST_MEASUREMENT_ENABLE)
+    _faPacketDispatcher.setLatestMeasurements(&_latestMeasurements);
+    _asciiPacketDispatcher.setLatestMeasurements(&_latestMeasurements);
+#endif
+    _faPacketDispatcher.setLinkMonitor(&_linkMonitor);
+    _asciiPacketDispatcher.setLinkMonitor(&_linkMonitor);
+#if (COMPACT_MEASUREMENT_QUEUE_ENABLE)
+    if (_faPacketDispatcher.setCompactMeasurementQueue(&_compactMeasurementQueue, &_compactGnssSlab))
+    {
+        VN_DEBUG_1("Could not allocate the compact measurement queue's linearization buffer.");
+        VN_ABORT();
+    }
+#endif
 }
 
 Sensor::~Sensor()
@@ -58,8 +82,10 @@ Sensor::~Sensor()
 
 Error Sensor::connect(const Serial_Base::PortName& portName, const BaudRate baudRate) noexcept
 {
-    Error lastError = _serial.open(portName, static_cast<uint32_t>(baudRate));
+    Error lastError = _serial->open(portName, static_cast<uint32_t>(baudRate));
     if (lastError != Error::None) { return lastError; }
+    if (_autoTuneBuffers) { _bufferAutoTuner.start(static_cast<uint32_t>(baudRate)); }
+    _linkMonitor.reset();
 #if (THREADING_ENABLE)
     _startListening();
 #endif
@@ -101,7 +127,7 @@ bool Sensor::verifySensorConnectivity() noexcept
 Error Sensor::changeBaudRate(const BaudRate newBaudRate) noexcept
 {
     if constexpr (Config::CommandProcessor::commandProcQueueCapacity == 0) { return Error::CommandQueueFull; }
-    if (!_serial.isSupportedBaudRate(static_cast<uint32_t>(newBaudRate))) { return Error::UnsupportedBaudRate; }
+    if (!_serial->isSupportedBaudRate(static_cast<uint32_t>(newBaudRate))) { return Error::UnsupportedBaudRate; }
 
     Registers::System::BaudRate reg5;
     reg5.baudRate = newBaudRate;
@@ -121,8 +147,9 @@ Error Sensor::changeHostBaudRate(const BaudRate newBaudRate) noexcept
 #if (THREADING_ENABLE)
     _stopListening();
 #endif
-    Error lastError = _serial.changeBaudRate(static_cast<uint32_t>(newBaudRate));
+    Error lastError = _serial->changeBaudRate(static_cast<uint32_t>(newBaudRate));
     if (lastError != Error::None) { return lastError; }
+    if (_autoTuneBuffers) { _bufferAutoTuner.start(static_cast<uint32_t>(newBaudRate)); }
 #if (THREADING_ENABLE)
     _startListening();
 #endif
@@ -134,7 +161,7 @@ void Sensor::disconnect() noexcept
 #if (THREADING_ENABLE)
     _stopListening();
 #endif
-    _serial.close();
+    _serial->close();
 }
 
 // ----------------------
@@ -146,10 +173,13 @@ Sensor::CompositeDataQueueReturn Sensor::getNextMeasurement(const bool block) no
     if constexpr (Config::PacketDispatchers::compositeDataQueueCapacity == 0) { return nullptr; }
     Timer timer(Config::Sensor::getMeasurementTimeoutLength);
     timer.start();
+#if (DEFERRED_PARSING_ENABLE)
+    if (_measurementQueue.isEmpty()) { _parseDeferredPacket(false); }
+#endif
     CompositeDataQueueReturn queueReturn = _measurementQueue.get();
     if (!queueReturn)
     {
-        if (block) { queueReturn = _blockOnMeasurement(timer, Config::Sensor::getMeasurementSleepDuration); }
+        if (block) { queueReturn = _blockOnMeasurement(_measurementQueue, timer, Config::Sensor::getMeasurementSleepDuration); }
     }
     return queueReturn;
 }
@@ -158,38 +188,131 @@ Sensor::CompositeDataQueueReturn Sensor::getMostRecentMeasurement(const bool blo
 {
     Timer timer(Config::Sensor::getMeasurementTimeoutLength);
     timer.start();
+#if (DEFERRED_PARSING_ENABLE)
+    _parseDeferredPacket(true);
+#endif
     CompositeDataQueueReturn queueReturn = _measurementQueue.getBack();
     if (!queueReturn)
     {
-        if (block) { queueReturn = _blockOnMeasurement(timer, Config::Sensor::getMeasurementSleepDuration); }
+        if (block) { queueReturn = _blockOnMeasurement(_measurementQueue, timer, Config::Sensor::getMeasurementSleepDuration); }
+    }
+    return queueReturn;
+}
+
+#if (COMPACT_MEASUREMENT_QUEUE_ENABLE)
+Sensor::CompactMeasurementQueueReturn Sensor::getNextCompactMeasurement(const bool block) noexcept
+{
+    if constexpr (Config::PacketDispatchers::compositeDataQueueCapacity == 0) { return nullptr; }
+    Timer timer(Config::Sensor::getMeasurementTimeoutLength);
+    timer.start();
+#if (DEFERRED_PARSING_ENABLE)
+    if (_compactMeasurementQueue.isEmpty()) { _parseDeferredPacket(false); }
+#endif
+    CompactMeasurementQueueReturn queueReturn = _compactMeasurementQueue.get();
+    if (!queueReturn)
+    {
+        if (block) { queueReturn = _blockOnMeasurement(_compactMeasurementQueue, timer, Config::Sensor::getMeasurementSleepDuration); }
     }
     return queueReturn;
 }
+#endif
 
-Sensor::CompositeDataQueueReturn Sensor::_blockOnMeasurement(Timer& timer, [[maybe_unused]] const Microseconds sleepLength) noexcept
+size_t Sensor::getMeasurements(CompositeDataQueueReturn* measurements, const size_t count) noexcept
+{
+#if (DEFERRED_PARSING_ENABLE)
+    parseDeferredMeasurements();
+#endif
+    const size_t maxCount = std::min(count, static_cast<size_t>(_measurementQueue.capacity()));
+    return _measurementQueue.getMany(measurements, static_cast<uint16_t>(maxCount));
+}
+
+template <class MeasurementQueueType>
+typename MeasurementQueueType::OwningPtr Sensor::_blockOnMeasurement(MeasurementQueueType& queue, Timer& timer, const Microseconds sleepLength) noexcept
 {
     bool hasTimedOut = false;
     bool retValHasValue = false;
-    CompositeDataQueueReturn queueReturn;
+    typename MeasurementQueueType::OwningPtr queueReturn;
     while (!retValHasValue && !hasTimedOut)
     {
-#if (THREADING_ENABLE)
-        thisThread::sleepFor(sleepLength);
-#else
-        bool needsMoreData = processNextPacket();
-        if (needsMoreData)
-        {
-            Error lastError = loadMainBufferFromSerial();
-            if (lastError != Error::None) { _asyncErrorQueue.put(AsyncError(lastError)); }
-        }
+        _awaitMeasurement(sleepLength);
+#if (DEFERRED_PARSING_ENABLE)
+        _parseDeferredPacket(false);
 #endif
-        queueReturn = _measurementQueue.get();
+        queueReturn = queue.get();
         retValHasValue = queueReturn != nullptr;
         hasTimedOut = timer.hasTimedOut();
     }
     return queueReturn;
 }
 
+void Sensor::_awaitMeasurement([[maybe_unused]] const Microseconds sleepLength) noexcept
+{
+#if (THREADING_ENABLE)
+    thisThread::sleepFor(sleepLength);
+#else
+    bool needsMoreData = processNextPacket();
+    if (needsMoreData)
+    {
+        Error lastError = loadMainBufferFromSerial();
+        if (lastError != Error::None) { _asyncErrorQueue.put(AsyncError(lastError)); }
+    }
+#endif
+}
+
+#if (DEFERRED_PARSING_ENABLE)
+void Sensor::parseDeferredMeasurements() noexcept
+{
+    while (_measurementQueue.size() < _measurementQueue.capacity())
+    {
+        const auto packet = _deferredPacketQueue.get();
+        if (!packet) { break; }
+        _parseDeferredPacket(*packet);
+    }
+}
+
+Sensor::MeasurementView Sensor::getNextMeasurementView(CompositeDataView::OffsetTable& offsetTable, const bool block) noexcept
+{
+    MeasurementView measurementView;
+    if constexpr (Config::PacketDispatchers::compositeDataQueueCapacity == 0) { return measurementView; }
+    Timer timer(Config::Sensor::getMeasurementTimeoutLength);
+    timer.start();
+    while (true)
+    {
+        auto packet = _deferredPacketQueue.get();
+        if (!packet)
+        {
+            if (!block || timer.hasTimedOut()) { return measurementView; }
+            _awaitMeasurement(Config::Sensor::getMeasurementSleepDuration);
+            continue;
+        }
+        if (packet->details.syncByte != PacketDetails::SyncByte::FA)
+        {
+            // ASCII measurements have no view, so are parsed onto the MeasurementQueue as they would otherwise be
+            _asciiPacketDispatcher.parseDeferredPacket(*packet);
+            continue;
+        }
+        measurementView._packet = std::move(packet);
+        measurementView._view.emplace(*measurementView._packet, offsetTable);
+        if (measurementView._view->isValid()) { return measurementView; }
+        measurementView._view.reset();
+        measurementView._packet = nullptr;
+    }
+}
+
+void Sensor::_parseDeferredPacket(const bool mostRecentOnly) noexcept
+{
+    // Only the most recent packet needs parsing if every older one would be popped unread.
+    const auto packet = mostRecentOnly ? _deferredPacketQueue.getBack() : _deferredPacketQueue.get();
+    if (packet) { _parseDeferredPacket(*packet); }
+}
+
+void Sensor::_parseDeferredPacket(const Packet& packet) noexcept
+{
+    if (packet.details.syncByte == PacketDetails::SyncByte::Ascii) { _asciiPacketDispatcher.parseDeferredPacket(packet); }
+    else { _faPacketDispatcher.parseDeferredPacket(packet); }
+}
+#endif
+
 Error Sensor::_blockOnCommand(Command* command, Timer& timer) noexcept
 {
     bool hasTimedOut = false;
@@ -279,7 +402,7 @@ Error Sensor::reset() noexcept
     thisThread::sleepFor(Config::Sensor::resetSleepDuration);  // Give sensor time to start up
     if (!verifySensorConnectivity())
     {
-        auto portName = _serial.connectedPortName();
+        auto portName = _serial->connectedPortName();
         if (!portName.has_value()) { return Error::UnexpectedSerialError; }
         Error latestError = autoConnect(portName.value());
         if (latestError != Error::None) { return latestError; }
@@ -292,7 +415,7 @@ Error Sensor::restoreFactorySettings() noexcept
 {
     if constexpr (Config::CommandProcessor::commandProcQueueCapacity == 0) { return Error::CommandQueueFull; }
     RestoreFactorySettings rfs{};
-    auto baudRate = _serial.connectedBaudRate();
+    auto baudRate = _serial->connectedBaudRate();
     if (!baudRate) { return Error::SerialPortClosed; }
 
     Error sendCommandRetVal = sendCommand(&rfs, SendCommandBlockMode::Block, Config::Sensor::wnvSendTimeoutLength, Config::Sensor::wnvSendTimeoutLength * 2);
@@ -308,7 +431,7 @@ Error Sensor::restoreFactorySettings() noexcept
 #if (THREADING_ENABLE)
     _stopListening();
 #endif
-    const Error changeBaudRateError = _serial.changeBaudRate(115200);
+    const Error changeBaudRateError = _serial->changeBaudRate(115200);
     if (changeBaudRateError != Error::None) { return changeBaudRateError; }
     thisThread::sleepFor(Config::Sensor::resetSleepDuration);  // Give sensor time to start up
 #if (THREADING_ENABLE)
@@ -377,7 +500,7 @@ Error Sensor::sendCommand(Command* commandToSend, SendCommandBlockMode waitMode,
         else if (regCommandReturn.error == CommandProcessor::RegisterCommandReturn::Error::CommandResent) { return Error::CommandResent; }
         else { VN_ABORT(); }
     }
-    Error lastError = _serial.send(regCommandReturn.message);
+    Error lastError = _serial->send(regCommandReturn.message);
     if (lastError != Error::None) { return lastError; }
 
     if (waitMode == SendCommandBlockMode::None) { return Error::None; }
@@ -402,7 +525,7 @@ Error Sensor::sendCommand(Command* commandToSend, SendCommandBlockMode waitMode,
             else { VN_ABORT(); }
         }
 
-        lastError = _serial.send(regCommandReturn.message);
+        lastError = _serial->send(regCommandReturn.message);
         if (lastError != Error::None) { return lastError; }
 
         lastError = _blockOnCommand(commandToSend, timer);
@@ -420,7 +543,7 @@ Error Sensor::sendCommand(Command* commandToSend, SendCommandBlockMode waitMode,
 
 Error Sensor::serialSend(const AsciiMessage& msgToSend) noexcept
 {
-    Error lastError = _serial.send(msgToSend);
+    Error lastError = _serial->send(msgToSend);
     if (lastError != Error::None) { return lastError; }
     return Error::None;
 }
@@ -476,7 +599,36 @@ void Sensor::unsubscribeFromMessage(PacketQueue_Interface* queueToUnsubscribe, c
 // Unthreaded Packet Processing
 // ----------------------------
 
-Error Sensor::loadMainBufferFromSerial() noexcept { return _serial.getData(); }
+Error Sensor::loadMainBufferFromSerial() noexcept
+{
+    const size_t sizeBefore = _mainByteBuffer.size();
+    const Error error = _serial->getData();
+    if (_bufferAutoTuner.isTuning()) { _observeForBufferAutoTune(_mainByteBuffer.size() - sizeBefore); }
+    _linkMonitor.update(_packetSynchronizer, _mainByteBuffer.size(), _measurementQueue.highWatermark());
+    return error;
+}
+
+void Sensor::_observeForBufferAutoTune(const size_t numBytesRead) noexcept
+{
+    // Only called from the thread which reads the serial port and processes packets, so the main buffer can be safely reallocated here.
+    const size_t numPackets = _packetSynchronizer.getValidPacketCount(PacketSynchronizer::SyncBytes{0xFA}) +
+                              _packetSynchronizer.getValidPacketCount(PacketSynchronizer::SyncBytes{'$'});
+    const auto recommendation = _bufferAutoTuner.observe(numBytesRead, numPackets);
+    if (!recommendation.has_value()) { return; }
+    // The first window after connecting sets the capacities outright; later windows only grow them, so a quiet spell never shrinks a tuned buffer
+    size_t mainBufferCapacity = std::max(recommendation->mainBufferCapacity, _mainByteBuffer.size());
+    uint16_t measurementQueueCapacity = recommendation->measurementQueueCapacity;
+    if (!recommendation->isInitial)
+    {
+        if (mainBufferCapacity <= _mainByteBuffer.capacity() && measurementQueueCapacity <= _measurementQueue.capacity()) { return; }
+        mainBufferCapacity = std::max(mainBufferCapacity, _mainByteBuffer.capacity());
+        measurementQueueCapacity = std::max(measurementQueueCapacity, _measurementQueue.capacity());
+    }
+    VN_DEBUG_1("Auto-tuned main buffer to " + std::to_string(mainBufferCapacity) + " bytes, measurement queue to " +
+               std::to_string(measurementQueueCapacity) + " measurements.");
+    if (mainBufferCapacity != _mainByteBuffer.capacity()) { _mainByteBuffer.resize(mainBufferCapacity); }  // Fails harmlessly if the buffer is user-supplied
+    _measurementQueue.setCapacityLimit(measurementQueueCapacity);
+}
 
 bool Sensor::processNextPacket() noexcept { return _packetSynchronizer.dispatchNextPacket(); }
 
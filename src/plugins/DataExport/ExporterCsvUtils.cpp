@@ -167,66 +167,80 @@ std::array<std::array<CsvTypeInfo, 19>, 7> dataTypes{{
 
 CsvTypeInfo csvTypeLookup(size_t group, size_t field) { return dataTypes[group][field]; }
 
-int getMeasurementString(FaPacketExtractor& packet, const CsvTypeInfo& typeInfo, char* ptr, const uint16_t remaining)
+namespace
+{
+int appendComma(char* ptr, const int offset, const uint16_t remaining) noexcept
+{
+    if (offset >= remaining) { return 0; }
+    ptr[offset] = ',';
+    return 1;
+}
+}  // namespace
+
+int getMeasurementString(FaPacketExtractor& packet, const CsvTypeInfo& typeInfo, char* ptr, const uint16_t remaining, const CsvNumberFormat format)
 {
     switch (typeInfo.type)
     {
         case U8:
         {
-            return extractToString<uint8_t>(packet, typeInfo.len, ptr, remaining);
+            return extractToString<uint8_t>(packet, typeInfo.len, ptr, remaining, format);
         }
         case U16:
         {
-            return extractToString<uint16_t>(packet, typeInfo.len, ptr, remaining);
+            return extractToString<uint16_t>(packet, typeInfo.len, ptr, remaining, format);
         }
         case U32:
         {
-            return extractToString<uint32_t>(packet, typeInfo.len, ptr, remaining);
+            return extractToString<uint32_t>(packet, typeInfo.len, ptr, remaining, format);
         }
         case U64:
         {
-            return extractToString<uint64_t>(packet, typeInfo.len, ptr, remaining);
+            return extractToString<uint64_t>(packet, typeInfo.len, ptr, remaining, format);
         }
         case FLO:
         {
-            return extractToString<float>(packet, typeInfo.len, ptr, remaining);
+            return extractToString<float>(packet, typeInfo.len, ptr, remaining, format);
         }
         case DUB:
         {
-            return extractToString<double>(packet, typeInfo.len, ptr, remaining);
+            return extractToString<double>(packet, typeInfo.len, ptr, remaining, format);
         }
         case UTC:
         {
             int offset = 0;
-            offset += extractToString<int8_t>(packet, 1, ptr + offset, remaining - offset);
-            offset += extractToString<uint8_t>(packet, 5, ptr + offset, remaining - offset);
-            offset += extractToString<uint16_t>(packet, 1, ptr + offset, remaining - offset);
+            // Compatible output keeps the historical layout, which has no separator after the year or before fracsec
+            const bool separate = format != CsvNumberFormat::Compatible;
+            offset += extractToString<int8_t>(packet, 1, ptr + offset, remaining - offset, format);
+            if (separate) { offset += appendComma(ptr, offset, remaining); }
+            offset += extractToString<uint8_t>(packet, 5, ptr + offset, remaining - offset, format);
+            if (separate) { offset += appendComma(ptr, offset, remaining); }
+            offset += extractToString<uint16_t>(packet, 1, ptr + offset, remaining - offset, format);
             return offset;
         }
         case SAT:
         {
             int offset = 0;
-            offset += extractToString<uint8_t>(packet, 5, ptr + offset, remaining - offset);
-            offset += snprintf(ptr + offset, remaining - offset, ",");
-            offset += extractToString<int8_t>(packet, 1, ptr + offset, remaining - offset);
-            offset += snprintf(ptr + offset, remaining - offset, ",");
-            offset += extractToString<uint16_t>(packet, 1, ptr + offset, remaining - offset);
+            offset += extractToString<uint8_t>(packet, 5, ptr + offset, remaining - offset, format);
+            offset += appendComma(ptr, offset, remaining);
+            offset += extractToString<int8_t>(packet, 1, ptr + offset, remaining - offset, format);
+            offset += appendComma(ptr, offset, remaining);
+            offset += extractToString<uint16_t>(packet, 1, ptr + offset, remaining - offset, format);
             return offset;
         }
         case RAW:
         {
             int offset = 0;
-            offset += extractToString<uint8_t>(packet, 4, ptr + offset, remaining - offset);
-            offset += snprintf(ptr + offset, remaining - offset, ",");
-            offset += extractToString<int8_t>(packet, 1, ptr + offset, remaining - offset);
-            offset += snprintf(ptr + offset, remaining - offset, ",");
-            offset += extractToString<uint8_t>(packet, 1, ptr + offset, remaining - offset);
-            offset += snprintf(ptr + offset, remaining - offset, ",");
-            offset += extractToString<uint16_t>(packet, 1, ptr + offset, remaining - offset);
-            offset += snprintf(ptr + offset, remaining - offset, ",");
-            offset += extractToString<double>(packet, 2, ptr + offset, remaining - offset);
-            offset += snprintf(ptr + offset, remaining - offset, ",");
-            offset += extractToString<float>(packet, 1, ptr + offset, remaining - offset);
+            offset += extractToString<uint8_t>(packet, 4, ptr + offset, remaining - offset, format);
+            offset += appendComma(ptr, offset, remaining);
+            offset += extractToString<int8_t>(packet, 1, ptr + offset, remaining - offset, format);
+            offset += appendComma(ptr, offset, remaining);
+            offset += extractToString<uint8_t>(packet, 1, ptr + offset, remaining - offset, format);
+            offset += appendComma(ptr, offset, remaining);
+            offset += extractToString<uint16_t>(packet, 1, ptr + offset, remaining - offset, format);
+            offset += appendComma(ptr, offset, remaining);
+            offset += extractToString<double>(packet, 2, ptr + offset, remaining - offset, format);
+            offset += appendComma(ptr, offset, remaining);
+            offset += extractToString<float>(packet, 1, ptr + offset, remaining - offset, format);
 
             return offset;
         }
@@ -0,0 +1,166 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <cmath>
+#include <cstdint>
+
+#include "Config.hpp"
+#include "Interface/BandwidthPlanner.hpp"
+#include "Interface/Registers.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+using namespace VN::Registers::System;
+
+bool near(const double lhs, const double rhs) { return std::abs(lhs - rhs) < 1e-9 * std::max(1.0, std::abs(rhs)); }
+
+/// @brief Common TimeStartup and Ypr at 200 Hz on serial 1: 1 sync + 3 header + 8 + 12 + 2 crc = 26 bytes.
+BinaryOutput1 makeOutput1()
+{
+    BinaryOutput1 output;
+    output.common.timeStartup = 1;
+    output.common.ypr = 1;
+    output.asyncMode.serial1 = 1;
+    output.rateDivisor = 4;
+    return output;
+}
+
+/// @brief Time TimeGps, IMU UncompAccel and Attitude Quaternion at 800 Hz on serial 1: 1 sync + 7 header + 8 + 12 + 16 + 2 crc = 46 bytes.
+BinaryOutput2 makeOutput2()
+{
+    BinaryOutput2 output;
+    output.time.timeGps = 1;
+    output.imu.uncompAccel = 1;
+    output.attitude.quaternion = 1;
+    output.asyncMode.serial1 = 1;
+    output.rateDivisor = 1;
+    return output;
+}
+
+/// @brief GNSS SatInfo at 1 Hz on serial 2, which is planned for the most satellites the SDK will parse.
+BinaryOutput3 makeOutput3()
+{
+    BinaryOutput3 output;
+    output.gnss.gnss1SatInfo = 1;
+    output.asyncMode.serial2 = 1;
+    output.rateDivisor = 800;
+    return output;
+}
+
+constexpr uint16_t output3Length = 1 + 3 + 2 + 8 * Config::PacketFinders::gnssSatInfoMaxCount + 2;
+
+void testWorstCasePacketLength()
+{
+    VN_CHECK(BandwidthPlanner::worstCasePacketLength(makeOutput1()) == 26);
+    VN_CHECK(BandwidthPlanner::worstCasePacketLength(makeOutput2()) == 46);
+    VN_CHECK(BandwidthPlanner::worstCasePacketLength(makeOutput3()) == output3Length);
+    VN_CHECK(BandwidthPlanner::worstCasePacketLength(BinaryOutput1{}) == 0);
+}
+
+void testFits()
+{
+    const BinaryOutput1 output1 = makeOutput1();
+    const BinaryOutput2 output2 = makeOutput2();
+    const BinaryOutput3 output3 = makeOutput3();
+    const BinaryOutput* outputs[] = {&output1, &output2, &output3};
+
+    // Serial 1 carries 26 * 200 + 46 * 800 = 42000 bytes/s, of the 92160 at 921600 baud
+    const auto plan = BandwidthPlanner::plan(outputs, 3, BaudRate::BaudRates::Baud921600, BaudRate::SerialPort::Serial1);
+    VN_CHECK(plan.numOutputs == 3);
+    VN_CHECK(plan.outputs[0].packetLength == 26 && near(plan.outputs[0].packetsPerSecond, 200) && near(plan.outputs[0].bytesPerSecond, 5200));
+    VN_CHECK(plan.outputs[1].packetLength == 46 && near(plan.outputs[1].packetsPerSecond, 800) && near(plan.outputs[1].bytesPerSecond, 36800));
+    VN_CHECK(plan.outputs[2].packetLength == 0 && plan.outputs[2].bytesPerSecond == 0);  // Sent to serial 2 only
+    VN_CHECK(near(plan.bytesPerSecond, 42000));
+    VN_CHECK(near(plan.linkBytesPerSecond, 92160));
+    VN_CHECK(near(plan.utilization, 42000.0 / 92160.0));
+    VN_CHECK(plan.fits);
+    VN_CHECK(BandwidthPlanner::check(plan) == Error::None);
+    // 460800 baud allows 36864 bytes/s at 80%, so only 921600 will do
+    VN_CHECK(plan.suggestedBaudRate == BaudRate::BaudRates::Baud921600);
+    // Output 1 may run at up to 800 * 26 / (73728 - 36800) = 0.56 of the IMU rate; output 2 at up to 800 * 46 / (73728 - 5200) = 0.54
+    VN_CHECK(plan.outputs[0].suggestedRateDivisor == 1);
+    VN_CHECK(plan.outputs[1].suggestedRateDivisor == 1);
+    VN_CHECK(plan.outputs[2].suggestedRateDivisor == 0);
+
+    // Both ports together add the SatInfo output's bytes once a second
+    const auto bothPorts = BandwidthPlanner::plan(outputs, 3, BaudRate::BaudRates::Baud921600, BaudRate::SerialPort::ActiveSerial);
+    VN_CHECK(bothPorts.outputs[2].packetLength == output3Length && near(bothPorts.outputs[2].packetsPerSecond, 1));
+    VN_CHECK(near(bothPorts.bytesPerSecond, 42000 + output3Length));
+}
+
+void testDoesNotFit()
+{
+    const BinaryOutput1 output1 = makeOutput1();
+    const BinaryOutput2 output2 = makeOutput2();
+    const BinaryOutput* outputs[] = {&output1, &output2};
+
+    // 115200 baud allows 11520 * 0.8 = 9216 bytes/s
+    const auto plan = BandwidthPlanner::plan(outputs, 2, BaudRate::BaudRates::Baud115200, BaudRate::SerialPort::Serial1);
+    VN_CHECK(!plan.fits);
+    VN_CHECK(BandwidthPlanner::check(plan) == Error::InsufficientBaudRate);
+    VN_CHECK(near(plan.utilization, 42000.0 / 11520.0));
+    VN_CHECK(plan.suggestedBaudRate == BaudRate::BaudRates::Baud921600);
+    // Output 2 alone overloads the link, so no divisor of output 1 fits
+    VN_CHECK(plan.outputs[0].suggestedRateDivisor == 0);
+    // Output 2 gets the 9216 - 5200 = 4016 bytes/s left: 800 * 46 / 4016 = 9.16, so a divisor of 10
+    VN_CHECK(plan.outputs[1].suggestedRateDivisor == 10);
+
+    // A lower utilization limit tightens the fit: 92160 * 0.4 = 36864 < 42000
+    const auto strict = BandwidthPlanner::plan(outputs, 2, BaudRate::BaudRates::Baud921600, BaudRate::SerialPort::Serial1, 800, 0.4);
+    VN_CHECK(!strict.fits);
+
+    // Nothing carries 800 Hz of SatInfo alongside the rest
+    BinaryOutput3 output3 = makeOutput3();
+    output3.rateDivisor = 1;
+    output3.asyncMode.serial1 = 1;
+    const BinaryOutput* overloaded[] = {&output1, &output2, &output3};
+    const auto overloadedPlan = BandwidthPlanner::plan(overloaded, 3, BaudRate::BaudRates::Baud921600, BaudRate::SerialPort::Serial1);
+    VN_CHECK(!overloadedPlan.fits);
+    VN_CHECK(!overloadedPlan.suggestedBaudRate.has_value());
+}
+
+void testSkippedOutputs()
+{
+    BinaryOutput1 output1 = makeOutput1();
+    output1.rateDivisor = 0;  // Disabled
+    const BinaryOutput2 output2 = makeOutput2();
+    const BinaryOutput* outputs[] = {&output1, nullptr, &output2};
+    const auto plan = BandwidthPlanner::plan(outputs, 3, BaudRate::BaudRates::Baud921600, BaudRate::SerialPort::Serial1);
+    VN_CHECK(plan.outputs[0].bytesPerSecond == 0 && plan.outputs[1].bytesPerSecond == 0);
+    VN_CHECK(near(plan.bytesPerSecond, 36800));
+
+    // A faster IMU scales every output's rate
+    const auto fast = BandwidthPlanner::plan(outputs, 3, BaudRate::BaudRates::Baud921600, BaudRate::SerialPort::Serial1, 1600);
+    VN_CHECK(near(fast.bytesPerSecond, 2 * 36800));
+}
+
+int main()
+{
+    testWorstCasePacketLength();
+    testFits();
+    testDoesNotFit();
+    testSkippedOutputs();
+    return Test::result("BandwidthPlannerTest");
+}
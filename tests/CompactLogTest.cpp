@@ -0,0 +1,150 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "Config.hpp"
+#include "plugins/SimpleLogger/CompactLog.hpp"
+#if (THREADING_ENABLE)
+#include "plugins/DataExport/FileExporter.hpp"
+#endif
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+std::vector<uint8_t> makeStream(uint64_t& numFaPackets)
+{
+    std::vector<uint8_t> stream;
+    numFaPackets = 0;
+    for (int i = 0; i < 300; ++i)
+    {
+        Test::appendCommonPacket(stream, 1000000000ull + 2500000ull * i, (i % 2) == 0, 0.1f * i);
+        ++numFaPackets;
+        if (i % 50 == 0)
+        {
+            const char ascii[] = "$VNYPR,+010.000,+000.000,+000.000*60\r\n";
+            stream.insert(stream.end(), ascii, ascii + sizeof(ascii) - 1);
+            stream.insert(stream.end(), {0xFA, 0x01});  // Corrupt bytes, which must survive verbatim
+        }
+    }
+    return stream;
+}
+
+std::vector<uint8_t> encode(const std::vector<uint8_t>& stream, const size_t chunkSize)
+{
+    CompactLogEncoder encoder;
+    std::vector<uint8_t> encoded;
+    for (size_t i = 0; i < stream.size(); i += chunkSize)
+    {
+        const auto& chunk = encoder.consume(stream.data() + i, std::min(chunkSize, stream.size() - i));
+        encoded.insert(encoded.end(), chunk.begin(), chunk.end());
+    }
+    const auto& tail = encoder.finish();
+    encoded.insert(encoded.end(), tail.begin(), tail.end());
+    return encoded;
+}
+
+void testRoundTrip()
+{
+    uint64_t numFaPackets;
+    const std::vector<uint8_t> stream = makeStream(numFaPackets);
+    for (const size_t chunkSize : {size_t(1), size_t(7), size_t(512), stream.size()})
+    {
+        const std::vector<uint8_t> encoded = encode(stream, chunkSize);
+        VN_CHECK(CompactLog::isCompactLog(encoded.data(), encoded.size()));
+        VN_CHECK(encoded.size() < stream.size() / 2);
+
+        std::vector<uint8_t> decoded;
+        VN_CHECK(!CompactLogDecoder().decode(encoded.data(), encoded.size(), decoded));
+        VN_CHECK(decoded == stream);
+    }
+}
+
+void testTruncation()
+{
+    uint64_t numFaPackets;
+    const std::vector<uint8_t> stream = makeStream(numFaPackets);
+    const std::vector<uint8_t> encoded = encode(stream, stream.size());
+
+    size_t previousSize = 0;
+    for (size_t size = sizeof(CompactLog::FILE_MAGIC); size < encoded.size(); ++size)
+    {
+        std::vector<uint8_t> decoded;
+        CompactLogDecoder().decode(encoded.data(), size, decoded);
+        // Always a prefix of the original, growing with the input, and never ending part way through a rebuilt packet
+        VN_CHECK(decoded.size() <= stream.size() && std::equal(decoded.begin(), decoded.end(), stream.begin()));
+        VN_CHECK(decoded.size() >= previousSize);
+        VN_CHECK(decoded.size() == stream.size() || stream[decoded.size()] == 0xFA || stream[decoded.size()] == '$');
+        previousSize = decoded.size();
+    }
+
+    std::vector<uint8_t> decoded;
+    VN_CHECK(CompactLogDecoder().decode(stream.data(), stream.size(), decoded));  // Not a compact log
+    VN_CHECK(decoded.empty());
+}
+
+#if (THREADING_ENABLE)
+void testFileExporterReadsTruncatedLog()
+{
+    uint64_t numFaPackets;
+    const std::vector<uint8_t> stream = makeStream(numFaPackets);
+    std::vector<uint8_t> encoded = encode(stream, stream.size());
+    encoded.resize(encoded.size() * 3 / 4);
+
+    std::vector<uint8_t> decoded;
+    VN_CHECK(CompactLogDecoder().decode(encoded.data(), encoded.size(), decoded));
+    uint64_t numDecodedFaPackets = 0;
+    for (size_t i = 0; i < decoded.size(); ++i)
+    {
+        if (decoded[i] != 0xFA || i + 4 > decoded.size() || decoded[i + 1] != 0x01) { continue; }
+        const size_t length = (decoded[i + 2] == 0x09) ? 22 : 10;  // Payload and CRC
+        if (i + 4 + length > decoded.size()) { continue; }
+        ++numDecodedFaPackets;
+        i += 4 + length - 1;
+    }
+    VN_CHECK(numDecodedFaPackets > numFaPackets / 2);
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "CompactLogTest.bin";
+    std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(encoded.data()), encoded.size());
+    FileExporter fileExporter;
+    fileExporter.processFile(Filesystem::FilePath(path.string().c_str()));
+    VN_CHECK(fileExporter.getParsingStats().validFaPacketCount == numDecodedFaPackets);
+    std::filesystem::remove(path);
+}
+#endif
+
+int main()
+{
+    testRoundTrip();
+    testTruncation();
+#if (THREADING_ENABLE)
+    testFileExporterReadsTruncatedLog();
+#endif
+    return Test::result("CompactLogTest");
+}
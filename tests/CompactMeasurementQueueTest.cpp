@@ -0,0 +1,187 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <cstdint>
+#include <vector>
+
+#include "Config.hpp"
+#include "Implementation/FaPacketDispatcher.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "Implementation/QueueDefinitions.hpp"
+#include "Interface/CompactCompositeData.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+/// @brief Frames and dispatches every packet in byteBuffer, as the PacketSynchronizer would.
+void dispatchAll(FaPacketDispatcher& dispatcher, ByteBuffer& byteBuffer)
+{
+    while (byteBuffer.size() > 0)
+    {
+        const auto found = dispatcher.findPacket(byteBuffer, 0);
+        VN_CHECK(found.validity == PacketDispatcher::FindPacketRetVal::Validity::Valid);
+        if (found.validity != PacketDispatcher::FindPacketRetVal::Validity::Valid) { return; }
+        dispatcher.dispatchPacket(byteBuffer, 0);
+        byteBuffer.discard(found.length);
+    }
+}
+
+/// @brief Checks a compact measurement against the CompositeData the generic parser makes of the same packet.
+void checkMatchesGenericParse(const CompactCompositeData& compact, const std::vector<uint8_t>& packet, const uint64_t timeStartup, const float yaw)
+{
+    ByteBuffer byteBuffer(packet.size());
+    byteBuffer.put(packet.data(), packet.size());
+    const auto found = FaPacketProtocol::findPacket(byteBuffer, 0);
+    const auto parsed = FaPacketProtocol::parsePacket(byteBuffer, 0, found.metadata, Config::PacketDispatchers::cdEnabledMeasTypes);
+    VN_CHECK(parsed.has_value());
+    if (!parsed.has_value()) { return; }
+
+    VN_CHECK(compact.header() == found.metadata.header);
+    VN_CHECK(compact.time().timeStartup().has_value() && compact.time().timeStartup()->nanoseconds() == timeStartup);
+    VN_CHECK(compact.attitude().ypr().has_value() && compact.attitude().ypr()->yaw == yaw);
+
+    const CompositeData expanded = compact.toCompositeData();
+    VN_CHECK(expanded.time.timeStartup.has_value() && expanded.time.timeStartup->nanoseconds() == parsed->time.timeStartup->nanoseconds());
+    VN_CHECK(expanded.attitude.ypr.has_value() && parsed->attitude.ypr.has_value());
+    if (expanded.attitude.ypr.has_value() && parsed->attitude.ypr.has_value())
+    {
+        VN_CHECK(expanded.attitude.ypr->yaw == parsed->attitude.ypr->yaw);
+        VN_CHECK(expanded.attitude.ypr->pitch == parsed->attitude.ypr->pitch);
+        VN_CHECK(expanded.attitude.ypr->roll == parsed->attitude.ypr->roll);
+    }
+    VN_CHECK(!expanded.attitude.quaternion.has_value() && !parsed->attitude.quaternion.has_value());
+    VN_CHECK(!expanded.time.timeGps.has_value() && !parsed->time.timeGps.has_value());
+}
+
+void testDispatcherFillsCompactQueue()
+{
+    MeasurementQueue measurementQueue{Config::PacketDispatchers::compositeDataQueueCapacity};
+    CompactMeasurementQueue compactQueue{};
+    CompactGnssSlab gnssSlab;
+    FaPacketDispatcher dispatcher(&measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes);
+    VN_CHECK(!dispatcher.setCompactMeasurementQueue(&compactQueue, &gnssSlab));
+
+    std::vector<uint8_t> first;
+    std::vector<uint8_t> second;
+    Test::appendCommonPacket(first, 1000, true, 10.0f);
+    Test::appendCommonPacket(second, 2000, true, 20.0f);
+
+    // The second packet wraps the end of the buffer, so is populated from the dispatcher's linear copy
+    ByteBuffer byteBuffer(first.size() + second.size() / 2);
+    byteBuffer.put(first.data(), first.size());
+    dispatchAll(dispatcher, byteBuffer);
+    byteBuffer.put(second.data(), second.size());
+    VN_CHECK(byteBuffer.numLinearBytes() < second.size());
+    dispatchAll(dispatcher, byteBuffer);
+
+    VN_CHECK(measurementQueue.isEmpty());
+    VN_CHECK(compactQueue.size() == 2);
+    auto compact = compactQueue.get();
+    VN_CHECK(compact != nullptr);
+    if (compact) { checkMatchesGenericParse(*compact, first, 1000, 10.0f); }
+    compact = compactQueue.get();
+    VN_CHECK(compact != nullptr);
+    if (compact) { checkMatchesGenericParse(*compact, second, 2000, 20.0f); }
+    compact = nullptr;
+
+    // Unset, measurements go back to the measurement queue
+    VN_CHECK(!dispatcher.setCompactMeasurementQueue(nullptr, nullptr));
+    byteBuffer.put(first.data(), first.size());
+    dispatchAll(dispatcher, byteBuffer);
+    VN_CHECK(compactQueue.isEmpty());
+    VN_CHECK(measurementQueue.size() == 1);
+}
+
+void testDeferredPacketsFillCompactQueue()
+{
+    MeasurementQueue measurementQueue{Config::PacketDispatchers::compositeDataQueueCapacity};
+    PacketQueue<Config::PacketDispatchers::deferredPacketQueueCapacity> deferredQueue{Config::PacketFinders::faPacketMaxLength};
+    CompactMeasurementQueue compactQueue{};
+    CompactGnssSlab gnssSlab;
+    FaPacketDispatcher dispatcher(&measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes, &deferredQueue);
+    VN_CHECK(!dispatcher.setCompactMeasurementQueue(&compactQueue, &gnssSlab));
+
+    std::vector<uint8_t> packet;
+    Test::appendCommonPacket(packet, 3000, true, 30.0f);
+    ByteBuffer byteBuffer(packet.size());
+    byteBuffer.put(packet.data(), packet.size());
+    dispatchAll(dispatcher, byteBuffer);
+    VN_CHECK(compactQueue.isEmpty());  // Nothing is populated on the listening thread
+
+    auto deferred = deferredQueue.get();
+    VN_CHECK(deferred != nullptr);
+    if (deferred) { VN_CHECK(!dispatcher.parseDeferredPacket(*deferred)); }
+    VN_CHECK(measurementQueue.isEmpty());
+    const auto compact = compactQueue.get();
+    VN_CHECK(compact != nullptr);
+    if (compact) { checkMatchesGenericParse(*compact, packet, 3000, 30.0f); }
+}
+
+void testReusedSlotsAreRepopulated()
+{
+    MeasurementQueue measurementQueue{Config::PacketDispatchers::compositeDataQueueCapacity};
+    CompactMeasurementQueue compactQueue{};
+    CompactGnssSlab gnssSlab;
+    FaPacketDispatcher dispatcher(&measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes);
+    VN_CHECK(!dispatcher.setCompactMeasurementQueue(&compactQueue, &gnssSlab));
+
+    // A TimeStartup-only packet in a slot which last held one with YPR must not keep the old YPR
+    const size_t numPackets = 2 * Config::PacketDispatchers::compositeDataQueueCapacity + 1;
+    for (size_t i = 0; i < numPackets; ++i)
+    {
+        std::vector<uint8_t> packet;
+        Test::appendCommonPacket(packet, i, (i % 2) == 0, static_cast<float>(i));
+        ByteBuffer byteBuffer(packet.size());
+        byteBuffer.put(packet.data(), packet.size());
+        dispatchAll(dispatcher, byteBuffer);
+        if (i + 1 < numPackets) { compactQueue.get(); }  // Popped and released, so the next put reuses the slot
+    }
+    const auto compact = compactQueue.getBack();
+    VN_CHECK(compact != nullptr);
+    if (compact) { VN_CHECK(compact->time().timeStartup()->nanoseconds() == numPackets - 1); }
+
+    std::vector<uint8_t> packet;
+    Test::appendCommonPacket(packet, 99, false);
+    ByteBuffer byteBuffer(packet.size());
+    for (size_t i = 0; i < Config::PacketDispatchers::compositeDataQueueCapacity; ++i)
+    {
+        byteBuffer.put(packet.data(), packet.size());
+        dispatchAll(dispatcher, byteBuffer);
+    }
+    while (auto reused = compactQueue.get())
+    {
+        VN_CHECK(reused->time().timeStartup().has_value());
+        VN_CHECK(!reused->attitude().ypr().has_value());
+    }
+}
+
+int main()
+{
+    testDispatcherFillsCompactQueue();
+    testDeferredPacketsFillCompactQueue();
+    testReusedSlotsAreRepopulated();
+    return Test::result("CompactMeasurementQueueTest");
+}
@@ -0,0 +1,160 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <variant>
+#include <vector>
+
+#include "Config.hpp"
+#include "Implementation/CoreUtils.hpp"
+#include "Implementation/FaPacketDispatcher.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "Implementation/QueueDefinitions.hpp"
+#include "Interface/CompositeDataView.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+/// @brief Whether both are absent, or both present with the same bytes.
+template <class T>
+bool sameValue(const std::optional<T>& lhs, const std::optional<T>& rhs)
+{
+    if (lhs.has_value() != rhs.has_value()) { return false; }
+    return !lhs.has_value() || (std::memcmp(&*lhs, &*rhs, sizeof(T)) == 0);
+}
+
+/// @brief Appends a Time, IMU and Attitude group packet: TimeStartup, TimeGps and SyncInCnt; UncompAccel and Temperature; Ypr and Quaternion.
+void appendMultiGroupPacket(std::vector<uint8_t>& stream, const uint32_t seed)
+{
+    const size_t packetIndex = stream.size();
+    stream.insert(stream.end(), {0xFA, 0x16, 0x83, 0x00, 0x14, 0x00, 0x06, 0x00});
+    const size_t payloadLength = 8 + 8 + 4 + 12 + 4 + 12 + 16;
+    uint32_t value = seed;
+    for (size_t i = 0; i < payloadLength; ++i)
+    {
+        value = value * 1103515245 + 12345;
+        stream.push_back(static_cast<uint8_t>(value >> 16));
+    }
+    const uint16_t crc = CalculateCRC(stream.data() + packetIndex + 1, stream.size() - packetIndex - 1);
+    stream.push_back(static_cast<uint8_t>(crc >> 8));
+    stream.push_back(static_cast<uint8_t>(crc));
+}
+
+/// @brief Checks every measurement the view reads from the packet against the CompositeData parsed from it.
+void checkViewMatchesCompositeData(const CompositeDataView& view, const CompositeData& compositeData)
+{
+    VN_CHECK(view.isValid());
+    const auto header = compositeData.header();
+    VN_CHECK(std::holds_alternative<BinaryHeader>(header) && (view.header() == std::get<BinaryHeader>(header)));
+    VN_CHECK(sameValue(view.time().timeStartup(), compositeData.time.timeStartup));
+    VN_CHECK(sameValue(view.time().timeGps(), compositeData.time.timeGps));
+    VN_CHECK(sameValue(view.time().syncInCnt(), compositeData.time.syncInCnt));
+    VN_CHECK(sameValue(view.time().syncOutCnt(), compositeData.time.syncOutCnt));
+    VN_CHECK(sameValue(view.time().timeSyncIn(), compositeData.time.timeSyncIn));
+    VN_CHECK(sameValue(view.imu().uncompAccel(), compositeData.imu.uncompAccel));
+    VN_CHECK(sameValue(view.imu().temperature(), compositeData.imu.temperature));
+    VN_CHECK(sameValue(view.imu().angularRate(), compositeData.imu.angularRate));
+    VN_CHECK(sameValue(view.attitude().ypr(), compositeData.attitude.ypr));
+    VN_CHECK(sameValue(view.attitude().quaternion(), compositeData.attitude.quaternion));
+    VN_CHECK(sameValue(view.attitude().dcm(), compositeData.attitude.dcm));
+}
+
+/// @brief Dispatches stream with deferred parsing, as the listening thread would, then checks each queued packet's view against the CompositeData
+/// parseDeferredPacket makes of the same packet.
+void checkDeferredPackets(const std::vector<uint8_t>& stream, const size_t numPackets)
+{
+    MeasurementQueue measurementQueue{Config::PacketDispatchers::compositeDataQueueCapacity};
+    PacketQueue<Config::PacketDispatchers::deferredPacketQueueCapacity> deferredQueue{Config::PacketFinders::faPacketMaxLength};
+    FaPacketDispatcher dispatcher(&measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes, &deferredQueue);
+
+    ByteBuffer byteBuffer(stream.size());
+    byteBuffer.put(stream.data(), stream.size());
+    while (byteBuffer.size() > 0)
+    {
+        const auto found = dispatcher.findPacket(byteBuffer, 0);
+        VN_CHECK(found.validity == PacketDispatcher::FindPacketRetVal::Validity::Valid);
+        if (found.validity != PacketDispatcher::FindPacketRetVal::Validity::Valid) { return; }
+        dispatcher.dispatchPacket(byteBuffer, 0);
+        byteBuffer.discard(found.length);
+    }
+    VN_CHECK(deferredQueue.size() == numPackets);
+
+    CompositeDataView::OffsetTable offsetTable;
+    size_t numChecked = 0;
+    while (auto packet = deferredQueue.get())
+    {
+        const CompositeDataView view(*packet, offsetTable);
+        VN_CHECK(!dispatcher.parseDeferredPacket(*packet));
+        const auto compositeData = measurementQueue.get();
+        VN_CHECK(compositeData != nullptr);
+        if (compositeData) { checkViewMatchesCompositeData(view, *compositeData); }
+        VN_CHECK(view.timestamp == packet->details.faMetadata.timestamp);
+        ++numChecked;
+    }
+    VN_CHECK(numChecked == numPackets);
+}
+
+void testNativeGroups()
+{
+    std::vector<uint8_t> stream;
+    for (uint32_t i = 0; i < 4; ++i) { appendMultiGroupPacket(stream, i); }
+    checkDeferredPackets(stream, 4);
+}
+
+void testCommonGroup()
+{
+    std::vector<uint8_t> stream;
+    Test::appendCommonPacket(stream, 1000, true, 10.0f);
+    Test::appendCommonPacket(stream, 2000, false);
+    appendMultiGroupPacket(stream, 7);  // A different header between two of the same, so the offset table is rebuilt
+    Test::appendCommonPacket(stream, 3000, true, 30.0f);
+    checkDeferredPackets(stream, 4);
+}
+
+void testMismatchedPacketIsInvalid()
+{
+    std::vector<uint8_t> packet;
+    Test::appendCommonPacket(packet, 1000, true);
+    FaPacketProtocol::Metadata metadata;
+    metadata.header.outputGroups.push_back(0x01);
+    metadata.header.outputTypes.push_back(0x0009);
+    metadata.length = packet.size() - 4;  // Too short for the header's measurements
+    CompositeDataView::OffsetTable offsetTable;
+    const CompositeDataView view(packet.data(), metadata, offsetTable);
+    VN_CHECK(!view.isValid());
+    VN_CHECK(!view.time().timeStartup().has_value());
+    VN_CHECK(!view.toCompositeData().has_value());
+}
+
+int main()
+{
+    testNativeGroups();
+    testCommonGroup();
+    testMismatchedPacketIsInvalid();
+    return Test::result("CompositeDataViewTest");
+}
@@ -0,0 +1,168 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <cfloat>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "plugins/DataExport/ExporterCsvUtils.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+template <class T>
+std::string toChars(const T value)
+{
+    char buffer[512];
+    char* end = CsvFormat::toChars(buffer, buffer + sizeof(buffer), value, CsvNumberFormat::Compatible);
+    return end == nullptr ? std::string("<did not fit>") : std::string(buffer, end);
+}
+
+/// @brief The historical output each Compatible conversion must reproduce byte for byte.
+template <class T>
+std::string printf(const T value)
+{
+    char buffer[512];
+    if constexpr (std::is_same_v<T, float>) { std::snprintf(buffer, sizeof(buffer), "%f", value); }
+    else if constexpr (std::is_same_v<T, double>) { std::snprintf(buffer, sizeof(buffer), "%12.8f", value); }
+    else if constexpr (std::is_same_v<T, uint64_t>) { std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value)); }
+    else { std::snprintf(buffer, sizeof(buffer), "%d", static_cast<int>(value)); }
+    return buffer;
+}
+
+template <class T>
+void checkMatchesPrintf(const T value)
+{
+    const std::string expected = printf(value);
+    const std::string actual = toChars(value);
+    if (actual != expected)
+    {
+        ++Test::numFailures();
+        std::cout << "expected \"" << expected << "\" but got \"" << actual << "\"" << std::endl;
+    }
+}
+
+template <class T>
+void checkFloatingEdgeValues()
+{
+    using Limits = std::numeric_limits<T>;
+    const T values[] = {T(0),
+                        -T(0),
+                        T(1),
+                        T(-1),
+                        T(0.5),
+                        T(-0.5),
+                        T(1e-7),
+                        T(-1e-7),
+                        T(5e-7),
+                        T(5e-9),
+                        T(0.0000005),
+                        T(0.125),
+                        T(2.5),
+                        T(123456.789),
+                        T(-98765.4321),
+                        T(1e10),
+                        T(1e20),
+                        T(-1e30),
+                        T(3.4e38),
+                        Limits::max(),
+                        Limits::lowest(),
+                        Limits::min(),
+                        Limits::denorm_min(),
+                        -Limits::denorm_min(),
+                        Limits::epsilon(),
+                        Limits::infinity(),
+                        -Limits::infinity(),
+                        Limits::quiet_NaN(),
+                        -Limits::quiet_NaN()};
+    for (const T value : values) { checkMatchesPrintf(value); }
+}
+
+template <class T>
+void checkIntegerLimits()
+{
+    using Limits = std::numeric_limits<T>;
+    const T values[] = {Limits::min(), static_cast<T>(Limits::min() + 1), T(0), T(1), static_cast<T>(Limits::max() - 1), Limits::max()};
+    for (const T value : values) { checkMatchesPrintf(value); }
+}
+
+/// @brief Checks a spread of bit patterns, covering exponents a fixed list would miss.
+template <class T, class Bits>
+void checkBitPatterns()
+{
+    Bits bits = 0x9E3779B97F4A7C15ULL & std::numeric_limits<Bits>::max();
+    for (int i = 0; i < 20000; ++i)
+    {
+        bits = bits * 6364136223846793005ULL + 1442695040888963407ULL;
+        T value;
+        std::memcpy(&value, &bits, sizeof(T));
+        checkMatchesPrintf(value);
+    }
+}
+
+void testFloat()
+{
+    checkFloatingEdgeValues<float>();
+    checkBitPatterns<float, uint32_t>();
+}
+
+void testDouble()
+{
+    checkFloatingEdgeValues<double>();
+    checkBitPatterns<double, uint64_t>();
+}
+
+void testIntegers()
+{
+    checkIntegerLimits<int8_t>();
+    checkIntegerLimits<uint8_t>();
+    checkIntegerLimits<int16_t>();
+    checkIntegerLimits<uint16_t>();
+    checkIntegerLimits<int32_t>();
+    checkIntegerLimits<uint32_t>();  // "%d" prints the upper half as negative
+    checkIntegerLimits<uint64_t>();
+}
+
+void testDoesNotFit()
+{
+    char buffer[8];
+    VN_CHECK(CsvFormat::toChars(buffer, buffer + sizeof(buffer), 1.0) == nullptr);  // "  1.00000000" needs 12
+    VN_CHECK(CsvFormat::toChars(buffer, buffer + sizeof(buffer), 1.0f) == buffer + 8);  // "1.000000" fills it exactly, as no terminator is written
+    VN_CHECK(CsvFormat::toChars(buffer, buffer + 4, std::numeric_limits<int32_t>::min()) == nullptr);
+}
+
+int main()
+{
+    testFloat();
+    testDouble();
+    testIntegers();
+    testDoesNotFit();
+    return Test::result("CsvFormatTest");
+}
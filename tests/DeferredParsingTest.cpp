@@ -0,0 +1,138 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "Config.hpp"
+#include "Implementation/AsciiPacketDispatcher.hpp"
+#include "Implementation/CommandProcessor.hpp"
+#include "Implementation/FaPacketDispatcher.hpp"
+#include "Implementation/PacketSynchronizer.hpp"
+#include "Implementation/QueueDefinitions.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+void appendAsciiYpr(std::vector<uint8_t>& stream, const float yaw)
+{
+    char payload[48];
+    std::snprintf(payload, sizeof(payload), "VNYPR,%+08.3f,+001.500,-002.250", yaw);
+    uint8_t checksum = 0;
+    for (const char* c = payload; *c != '\0'; ++c) { checksum ^= static_cast<uint8_t>(*c); }
+    char packet[64];
+    const int length = std::snprintf(packet, sizeof(packet), "$%s*%02X\r\n", payload, checksum);
+    stream.insert(stream.end(), packet, packet + length);
+}
+
+/// @brief The FA and ASCII dispatchers sharing one deferred packet queue, as Sensor sets them up with DEFERRED_PARSING_ENABLE.
+struct DeferredDispatch
+{
+    MeasurementQueue measurementQueue{Config::PacketDispatchers::compositeDataQueueCapacity};
+    PacketQueue<Config::PacketDispatchers::deferredPacketQueueCapacity> deferredQueue{
+        std::max<size_t>(Config::PacketFinders::faPacketMaxLength, Config::PacketFinders::asciiPacketMaxLength)};
+    CommandProcessor commandProcessor{nullptr};
+    FaPacketDispatcher faDispatcher{&measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes, &deferredQueue};
+    AsciiPacketDispatcher asciiDispatcher{&measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes, &commandProcessor, &deferredQueue};
+    ByteBuffer byteBuffer{4096};
+    PacketSynchronizer packetSynchronizer{byteBuffer};
+
+    DeferredDispatch()
+    {
+        VN_CHECK(!packetSynchronizer.addDispatcher(&faDispatcher));
+        VN_CHECK(!packetSynchronizer.addDispatcher(&asciiDispatcher));
+    }
+
+    void dispatch(const std::vector<uint8_t>& stream)
+    {
+        byteBuffer.put(stream.data(), stream.size());
+        while (!packetSynchronizer.dispatchNextPacket()) {}
+    }
+
+    /// @brief Parses the oldest deferred packet with the dispatcher that framed it, as Sensor does.
+    bool parseNext()
+    {
+        const auto packet = deferredQueue.get();
+        if (!packet) { return false; }
+        if (packet->details.syncByte == PacketDetails::SyncByte::Ascii) { VN_CHECK(!asciiDispatcher.parseDeferredPacket(*packet)); }
+        else { VN_CHECK(!faDispatcher.parseDeferredPacket(*packet)); }
+        return true;
+    }
+};
+
+/// @brief Appends count packets alternating between binary and ASCII, each with a yaw of its index so the parsed order can be checked.
+void appendPackets(std::vector<uint8_t>& stream, const int firstIndex, const int count)
+{
+    for (int i = firstIndex; i < firstIndex + count; ++i)
+    {
+        if ((i % 3) == 1) { appendAsciiYpr(stream, static_cast<float>(i)); }
+        else { Test::appendCommonPacket(stream, 1000 * (i + 1), true, static_cast<float>(i)); }
+    }
+}
+
+/// @brief Pops the next measurement and checks it is the index'th packet, parsed by the right dispatcher.
+void checkNextMeasurement(MeasurementQueue& measurementQueue, const int index)
+{
+    const auto measurement = measurementQueue.get();
+    VN_CHECK(measurement != nullptr);
+    if (!measurement) { return; }
+    VN_CHECK(measurement->attitude.ypr.has_value() && measurement->attitude.ypr->yaw == static_cast<float>(index));
+    const bool isAscii = (index % 3) == 1;
+    VN_CHECK(measurement->time.timeStartup.has_value() == !isAscii);
+    if (!isAscii) { VN_CHECK(measurement->time.timeStartup->nanoseconds() == static_cast<uint64_t>(1000 * (index + 1))); }
+}
+
+void testArrivalOrderIsKept()
+{
+    DeferredDispatch deferred;
+    std::vector<uint8_t> stream;
+    appendPackets(stream, 0, 12);
+    deferred.dispatch(stream);
+
+    // Nothing is parsed on the listening thread
+    VN_CHECK(deferred.measurementQueue.isEmpty());
+    VN_CHECK(deferred.deferredQueue.size() == 12);
+
+    // Parsing some while more arrive must not let the newer ones overtake
+    for (int i = 0; i < 5; ++i) { VN_CHECK(deferred.parseNext()); }
+    stream.clear();
+    appendPackets(stream, 12, 6);
+    deferred.dispatch(stream);
+    VN_CHECK(deferred.deferredQueue.size() == 13);
+    for (int i = 0; i < 5; ++i) { checkNextMeasurement(deferred.measurementQueue, i); }
+
+    while (deferred.parseNext()) {}
+    for (int i = 5; i < 18; ++i) { checkNextMeasurement(deferred.measurementQueue, i); }
+    VN_CHECK(deferred.measurementQueue.isEmpty());
+}
+
+int main()
+{
+    testArrivalOrderIsKept();
+    return Test::result("DeferredParsingTest");
+}
@@ -0,0 +1,221 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "Implementation/FaPacketProtocol.hpp"
+#include "plugins/DataExport/ColumnarDecoder.hpp"
+#include "plugins/DataExport/ExporterColumnar.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+constexpr size_t numYprPackets = 10;
+constexpr size_t numTimeOnlyPackets = 3;
+
+/// @brief Ypr packets with yaw equal to their index, and TimeStartup-only packets after every third, all with increasing TimeStartup.
+std::vector<uint8_t> makeStream()
+{
+    std::vector<uint8_t> stream;
+    uint64_t timeStartup = 1000;
+    size_t numTimeOnly = 0;
+    for (size_t i = 0; i < numYprPackets; ++i)
+    {
+        Test::appendCommonPacket(stream, timeStartup++, true, static_cast<float>(i));
+        if (i % 3 == 2 && numTimeOnly < numTimeOnlyPackets)
+        {
+            Test::appendCommonPacket(stream, timeStartup++, false);
+            ++numTimeOnly;
+        }
+    }
+    return stream;
+}
+
+struct ColumnChunk
+{
+    uint8_t type;
+    uint8_t elementSize;
+    std::vector<uint8_t> values;
+};
+
+/// @brief Reads a columnar file back, concatenating each column's chunks across row groups in file order.
+/// @return The number of rows in each row group, in file order.
+std::vector<uint32_t> readColumnarFile(const std::filesystem::path& path, std::vector<ColumnChunk>& columns)
+{
+    std::ifstream file(path, std::ios::binary);
+    const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::vector<uint32_t> rowGroups;
+    VN_CHECK(bytes.size() >= sizeof(ExporterColumnar::FILE_MAGIC));
+    VN_CHECK(std::memcmp(bytes.data(), ExporterColumnar::FILE_MAGIC, sizeof(ExporterColumnar::FILE_MAGIC)) == 0);
+
+    // Walked from the end, as each footer gives the size of its row group
+    std::vector<std::pair<size_t, size_t>> groupBounds;  // Start of the row group, start of its footer
+    size_t end = bytes.size();
+    while (end > sizeof(ExporterColumnar::FILE_MAGIC))
+    {
+        uint32_t footerLength, magic;
+        std::memcpy(&footerLength, &bytes[end - 8], sizeof(footerLength));
+        std::memcpy(&magic, &bytes[end - 4], sizeof(magic));
+        VN_CHECK(magic == ExporterColumnar::ROW_GROUP_MAGIC);
+        if (magic != ExporterColumnar::ROW_GROUP_MAGIC || footerLength > end) { return rowGroups; }
+        const size_t footer = end - footerLength;
+        uint64_t dataLength;
+        std::memcpy(&dataLength, &bytes[footer], sizeof(dataLength));
+        VN_CHECK(dataLength % 8 == 0);
+        groupBounds.insert(groupBounds.begin(), {footer - dataLength, footer});
+        end = footer - dataLength;
+    }
+    VN_CHECK(end == sizeof(ExporterColumnar::FILE_MAGIC));
+
+    for (const auto& [groupStart, footer] : groupBounds)
+    {
+        uint32_t numRows;
+        uint16_t numColumns;
+        std::memcpy(&numRows, &bytes[footer + 8], sizeof(numRows));
+        std::memcpy(&numColumns, &bytes[footer + 12], sizeof(numColumns));
+        rowGroups.push_back(numRows);
+        if (columns.empty()) { columns.resize(numColumns); }
+        VN_CHECK(columns.size() == numColumns);
+
+        size_t entry = footer + 16;
+        for (uint16_t i = 0; i < numColumns && i < columns.size(); ++i)
+        {
+            uint64_t offset;
+            std::memcpy(&offset, &bytes[entry], sizeof(offset));
+            VN_CHECK(offset % 8 == 0);
+            columns[i].type = bytes[entry + 11];
+            columns[i].elementSize = bytes[entry + 12];
+            const uint8_t* values = &bytes[groupStart + offset];
+            columns[i].values.insert(columns[i].values.end(), values, values + numRows * columns[i].elementSize);
+            const size_t entryLength = 14 + bytes[entry + 13];
+            entry += entryLength + (8 - entryLength % 8) % 8;
+        }
+    }
+    return rowGroups;
+}
+
+void testExporter()
+{
+    const std::filesystem::path outputDir = std::filesystem::temp_directory_path() / "ExporterColumnarTest";
+    std::filesystem::remove_all(outputDir);
+    std::filesystem::create_directories(outputDir);
+
+    std::vector<uint8_t> stream = makeStream();
+    {
+        ExporterColumnar exporter(Filesystem::FilePath((outputDir.string() + "/").c_str()), false, 4);
+        const ByteBuffer byteBuffer(stream.data(), stream.size(), stream.size());
+        for (size_t index = 0; index < stream.size();)
+        {
+            const auto found = FaPacketProtocol::findPacket(byteBuffer, index);
+            VN_CHECK(found.validity == FaPacketProtocol::Validity::Valid);
+            if (found.validity != FaPacketProtocol::Validity::Valid) { return; }
+            auto putSlot = exporter.getQueuePtr()->put();
+            putSlot->details.syncByte = PacketDetails::SyncByte::FA;
+            putSlot->details.faMetadata = found.metadata;
+            std::memcpy(putSlot->buffer, stream.data() + index, found.metadata.length);
+            putSlot = nullptr;
+            index += found.metadata.length;
+        }
+        exporter.exportToFile();
+    }  // Flushes the partial row groups and closes the files
+
+    size_t numFiles = 0;
+    for (const auto& file : std::filesystem::directory_iterator(outputDir))
+    {
+        ++numFiles;
+        std::vector<ColumnChunk> columns;
+        const std::vector<uint32_t> rowGroups = readColumnarFile(file.path(), columns);
+        if (columns.size() == 4)
+        {  // TimeStartup, then yaw, pitch, roll
+            VN_CHECK((rowGroups == std::vector<uint32_t>{4, 4, 2}));
+            VN_CHECK(columns[0].type == static_cast<uint8_t>(ExporterColumnar::ColumnType::U64) && columns[0].values.size() == numYprPackets * 8);
+            VN_CHECK(columns[1].type == static_cast<uint8_t>(ExporterColumnar::ColumnType::F32) && columns[1].values.size() == numYprPackets * 4);
+            for (size_t row = 0; row < numYprPackets && columns[1].values.size() == numYprPackets * 4; ++row)
+            {
+                float yaw, pitch;
+                std::memcpy(&yaw, &columns[1].values[row * 4], sizeof(yaw));
+                std::memcpy(&pitch, &columns[2].values[row * 4], sizeof(pitch));
+                VN_CHECK(yaw == static_cast<float>(row) && pitch == 1.5f);
+            }
+        }
+        else
+        {
+            VN_CHECK(columns.size() == 1);
+            VN_CHECK((rowGroups == std::vector<uint32_t>{numTimeOnlyPackets}));
+        }
+        // TimeStartup increases within each message type
+        uint64_t previous = 0;
+        for (size_t row = 0; !columns.empty() && row < columns[0].values.size() / 8; ++row)
+        {
+            uint64_t timeStartup;
+            std::memcpy(&timeStartup, &columns[0].values[row * 8], sizeof(timeStartup));
+            VN_CHECK(timeStartup > previous);
+            previous = timeStartup;
+        }
+    }
+    VN_CHECK(numFiles == 2);
+    std::filesystem::remove_all(outputDir);
+}
+
+void testDecoder()
+{
+    const std::vector<uint8_t> stream = makeStream();
+    ColumnarDecoder decoder;
+    VN_CHECK(!decoder.addColumn<uint64_t>(1, 0));  // TimeStartup, output here in the Common group
+    VN_CHECK(!decoder.addColumn<float>(4, 1));     // Ypr
+    VN_CHECK(decoder.addColumn<double>(4, 1));     // Not a multiple of the measurement's size
+    decoder.decode(stream.data(), stream.size());
+
+    VN_CHECK(decoder.numRows() == numYprPackets + numTimeOnlyPackets);
+    const auto* timeStartup = decoder.column(1, 0);
+    const auto* ypr = decoder.column(4, 1);
+    VN_CHECK(timeStartup != nullptr && ypr != nullptr && ypr->numComponents() == 3);
+    if (timeStartup == nullptr || ypr == nullptr) { return; }
+
+    size_t numYpr = 0;
+    for (size_t row = 0; row < decoder.numRows(); ++row)
+    {
+        VN_CHECK(timeStartup->isValid(row) && timeStartup->data<uint64_t>(0)[row] == 1000 + row);
+        VN_CHECK(stream[decoder.rowOffsets()[row]] == 0xFA);
+        if (ypr->isValid(row))
+        {
+            VN_CHECK(ypr->data<float>(0)[row] == static_cast<float>(numYpr) && ypr->data<float>(2)[row] == -2.25f);
+            ++numYpr;
+        }
+        else { VN_CHECK(ypr->data<float>(0)[row] == 0.0f); }
+    }
+    VN_CHECK(numYpr == numYprPackets);
+}
+
+int main()
+{
+    testExporter();
+    testDecoder();
+    return Test::result("ExporterColumnarTest");
+}
@@ -0,0 +1,194 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "Implementation/AsciiPacketProtocol.hpp"
+#include "Implementation/CoreUtils.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "plugins/DataExport/ExporterCsv.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+struct TestPacket
+{
+    PacketDetails details;
+    std::vector<uint8_t> bytes;
+};
+
+void addFa(std::vector<TestPacket>& packets, const std::vector<uint8_t>& bytes)
+{
+    ByteBuffer byteBuffer(bytes.size());
+    byteBuffer.put(bytes.data(), bytes.size());
+    const auto found = FaPacketProtocol::findPacket(byteBuffer, 0);
+    VN_CHECK(found.validity == FaPacketProtocol::Validity::Valid);
+    TestPacket packet;
+    packet.details.syncByte = PacketDetails::SyncByte::FA;
+    packet.details.faMetadata = found.metadata;
+    packet.bytes = bytes;
+    packets.push_back(packet);
+}
+
+void addAsciiYpr(std::vector<TestPacket>& packets, const float yaw)
+{
+    char payload[48];
+    std::snprintf(payload, sizeof(payload), "VNYPR,%+08.3f,+001.500,-002.250", yaw);
+    uint8_t checksum = 0;
+    for (const char* c = payload; *c != '\0'; ++c) { checksum ^= static_cast<uint8_t>(*c); }
+    char text[64];
+    const int length = std::snprintf(text, sizeof(text), "$%s*%02X\r\n", payload, checksum);
+    ByteBuffer byteBuffer(sizeof(text));
+    byteBuffer.put(reinterpret_cast<const uint8_t*>(text), length);
+    const auto found = AsciiPacketProtocol::findPacket(byteBuffer, 0);
+    VN_CHECK(found.validity == AsciiPacketProtocol::Validity::Valid);
+    TestPacket packet;
+    packet.details.syncByte = PacketDetails::SyncByte::Ascii;
+    packet.details.asciiMetadata = found.metadata;
+    packet.bytes.assign(text, text + length);
+    packets.push_back(packet);
+}
+
+/// @brief A Time, IMU and Attitude group packet with pseudo-random payload bytes, so that every float and double takes arbitrary values.
+std::vector<uint8_t> makeMultiGroupPacket(uint32_t& seed)
+{
+    std::vector<uint8_t> bytes{0xFA, 0x16, 0x83, 0x00, 0x14, 0x00, 0x06, 0x00};
+    const size_t payloadLength = 8 + 8 + 4 + 12 + 4 + 12 + 16;
+    for (size_t i = 0; i < payloadLength; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        bytes.push_back(static_cast<uint8_t>(seed >> 16));
+    }
+    const uint16_t crc = CalculateCRC(bytes.data() + 1, bytes.size() - 1);
+    bytes.push_back(static_cast<uint8_t>(crc >> 8));
+    bytes.push_back(static_cast<uint8_t>(crc));
+    return bytes;
+}
+
+/// @brief Interleaves four message types, so that consecutive packets in a chunk go to different files.
+std::vector<TestPacket> makePackets()
+{
+    std::vector<TestPacket> packets;
+    uint32_t seed = 1;
+    for (uint64_t i = 0; i < 1500; ++i)
+    {
+        std::vector<uint8_t> common;
+        switch (i % 5)
+        {
+            case 0:
+            case 1:
+                Test::appendCommonPacket(common, 1000 + i, true, static_cast<float>(i) * 0.37f - 180.0f);
+                addFa(packets, common);
+                break;
+            case 2:
+                Test::appendCommonPacket(common, 1000 + i, false);
+                addFa(packets, common);
+                break;
+            case 3:
+                addFa(packets, makeMultiGroupPacket(seed));
+                break;
+            default:
+                addAsciiYpr(packets, static_cast<float>(i % 360));
+                break;
+        }
+    }
+    return packets;
+}
+
+/// @brief Exports every packet, exporting in batches smaller than the queue so that the queue never overflows.
+void exportPackets(const std::vector<TestPacket>& packets, const std::filesystem::path& outputDir, const uint8_t numFormatWorkers)
+{
+    std::filesystem::remove_all(outputDir);
+    std::filesystem::create_directories(outputDir);
+    // A small file buffer, so that each file is written out in many blocks
+    ExporterCsv exporter(Filesystem::FilePath((outputDir.string() + "/").c_str()), false, CsvNumberFormat::Compatible, 512, numFormatWorkers);
+    size_t numQueued = 0;
+    for (const TestPacket& packet : packets)
+    {
+        auto putSlot = exporter.getQueuePtr()->put();
+        VN_CHECK(putSlot != nullptr);
+        if (!putSlot) { return; }
+        putSlot->details = packet.details;
+        std::memcpy(putSlot->buffer, packet.bytes.data(), packet.bytes.size());
+        putSlot = nullptr;
+        if (++numQueued % 300 == 0) { exporter.exportToFile(); }
+    }
+    exporter.exportToFile();
+}  // Writes out the partial blocks and closes the files
+
+std::vector<uint8_t> readFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+void testWorkersMatchSingleThread()
+{
+    const std::vector<TestPacket> packets = makePackets();
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "ExporterCsvTest";
+    const std::filesystem::path serialDir = root / "serial";
+    exportPackets(packets, serialDir, 0);
+
+    size_t numFiles = 0;
+    for (const auto& file : std::filesystem::directory_iterator(serialDir))
+    {
+        ++numFiles;
+        VN_CHECK(std::filesystem::file_size(file.path()) > 512);
+    }
+    VN_CHECK(numFiles == 4);
+
+    for (const uint8_t numFormatWorkers : {2, 4, 7})
+    {
+        const std::filesystem::path parallelDir = root / ("workers" + std::to_string(numFormatWorkers));
+        exportPackets(packets, parallelDir, numFormatWorkers);
+        size_t numParallelFiles = 0;
+        for (const auto& file : std::filesystem::directory_iterator(parallelDir))
+        {
+            ++numParallelFiles;
+            const std::filesystem::path serialFile = serialDir / file.path().filename();
+            VN_CHECK(std::filesystem::exists(serialFile));
+            const bool identical = readFile(file.path()) == readFile(serialFile);
+            VN_CHECK(identical);
+            if (!identical) { std::cout << file.path() << " differs from the single-threaded export" << std::endl; }
+        }
+        VN_CHECK(numParallelFiles == numFiles);
+    }
+    std::filesystem::remove_all(root);
+}
+
+int main()
+{
+    testWorkersMatchSingleThread();
+    return Test::result("ExporterCsvTest");
+}
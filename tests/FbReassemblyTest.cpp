@@ -0,0 +1,200 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include "Config.hpp"
+#include "Implementation/CoreUtils.hpp"
+#include "Implementation/FaPacketDispatcher.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "Implementation/FbPacketDispatcher.hpp"
+#include "Implementation/PacketSynchronizer.hpp"
+#include "Implementation/QueueDefinitions.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+/// @brief Whether both are absent, or both present with the same bytes.
+template <class T>
+bool sameValue(const std::optional<T>& lhs, const std::optional<T>& rhs)
+{
+    if (lhs.has_value() != rhs.has_value()) { return false; }
+    return !lhs.has_value() || (std::memcmp(&*lhs, &*rhs, sizeof(T)) == 0);
+}
+
+/// @brief A Time, IMU and Attitude group FA packet with pseudo-random payload bytes: TimeStartup, TimeGps and SyncInCnt; UncompAccel and Temperature;
+/// Ypr and Quaternion.
+std::vector<uint8_t> makeFaPacket(const uint32_t seed)
+{
+    std::vector<uint8_t> packet{0xFA, 0x16, 0x83, 0x00, 0x14, 0x00, 0x06, 0x00};
+    const size_t payloadLength = 8 + 8 + 4 + 12 + 4 + 12 + 16;
+    uint32_t value = seed;
+    for (size_t i = 0; i < payloadLength; ++i)
+    {
+        value = value * 1103515245 + 12345;
+        packet.push_back(static_cast<uint8_t>(value >> 16));
+    }
+    const uint16_t crc = CalculateCRC(packet.data() + 1, packet.size() - 1);
+    packet.push_back(static_cast<uint8_t>(crc >> 8));
+    packet.push_back(static_cast<uint8_t>(crc));
+    return packet;
+}
+
+/// @brief Appends the FA packet split into FB packets, as the sensor sends an output too long for one packet. The FA sync byte and CRC are not sent;
+/// the remaining bytes are split into fragments of the passed lengths, the last taking whatever is left. Fragment skipFragment, if any, is not appended.
+void appendFbMessage(std::vector<uint8_t>& stream, const std::vector<uint8_t>& faPacket, const uint8_t messageId, const std::vector<size_t>& fragmentLengths,
+                     const int skipFragment = -1)
+{
+    const uint8_t totalPacketCount = static_cast<uint8_t>(fragmentLengths.size() + 1);
+    size_t offset = 1;
+    const size_t end = faPacket.size() - 2;
+    for (uint8_t fragment = 1; fragment <= totalPacketCount; ++fragment)
+    {
+        const size_t length = (fragment < totalPacketCount) ? fragmentLengths[fragment - 1] : end - offset;
+        std::vector<uint8_t> packet{0xFB, 0x00, messageId, static_cast<uint8_t>((totalPacketCount << 4) | fragment), static_cast<uint8_t>(length),
+                                    static_cast<uint8_t>(length >> 8)};
+        packet.insert(packet.end(), faPacket.begin() + offset, faPacket.begin() + offset + length);
+        const uint16_t crc = CalculateCRC(packet.data() + 1, packet.size() - 1);
+        packet.push_back(static_cast<uint8_t>(crc >> 8));
+        packet.push_back(static_cast<uint8_t>(crc));
+        offset += length;
+        if (fragment != skipFragment) { stream.insert(stream.end(), packet.begin(), packet.end()); }
+    }
+}
+
+/// @brief The FA and FB dispatchers as Sensor sets them up, behind a main byte buffer small enough that fragments wrap its end.
+struct FbDispatch
+{
+    MeasurementQueue measurementQueue{Config::PacketDispatchers::compositeDataQueueCapacity};
+    FaPacketDispatcher faDispatcher{&measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes};
+    FbPacketDispatcher fbDispatcher{&faDispatcher, Config::PacketFinders::fbBufferCapacity};
+    static constexpr size_t readLength = 13;
+    ByteBuffer byteBuffer{97};
+    PacketSynchronizer packetSynchronizer{byteBuffer, nullptr, readLength};
+
+    FbDispatch()
+    {
+        VN_CHECK(!packetSynchronizer.addDispatcher(&faDispatcher));
+        VN_CHECK(!packetSynchronizer.addDispatcher(&fbDispatcher));
+    }
+
+    /// @brief Feeds the stream a few bytes at a time, as reads from the serial port would arrive.
+    void dispatch(const std::vector<uint8_t>& stream)
+    {
+        for (size_t offset = 0; offset < stream.size(); offset += readLength)
+        {
+            const size_t length = std::min(readLength, stream.size() - offset);
+            VN_CHECK(!byteBuffer.put(stream.data() + offset, length));
+            while (!packetSynchronizer.dispatchNextPacket()) {}
+        }
+    }
+};
+
+/// @brief Pops the next measurement and checks it against the generic parse of the FA packet that was split.
+void checkNextMeasurement(MeasurementQueue& measurementQueue, const std::vector<uint8_t>& faPacket)
+{
+    ByteBuffer byteBuffer(faPacket.size());
+    byteBuffer.put(faPacket.data(), faPacket.size());
+    const auto found = FaPacketProtocol::findPacket(byteBuffer, 0);
+    const auto expected = FaPacketProtocol::parsePacket(byteBuffer, 0, found.metadata, Config::PacketDispatchers::cdEnabledMeasTypes);
+    VN_CHECK(expected.has_value());
+
+    const auto measurement = measurementQueue.get();
+    VN_CHECK(measurement != nullptr);
+    if (!measurement || !expected.has_value()) { return; }
+    VN_CHECK(sameValue(measurement->time.timeStartup, expected->time.timeStartup));
+    VN_CHECK(sameValue(measurement->time.timeGps, expected->time.timeGps));
+    VN_CHECK(sameValue(measurement->time.syncInCnt, expected->time.syncInCnt));
+    VN_CHECK(sameValue(measurement->imu.uncompAccel, expected->imu.uncompAccel));
+    VN_CHECK(sameValue(measurement->imu.temperature, expected->imu.temperature));
+    VN_CHECK(sameValue(measurement->attitude.ypr, expected->attitude.ypr));
+    VN_CHECK(sameValue(measurement->attitude.quaternion, expected->attitude.quaternion));
+}
+
+void testReassembly()
+{
+    FbDispatch fb;
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        const std::vector<uint8_t> faPacket = makeFaPacket(i);
+        std::vector<uint8_t> stream;
+        // Vary the split, and so where each fragment falls relative to the end of the main buffer
+        appendFbMessage(stream, faPacket, static_cast<uint8_t>(i), {10 + i, 30 - i});
+        fb.dispatch(stream);
+        checkNextMeasurement(fb.measurementQueue, faPacket);
+        VN_CHECK(fb.measurementQueue.isEmpty());
+    }
+    VN_CHECK(fb.packetSynchronizer.getValidPacketCount(PacketSynchronizer::SyncBytes{0xFB}) == 16 * 3);
+}
+
+void testSingleFragment()
+{
+    FbDispatch fb;
+    const std::vector<uint8_t> faPacket = makeFaPacket(99);
+    std::vector<uint8_t> stream;
+    appendFbMessage(stream, faPacket, 0, {});
+    fb.dispatch(stream);
+    checkNextMeasurement(fb.measurementQueue, faPacket);
+}
+
+void testIncompleteMessagesAreDropped()
+{
+    FbDispatch fb;
+    std::vector<uint8_t> stream;
+    appendFbMessage(stream, makeFaPacket(1), 1, {20, 20}, 2);  // Missing its middle fragment
+    appendFbMessage(stream, makeFaPacket(2), 2, {20, 20}, 3);  // Missing its last fragment, so never completed
+    const std::vector<uint8_t> complete = makeFaPacket(3);
+    appendFbMessage(stream, complete, 3, {20, 20});
+
+    // Another message's fragment in place of the middle one drops the message, although the bytes would add up to a packet of the right length
+    std::vector<uint8_t> interrupted;
+    appendFbMessage(interrupted, makeFaPacket(4), 4, {20, 20});
+    std::vector<uint8_t> other;
+    appendFbMessage(other, makeFaPacket(5), 5, {20, 20});
+    const size_t fragmentLength = 1 + 5 + 20 + 2;
+    stream.insert(stream.end(), interrupted.begin(), interrupted.begin() + fragmentLength);
+    stream.insert(stream.end(), other.begin() + fragmentLength, other.begin() + 2 * fragmentLength);
+    stream.insert(stream.end(), interrupted.begin() + 2 * fragmentLength, interrupted.end());
+
+    const std::vector<uint8_t> last = makeFaPacket(6);
+    appendFbMessage(stream, last, 6, {20, 20});
+    fb.dispatch(stream);
+
+    checkNextMeasurement(fb.measurementQueue, complete);
+    checkNextMeasurement(fb.measurementQueue, last);
+    VN_CHECK(fb.measurementQueue.isEmpty());
+}
+
+int main()
+{
+    testReassembly();
+    testSingleFragment();
+    testIncompleteMessagesAreDropped();
+    return Test::result("FbReassemblyTest");
+}
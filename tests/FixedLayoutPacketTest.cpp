@@ -0,0 +1,187 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include "Config.hpp"
+#include "Implementation/CoreUtils.hpp"
+#include "Implementation/FaPacketDispatcher.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "Implementation/QueueDefinitions.hpp"
+#include "Interface/FixedLayoutPacket.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+#include "TemplateLibrary/DirectAccessQueue.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+constexpr FixedLayoutSpec spec{0,
+                               TIME_TIMESTARTUP_BIT | TIME_TIMEGPS_BIT | TIME_SYNCINCNT_BIT,
+                               IMU_UNCOMPACCEL_BIT | IMU_TEMPERATURE_BIT,
+                               0,
+                               ATTITUDE_YPR_BIT | ATTITUDE_QUATERNION_BIT};
+using SpecPacket = FixedLayoutPacket<spec>;
+using SpecFastPath = FixedLayoutFastPath<spec>;
+
+/// @brief Appends a packet of the spec's output with pseudo-random payload bytes, so that every float takes arbitrary values.
+void appendSpecPacket(std::vector<uint8_t>& stream, const uint32_t seed)
+{
+    const size_t packetIndex = stream.size();
+    stream.insert(stream.end(), {0xFA, 0x16, 0x83, 0x00, 0x14, 0x00, 0x06, 0x00});
+    const size_t payloadLength = 8 + 8 + 4 + 12 + 4 + 12 + 16;
+    uint32_t value = seed;
+    for (size_t i = 0; i < payloadLength; ++i)
+    {
+        value = value * 1103515245 + 12345;
+        stream.push_back(static_cast<uint8_t>(value >> 16));
+    }
+    const uint16_t crc = CalculateCRC(stream.data() + packetIndex + 1, stream.size() - packetIndex - 1);
+    stream.push_back(static_cast<uint8_t>(crc >> 8));
+    stream.push_back(static_cast<uint8_t>(crc));
+}
+
+/// @brief Whether the fast path's value has the same bytes as the generic parser's.
+template <class T, class U>
+bool sameValue(const T& fast, const std::optional<U>& parsed)
+{
+    static_assert(sizeof(T) == sizeof(U), "Compared measurements must be the same size.");
+    return parsed.has_value() && (std::memcmp(&fast, &*parsed, sizeof(T)) == 0);
+}
+
+/// @brief Checks every measurement read from its fixed offset against the CompositeData the generic parser makes of the same bytes.
+void checkMatchesGenericParse(const SpecPacket& packet)
+{
+    const ByteBuffer byteBuffer(const_cast<uint8_t*>(packet.data()), SpecPacket::length, SpecPacket::length);
+    const auto found = FaPacketProtocol::findPacket(byteBuffer, 0);
+    VN_CHECK(found.validity == FaPacketProtocol::Validity::Valid);
+    const auto parsed = FaPacketProtocol::parsePacket(byteBuffer, 0, found.metadata, Config::PacketDispatchers::cdEnabledMeasTypes);
+    VN_CHECK(parsed.has_value());
+    if (!parsed.has_value()) { return; }
+
+    VN_CHECK((sameValue(packet.get<uint64_t, 1, 0>(), parsed->time.timeStartup)));
+    VN_CHECK((sameValue(packet.get<uint64_t, 1, 1>(), parsed->time.timeGps)));
+    VN_CHECK((sameValue(packet.get<uint32_t, 1, 7>(), parsed->time.syncInCnt)));
+    VN_CHECK((sameValue(packet.get<Vec3f, 2, 2>(), parsed->imu.uncompAccel)));
+    VN_CHECK((sameValue(packet.get<float, 2, 4>(), parsed->imu.temperature)));
+    VN_CHECK((sameValue(packet.get<Ypr, 4, 1>(), parsed->attitude.ypr)));
+    VN_CHECK((sameValue(packet.get<Quat, 4, 2>(), parsed->attitude.quaternion)));
+}
+
+void testLayout()
+{
+    static_assert(SpecPacket::headerLength == 8);
+    static_assert(SpecPacket::length == 8 + 8 + 8 + 4 + 12 + 4 + 12 + 16 + 2);
+    static_assert(SpecPacket::offsetOf(1, 0) == 8);
+    static_assert(SpecPacket::offsetOf(2, 2) == 8 + 8 + 8 + 4);
+    static_assert(SpecPacket::offsetOf(4, 2) == SpecPacket::length - 2 - 16);
+    static_assert(SpecPacket::offsetOf(0, 0) == 0);
+
+    std::vector<uint8_t> stream;
+    appendSpecPacket(stream, 0);
+    VN_CHECK(stream.size() == SpecPacket::length);
+    VN_CHECK(SpecPacket::matchesHeader(stream.data()));
+
+    ByteBuffer byteBuffer(stream.size());
+    byteBuffer.put(stream.data(), stream.size());
+    VN_CHECK(SpecPacket::binaryHeader() == FaPacketProtocol::findPacket(byteBuffer, 0).metadata.header);
+}
+
+/// @brief Dispatches spec packets interleaved with Common group packets through a byte buffer small enough that packets wrap its end.
+void testFastPathMatchesGenericParse()
+{
+    MeasurementQueue measurementQueue{Config::PacketDispatchers::compositeDataQueueCapacity};
+    FaPacketDispatcher dispatcher(&measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes);
+    DirectAccessQueue<SpecPacket, 8> fastQueue{};
+    SpecFastPath fastPath(&fastQueue);
+    dispatcher.registerFastPath(&fastPath);
+
+    ByteBuffer byteBuffer(SpecPacket::length * 2 + 7);
+    size_t numWrapped = 0;
+    for (uint32_t i = 0; i < 20; ++i)
+    {
+        std::vector<uint8_t> stream;
+        appendSpecPacket(stream, i);
+        Test::appendCommonPacket(stream, 1000 * (i + 1), true, static_cast<float>(i));
+        byteBuffer.put(stream.data(), stream.size());
+        if (byteBuffer.numLinearBytes() < SpecPacket::length) { ++numWrapped; }
+
+        for (int packetIndex = 0; packetIndex < 2; ++packetIndex)
+        {
+            const auto found = dispatcher.findPacket(byteBuffer, 0);
+            VN_CHECK(found.validity == PacketDispatcher::FindPacketRetVal::Validity::Valid);
+            if (found.validity != PacketDispatcher::FindPacketRetVal::Validity::Valid) { return; }
+            dispatcher.dispatchPacket(byteBuffer, 0);
+            byteBuffer.discard(found.length);
+        }
+
+        auto fastPacket = fastQueue.get();
+        VN_CHECK(fastPacket != nullptr);
+        if (fastPacket)
+        {
+            VN_CHECK(std::memcmp(fastPacket->data(), stream.data(), SpecPacket::length) == 0);
+            checkMatchesGenericParse(*fastPacket);
+        }
+        fastPacket = nullptr;
+
+        // Only the other output reaches the measurement queue
+        const auto compositeData = measurementQueue.get();
+        VN_CHECK(compositeData != nullptr);
+        VN_CHECK(compositeData && compositeData->time.timeStartup.has_value() && compositeData->time.timeStartup->nanoseconds() == 1000 * (i + 1));
+        VN_CHECK(measurementQueue.isEmpty() && fastQueue.isEmpty());
+    }
+    VN_CHECK(numWrapped > 0);
+}
+
+void testCorruptPacketIsNotFastPathed()
+{
+    MeasurementQueue measurementQueue{Config::PacketDispatchers::compositeDataQueueCapacity};
+    FaPacketDispatcher dispatcher(&measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes);
+    DirectAccessQueue<SpecPacket, 8> fastQueue{};
+    SpecFastPath fastPath(&fastQueue);
+    dispatcher.registerFastPath(&fastPath);
+
+    std::vector<uint8_t> stream;
+    appendSpecPacket(stream, 3);
+    stream[20] ^= 0x01;
+    ByteBuffer byteBuffer(stream.size());
+    byteBuffer.put(stream.data(), stream.size());
+    VN_CHECK(!fastPath.matches(byteBuffer, 0));
+    VN_CHECK(dispatcher.findPacket(byteBuffer, 0).validity == PacketDispatcher::FindPacketRetVal::Validity::Invalid);
+    VN_CHECK(fastQueue.isEmpty());
+
+    SpecPacket packet;
+    VN_CHECK(packet.populate(stream.data(), now()));
+}
+
+int main()
+{
+    testLayout();
+    testFastPathMatchesGenericParse();
+    testCorruptPacketIsNotFastPathed();
+    return Test::result("FixedLayoutPacketTest");
+}
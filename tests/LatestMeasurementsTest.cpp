@@ -0,0 +1,194 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "Config.hpp"
+#include "Implementation/AsciiPacketProtocol.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "Implementation/LatestMeasurements.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+#include "TemplateLibrary/SeqLock.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+/// @brief Publishes one Common group FA packet, framed by the generic finder as the dispatcher would.
+void publishFa(LatestMeasurements& latest, const uint64_t timeStartup, const bool withYpr, const float yaw = 0)
+{
+    std::vector<uint8_t> packet;
+    Test::appendCommonPacket(packet, timeStartup, withYpr, yaw);
+    ByteBuffer byteBuffer(packet.size());
+    byteBuffer.put(packet.data(), packet.size());
+    const FaPacketProtocol::FindPacketReturn found = FaPacketProtocol::findPacket(byteBuffer, 0);
+    VN_CHECK(found.validity == FaPacketProtocol::Validity::Valid);
+    latest.publish(byteBuffer, 0, found.metadata);
+}
+
+void publishAsciiYpr(LatestMeasurements& latest, const char* payload)
+{
+    char packet[64];
+    uint8_t checksum = 0;
+    for (const char* c = payload; *c != '\0'; ++c) { checksum ^= static_cast<uint8_t>(*c); }
+    const int length = std::snprintf(packet, sizeof(packet), "$%s*%02X\r\n", payload, checksum);
+    ByteBuffer byteBuffer(sizeof(packet));
+    byteBuffer.put(reinterpret_cast<const uint8_t*>(packet), length);
+    const AsciiPacketProtocol::FindPacketReturn found = AsciiPacketProtocol::findPacket(byteBuffer, 0);
+    VN_CHECK(found.validity == AsciiPacketProtocol::Validity::Valid);
+    latest.publish(byteBuffer, 0, found.metadata, AsciiPacketProtocol::getMeasHeader(found.metadata.header));
+}
+
+void testEmpty()
+{
+    LatestMeasurements latest;
+    VN_CHECK(latest.version() == 0);
+    VN_CHECK(!latest.measurement().has_value());
+    VN_CHECK(!latest.time().has_value());
+    VN_CHECK(!latest.attitude().has_value());
+}
+
+void testGroupsKeepTheirLastSample()
+{
+    LatestMeasurements latest;
+    publishFa(latest, 1000, true, 10.0f);
+    VN_CHECK(latest.version() == 1);
+    publishFa(latest, 2000, false);  // TimeStartup only, which must not clear the attitude
+    VN_CHECK(latest.version() == 2);
+
+    const auto measurement = latest.measurement();
+    VN_CHECK(measurement.has_value() && measurement->time.timeStartup.has_value() && measurement->time.timeStartup->nanoseconds() == 2000);
+    VN_CHECK(measurement.has_value() && !measurement->attitude.ypr.has_value());
+
+    const auto time = latest.time();
+    VN_CHECK(time.has_value() && time->group.timeStartup->nanoseconds() == 2000);
+    const auto attitude = latest.attitude();
+    VN_CHECK(attitude.has_value() && attitude->group.ypr.has_value() && attitude->group.ypr->yaw == 10.0f && attitude->group.ypr->roll == -2.25f);
+    VN_CHECK(attitude.has_value() && time.has_value() && attitude->timestamp <= time->timestamp);
+}
+
+void testAscii()
+{
+    LatestMeasurements latest;
+    publishFa(latest, 1000, true, 10.0f);
+    publishAsciiYpr(latest, "VNYPR,+020.000,+001.500,-002.250");
+    const auto attitude = latest.attitude();
+    VN_CHECK(attitude.has_value() && attitude->group.ypr.has_value() && attitude->group.ypr->yaw == 20.0f);
+    const auto time = latest.time();
+    VN_CHECK(time.has_value() && time->group.timeStartup->nanoseconds() == 1000);  // YPR carries no time
+}
+
+void testTooLongIsNotPublished()
+{
+    // Only the length is looked at before the packet is dropped
+    const std::vector<uint8_t> packet(LatestMeasurements::packetMaxLength + 1, 0);
+    ByteBuffer byteBuffer(packet.size());
+    byteBuffer.put(packet.data(), packet.size());
+    FaPacketProtocol::Metadata metadata;
+    metadata.length = packet.size();
+    LatestMeasurements latest;
+    latest.publish(byteBuffer, 0, metadata);
+    VN_CHECK(latest.version() == 0);
+}
+
+#if (THREADING_ENABLE)
+void testSeqLockReadsAreNeverTorn()
+{
+    // Every word of a store holds the same value, and the value is large enough that a copy overlapping a store would mix two of them
+    using Value = std::array<uint32_t, 1024>;
+    SeqLock<Value> slot;
+    std::atomic<bool> done = false;
+    std::thread writer([&] {
+        Value value;
+        for (uint32_t i = 1; !done; ++i)
+        {
+            value.fill(i);
+            slot.store(value);
+        }
+    });
+    uint32_t numTorn = 0;
+    for (uint32_t numReads = 0; numReads < 100000; ++numReads)
+    {
+        const Value value = slot.load();
+        for (const uint32_t word : value)
+        {
+            if (word != value[0])
+            {
+                ++numTorn;
+                break;
+            }
+        }
+    }
+    done = true;
+    writer.join();
+    VN_CHECK(numTorn == 0);
+    VN_CHECK(slot.version() > 0);
+}
+
+void testReadsAreNeverTorn()
+{
+    // Each packet's startup time matches its yaw, so a read mixing two packets shows up as a mismatch
+    LatestMeasurements latest;
+    std::atomic<bool> done = false;
+    std::thread writer([&] {
+        for (uint32_t i = 1; i <= 20000; ++i) { publishFa(latest, i, true, static_cast<float>(i)); }
+        done = true;
+    });
+    uint32_t numReads = 0;
+    uint32_t numTorn = 0;
+    while (!done)
+    {
+        const auto measurement = latest.measurement();
+        if (!measurement.has_value()) { continue; }
+        ++numReads;
+        if (!measurement->time.timeStartup.has_value() || !measurement->attitude.ypr.has_value() ||
+            static_cast<float>(measurement->time.timeStartup->nanoseconds()) != measurement->attitude.ypr->yaw)
+        {
+            ++numTorn;
+        }
+    }
+    writer.join();
+    VN_CHECK(numReads > 0);
+    VN_CHECK(numTorn == 0);
+    VN_CHECK(latest.version() == 20000);
+}
+#endif
+
+int main()
+{
+    testEmpty();
+    testGroupsKeepTheirLastSample();
+    testAscii();
+    testTooLongIsNotPublished();
+#if (THREADING_ENABLE)
+    testSeqLockReadsAreNeverTorn();
+    testReadsAreNeverTorn();
+#endif
+    return Test::result("LatestMeasurementsTest");
+}
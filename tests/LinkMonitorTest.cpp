@@ -0,0 +1,129 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Config.hpp"
+#include "Implementation/CoreUtils.hpp"
+#include "Implementation/FaPacketDispatcher.hpp"
+#include "Implementation/LinkMonitor.hpp"
+#include "Implementation/PacketSynchronizer.hpp"
+#include "Implementation/QueueDefinitions.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+/// @brief Frames and dispatches one packet, as the PacketSynchronizer would, discarding the measurement it produces.
+void dispatch(FaPacketDispatcher& dispatcher, MeasurementQueue& measurementQueue, const std::vector<uint8_t>& packet)
+{
+    ByteBuffer byteBuffer(packet.size());
+    byteBuffer.put(packet.data(), packet.size());
+    const auto found = dispatcher.findPacket(byteBuffer, 0);
+    VN_CHECK(found.validity == PacketDispatcher::FindPacketRetVal::Validity::Valid);
+    if (found.validity != PacketDispatcher::FindPacketRetVal::Validity::Valid) { return; }
+    dispatcher.dispatchPacket(byteBuffer, 0);
+    while (measurementQueue.get() != nullptr) {}
+}
+
+/// @brief A packet of zeroed fields totalling prefixLength bytes followed by a 4 byte count, which is SyncOutCnt if the types include it.
+std::vector<uint8_t> makeCountPacket(const uint8_t groups, const std::vector<uint16_t>& types, const size_t prefixLength, const uint32_t count)
+{
+    std::vector<uint8_t> packet{0xFA, groups};
+    for (const uint16_t type : types)
+    {
+        packet.push_back(static_cast<uint8_t>(type));
+        packet.push_back(static_cast<uint8_t>(type >> 8));
+    }
+    packet.insert(packet.end(), prefixLength, 0);
+    for (size_t i = 0; i < sizeof(count); ++i) { packet.push_back(static_cast<uint8_t>(count >> (8 * i))); }
+    const uint16_t crc = CalculateCRC(packet.data() + 1, packet.size() - 1);
+    packet.push_back(static_cast<uint8_t>(crc >> 8));
+    packet.push_back(static_cast<uint8_t>(crc));
+    return packet;
+}
+
+void testMissedPackets()
+{
+    MeasurementQueue measurementQueue{Config::PacketDispatchers::compositeDataQueueCapacity};
+    FaPacketDispatcher dispatcher(&measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes);
+    LinkMonitor linkMonitor;
+    dispatcher.setLinkMonitor(&linkMonitor);
+
+    // TimeStartup every 1000 ns, with 2 and then 2 more packets lost, then a restart which must not count as a gap
+    for (const uint64_t timeStartup : {1000, 2000, 3000, 4000, 7000, 8000, 9000, 12000, 500, 1500, 2500})
+    {
+        std::vector<uint8_t> packet;
+        Test::appendCommonPacket(packet, timeStartup, false);
+        dispatch(dispatcher, measurementQueue, packet);
+    }
+
+    // Time group TimeGps and SyncOutCnt, with 2 and then 1 packet lost. SyncOut triggering less often than the output repeats a count, which is neither
+    // a gap nor a restart.
+    for (const uint32_t syncOutCnt : {10, 11, 12, 15, 16, 16, 18, 19, 19, 20})
+    {
+        dispatch(dispatcher, measurementQueue, makeCountPacket(0x02, {0x0102}, 8, syncOutCnt));
+    }
+
+    // Common group YPR and Time group SyncOutCnt, with 1 packet lost
+    for (const uint32_t syncOutCnt : {1, 2, 3, 4, 6, 7})
+    {
+        dispatch(dispatcher, measurementQueue, makeCountPacket(0x03, {0x0008, 0x0100}, 12, syncOutCnt));
+    }
+
+    // A Time group output of SyncInCnt alone, which has the same size as SyncOutCnt, is counted but never checked for gaps
+    for (const uint32_t syncInCnt : {1, 5, 9})
+    {
+        dispatch(dispatcher, measurementQueue, makeCountPacket(0x02, {0x0080}, 0, syncInCnt));
+    }
+
+    ByteBuffer byteBuffer(16);
+    PacketSynchronizer packetSynchronizer(byteBuffer);
+    linkMonitor.update(packetSynchronizer, 0, 0);
+    const LinkStats stats = linkMonitor.stats();
+
+    VN_CHECK(stats.missedFaPackets == 8);
+    VN_CHECK(stats.messageTypes.size() == 4);
+    if (stats.messageTypes.size() != 4) { return; }
+    VN_CHECK(stats.messageTypes[0].packets == 11);
+    VN_CHECK(stats.messageTypes[0].missedPackets == 4);
+    VN_CHECK(stats.messageTypes[1].packets == 10);
+    VN_CHECK(stats.messageTypes[1].missedPackets == 3);
+    VN_CHECK(stats.messageTypes[2].packets == 6);
+    VN_CHECK(stats.messageTypes[2].missedPackets == 1);
+    VN_CHECK(stats.messageTypes[3].packets == 3);
+    VN_CHECK(stats.messageTypes[3].missedPackets == 0);
+
+    linkMonitor.reset();
+    VN_CHECK(linkMonitor.stats().missedFaPackets == 0);
+}
+
+int main()
+{
+    testMissedPackets();
+    return Test::result("LinkMonitorTest");
+}
@@ -0,0 +1,157 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "Config.hpp"
+#include "plugins/SimpleLogger/LogIndex.hpp"
+#if (THREADING_ENABLE)
+#include "plugins/DataExport/FileExporter.hpp"
+#endif
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+constexpr size_t numPackets = 100;
+constexpr size_t packetLength = 26;          // Common group TimeStartup and Ypr
+constexpr uint64_t packetPeriod = 2500000;   // ns of startup time between packets
+constexpr uint64_t firstTimeStartup = 5000000000;
+constexpr Microseconds indexInterval = 10ms;  // An entry every four packets
+constexpr size_t packetsPerEntry = 4;
+
+uint64_t timeStartupOf(const size_t packet) { return firstTimeStartup + packet * packetPeriod; }
+
+/// @brief Packets whose startup time steps by packetPeriod, then restarts from zero for the second half if withRestart.
+std::vector<uint8_t> makeLog(const bool withRestart)
+{
+    std::vector<uint8_t> log;
+    for (size_t i = 0; i < numPackets; ++i)
+    {
+        const uint64_t timeStartup = (withRestart && i >= numPackets / 2) ? (i - numPackets / 2) * packetPeriod : timeStartupOf(i);
+        Test::appendCommonPacket(log, timeStartup, true, static_cast<float>(i));
+    }
+    return log;
+}
+
+/// @brief Writes the log's index as SimpleLogger would, in chunks which split packets, all taken at the same host time so only startup time spaces the
+/// entries.
+void writeIndex(const std::vector<uint8_t>& log, const Filesystem::FilePath& logPath)
+{
+    LogIndexWriter writer(logIndexPath(logPath), indexInterval);
+    VN_CHECK(writer.is_open());
+    const time_point hostTime = now();
+    for (size_t i = 0; i < log.size(); i += 7) { writer.consume(log.data() + i, std::min<size_t>(7, log.size() - i), hostTime); }
+}
+
+void testEntries(const std::filesystem::path& directory)
+{
+    const std::vector<uint8_t> log = makeLog(false);
+    const Filesystem::FilePath logPath((directory / "entries.bin").string().c_str());
+    writeIndex(log, logPath);
+
+    LogIndex index;
+    VN_CHECK(!index.load(logIndexPath(logPath)));
+    VN_CHECK(index.entries().size() == numPackets / packetsPerEntry);
+    for (size_t i = 0; i < index.entries().size(); ++i)
+    {
+        const LogIndexEntry& entry = index.entries()[i];
+        VN_CHECK(entry.packetNumber == i * packetsPerEntry);
+        VN_CHECK(entry.byteOffset == entry.packetNumber * packetLength && log[entry.byteOffset] == 0xFA);
+        VN_CHECK(entry.timeStartup == timeStartupOf(entry.packetNumber));
+        VN_CHECK(entry.timeGps == LogIndexEntry::unknown);
+    }
+
+    // Widened to the entries either side, so the range holds every packet asked for and at most one interval more at each end
+    const size_t firstPacket = 21;
+    const size_t lastPacket = 58;
+    const auto [firstByte, lastByte] = index.byteRange(LogTimeBase::Startup, timeStartupOf(firstPacket), timeStartupOf(lastPacket));
+    VN_CHECK(firstByte <= firstPacket * packetLength && firstByte + packetsPerEntry * packetLength > firstPacket * packetLength);
+    VN_CHECK(lastByte >= (lastPacket + 1) * packetLength && lastByte <= (lastPacket + 1 + packetsPerEntry) * packetLength);
+
+    const auto [beforeFirst, beforeLast] = index.byteRange(LogTimeBase::Startup, 0, 1);
+    VN_CHECK(beforeFirst == 0 && beforeLast == 0);
+    const auto [afterFirst, afterLast] = index.byteRange(LogTimeBase::Startup, timeStartupOf(numPackets), timeStartupOf(numPackets + 10));
+    VN_CHECK(afterFirst == index.entries().back().byteOffset && afterLast == LogIndexEntry::unknown);
+    const auto [gpsFirst, gpsLast] = index.byteRange(LogTimeBase::Gps, 0, LogIndexEntry::unknown - 1);  // Not in this log, so the whole of it
+    VN_CHECK(gpsFirst == 0 && gpsLast == LogIndexEntry::unknown);
+
+    VN_CHECK(index.load(Filesystem::FilePath((directory / "missing.bin.idx").string().c_str())));
+}
+
+void testRestart(const std::filesystem::path& directory)
+{
+    const std::vector<uint8_t> log = makeLog(true);
+    const Filesystem::FilePath logPath((directory / "restart.bin").string().c_str());
+    writeIndex(log, logPath);
+
+    LogIndex index;
+    VN_CHECK(!index.load(logIndexPath(logPath)));
+    // The restart itself gets an entry, so the second run is indexed from its first packet
+    bool hasRestartEntry = false;
+    for (const auto& entry : index.entries()) { hasRestartEntry |= (entry.packetNumber == numPackets / 2 && entry.timeStartup == 0); }
+    VN_CHECK(hasRestartEntry);
+
+    // Only the latest run is searchable by startup time
+    const auto [firstByte, lastByte] = index.byteRange(LogTimeBase::Startup, 0, packetPeriod);
+    VN_CHECK(firstByte == (numPackets / 2) * packetLength);
+    VN_CHECK(lastByte > firstByte && lastByte <= (numPackets / 2 + packetsPerEntry) * packetLength);
+}
+
+#if (THREADING_ENABLE)
+void testFileExporterRange(const std::filesystem::path& directory)
+{
+    const std::vector<uint8_t> log = makeLog(false);
+    const std::filesystem::path path = directory / "export.bin";
+    std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(log.data()), log.size());
+    const Filesystem::FilePath logPath(path.string().c_str());
+    writeIndex(log, logPath);
+
+    const size_t firstPacket = 40;
+    const size_t lastPacket = 49;
+    FileExporter fileExporter;
+    VN_CHECK(!fileExporter.processFile(logPath, LogTimeBase::Startup, timeStartupOf(firstPacket), timeStartupOf(lastPacket)));
+    const uint64_t numExported = fileExporter.getParsingStats().validFaPacketCount;
+    VN_CHECK(numExported >= lastPacket - firstPacket + 1 && numExported <= lastPacket - firstPacket + 1 + 2 * packetsPerEntry);
+    VN_CHECK(fileExporter.getParsingStats().invalidFaPacketCount == 0);
+}
+#endif
+
+int main()
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "LogIndexTest";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    testEntries(directory);
+    testRestart(directory);
+#if (THREADING_ENABLE)
+    testFileExporterRange(directory);
+#endif
+
+    std::filesystem::remove_all(directory);
+    return Test::result("LogIndexTest");
+}
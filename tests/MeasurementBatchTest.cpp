@@ -0,0 +1,172 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include "Config.hpp"
+#include "Interface/Sensor.hpp"
+#include "TemplateLibrary/DirectAccessQueue.hpp"
+#include "plugins/LogReplay/SerialReplay.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+using namespace std::chrono_literals;
+
+using IntQueue = DirectAccessQueue<int, 8>;
+
+void putValue(IntQueue& queue, const int value)
+{
+    auto slot = queue.put();
+    VN_CHECK(slot != nullptr);
+    if (slot) { *slot = value; }
+}
+
+/// @brief Pops with getMany and checks the values popped, in order, then releases them.
+void checkGetMany(IntQueue& queue, const uint16_t maxCount, const std::vector<int>& expected)
+{
+    IntQueue::OwningPtr items[8];
+    const uint16_t numPopped = queue.getMany(items, maxCount);
+    VN_CHECK(numPopped == expected.size());
+    for (uint16_t i = 0; i < numPopped && i < expected.size(); ++i) { VN_CHECK(*items[i] == expected[i]); }
+}
+
+void testBatchesKeepOrder()
+{
+    IntQueue queue{};
+    for (int i = 0; i < 5; ++i) { putValue(queue, i); }
+    checkGetMany(queue, 3, {0, 1, 2});
+    checkGetMany(queue, 8, {3, 4});  // A partial batch once the queue empties
+    checkGetMany(queue, 8, {});
+    VN_CHECK(queue.isEmpty());
+
+    // Popped slots are reused as the circular buffer wraps, and order is kept across the wrap
+    int next = 0;
+    for (int round = 0; round < 10; ++round)
+    {
+        for (int i = 0; i < 5; ++i) { putValue(queue, next + i); }
+        checkGetMany(queue, 2, {next, next + 1});
+        VN_CHECK(*queue.get() == next + 2);
+        checkGetMany(queue, 8, {next + 3, next + 4});
+        next += 5;
+    }
+}
+
+void testBatchStopsAtItemBeingPut()
+{
+    IntQueue queue{};
+    putValue(queue, 0);
+    auto slot = queue.put();
+    putValue(queue, 2);
+    checkGetMany(queue, 8, {0});  // Later items wait behind the one still being put
+    *slot = 1;
+    slot = nullptr;
+    checkGetMany(queue, 8, {1, 2});
+}
+
+/// @brief Writes a raw log of Common group packets, with TimeStartup counting up from 1000.
+std::filesystem::path writeLog(const char* name, const int numPackets)
+{
+    std::vector<uint8_t> bytes;
+    for (int i = 0; i < numPackets; ++i) { Test::appendCommonPacket(bytes, 1000 + i, true, static_cast<float>(i)); }
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    return path;
+}
+
+/// @brief Moves replayed bytes through the pipeline, as the listening thread does when threaded.
+void pump(Sensor& sensor)
+{
+#if (THREADING_ENABLE)
+    (void)sensor;
+    std::this_thread::sleep_for(1ms);
+#else
+    sensor.loadMainBufferFromSerial();
+    while (!sensor.processNextPacket()) {}
+#endif
+}
+
+void testSensorBatches()
+{
+    // Fewer packets than the measurement queue holds, so none are dropped however the listening thread is scheduled
+    constexpr int numPackets = Config::PacketDispatchers::compositeDataQueueCapacity - 3;
+    const std::filesystem::path logPath = writeLog("MeasurementBatchTest.bin", numPackets);
+
+    Sensor sensor;
+    SerialReplay* replay = sensor.useSerial<SerialReplay>(Filesystem::FilePath(logPath.string().c_str()), SerialReplay::Pacing::Unpaced);
+    VN_CHECK(replay != nullptr);
+    if (!replay) { return; }
+
+    // getMeasurements pops at most the count asked for, oldest first
+    VN_CHECK(sensor.connect("Replay", Sensor::BaudRate::Baud921600) == Error::None);
+    Sensor::CompositeDataQueueReturn batch[4];
+    int numReceived = 0;
+    for (const auto deadline = now() + 2s; numReceived < numPackets && now() < deadline;)
+    {
+        pump(sensor);
+        const size_t numPopped = sensor.getMeasurements(batch, 4);
+        VN_CHECK(numPopped <= 4);
+        for (size_t i = 0; i < numPopped; ++i)
+        {
+            VN_CHECK(batch[i]->time.timeStartup.has_value() && batch[i]->time.timeStartup->nanoseconds() == static_cast<uint64_t>(1000 + numReceived));
+            batch[i] = nullptr;
+            ++numReceived;
+        }
+    }
+    VN_CHECK(numReceived == numPackets);
+    sensor.disconnect();
+
+    // drainMeasurements hands every queued measurement to the callback in order, returning once a batch comes up short
+    VN_CHECK(sensor.connect("Replay", Sensor::BaudRate::Baud921600) == Error::None);  // Replays from the start
+    numReceived = 0;
+    for (const auto deadline = now() + 2s; numReceived < numPackets && now() < deadline;)
+    {
+        pump(sensor);
+        const size_t numDrained = sensor.drainMeasurements(
+            [&numReceived](const CompositeData& measurement)
+            {
+                VN_CHECK(measurement.time.timeStartup.has_value() && measurement.time.timeStartup->nanoseconds() == static_cast<uint64_t>(1000 + numReceived));
+                ++numReceived;
+            });
+        VN_CHECK(numDrained <= static_cast<size_t>(numPackets));
+    }
+    VN_CHECK(numReceived == numPackets);
+    VN_CHECK(sensor.drainMeasurements([](const CompositeData&) {}) == 0);
+    sensor.disconnect();
+    std::filesystem::remove(logPath);
+}
+
+int main()
+{
+    testBatchesKeepOrder();
+    testBatchStopsAtItemBeingPut();
+    testSensorBatches();
+    return Test::result("MeasurementBatchTest");
+}
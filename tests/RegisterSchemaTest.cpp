@@ -0,0 +1,258 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "Interface/RegisterSchema.hpp"
+#include "Interface/RegisterSchemas.hpp"
+#include "Interface/Registers.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+using Registers::Schema::FieldKind;
+
+/// @brief Stores value with its object representation, as Schema::parse does. Only the branch for the field's own kind reaches a matching size.
+template <class T, class MemberType>
+void store(MemberType& member, const T value)
+{
+    if constexpr (sizeof(T) == sizeof(MemberType)) { std::memcpy(&member, &value, sizeof(T)); }
+}
+
+/// @brief Sets a field to a value which formats without loss: a float with few decimal places, or an integer within the field's range.
+template <class MemberType, class Field>
+void fillField(MemberType& member, const Field& field, const size_t index)
+{
+    if constexpr (std::is_same_v<MemberType, AsciiMessage>) { member = AsciiMessage(("tag" + std::to_string(index)).c_str()); }
+    else
+    {
+        const bool isRanged = field.range.max != Registers::Schema::FieldRange{}.max;
+        switch (field.kind)
+        {
+            case FieldKind::Float:
+                store(member, static_cast<float>(1.25 * (index + 1)));
+                break;
+            case FieldKind::Double:
+                store(member, -2.5 * (index + 1));
+                break;
+            case FieldKind::Uint8:
+                store(member, static_cast<uint8_t>(isRanged ? field.range.max : index + 1));
+                break;
+            case FieldKind::Uint16:
+                store(member, static_cast<uint16_t>(isRanged ? field.range.max : index + 1));
+                break;
+            case FieldKind::Uint32:
+                store(member, static_cast<uint32_t>(isRanged ? field.range.max : 70000 + index));
+                break;
+            case FieldKind::Int32:
+                store(member, static_cast<int32_t>(-1 - static_cast<int32_t>(index)));
+                break;
+            case FieldKind::Hex8:
+                store(member, static_cast<uint8_t>(0xA0 + index));
+                break;
+            case FieldKind::Hex16:
+                store(member, static_cast<uint16_t>(0xBE00 + index));
+                break;
+            case FieldKind::Hex32:
+                store(member, static_cast<uint32_t>(0xC0FFEE00 + index));
+                break;
+            case FieldKind::Text:
+                break;
+        }
+    }
+}
+
+std::vector<std::string> split(const char* parameters)
+{
+    std::vector<std::string> tokens(1);
+    for (const char* c = parameters; *c != '\0'; ++c)
+    {
+        if (*c == ',') { tokens.emplace_back(); }
+        else { tokens.back().push_back(*c); }
+    }
+    return tokens;
+}
+
+std::string join(const std::vector<std::string>& tokens)
+{
+    std::string retVal;
+    for (size_t i = 0; i < tokens.size(); ++i) { retVal += (i == 0 ? "" : ",") + tokens[i]; }
+    return retVal;
+}
+
+/// @brief Formats a register with every field set, parses the result into a fresh register, both through the schema and the register's own fromString, and
+/// checks that each formats identically. Then checks that each enum field fails to parse just outside its range.
+template <class RegisterType, class... Fields>
+bool roundTrip(const std::tuple<Fields...>& schema, const char* name)
+{
+    RegisterType reg;
+    size_t index = 0;
+    std::apply([&reg, &index](const auto&... field) { (fillField(reg.*field.member, field, index++), ...); }, schema);
+    const AsciiMessage formatted = Registers::Schema::format(reg, schema);
+    const std::vector<std::string> tokens = split(formatted.c_str());
+    bool failed = tokens.size() != sizeof...(Fields);
+
+    RegisterType parsed;
+    failed |= Registers::Schema::parse(formatted, parsed, schema);
+    failed |= std::strcmp(Registers::Schema::format(parsed, schema).c_str(), formatted.c_str()) != 0;
+
+    RegisterType fromString;
+    failed |= fromString.fromString(formatted);
+    failed |= std::strcmp(Registers::Schema::format(fromString, schema).c_str(), formatted.c_str()) != 0;
+
+    index = 0;
+    const auto checkOutOfRange = [&](const auto& field)
+    {
+        const size_t fieldIndex = index++;
+        const Registers::Schema::FieldRange unranged{};
+        if (field.range.max == unranged.max) { return; }
+        std::vector<std::string> outOfRange = tokens;
+        outOfRange[fieldIndex] = std::to_string(field.range.max + 1);
+        RegisterType rejected;
+        failed |= !Registers::Schema::parse(AsciiMessage(join(outOfRange).c_str()), rejected, schema);
+        if (field.range.min > 0)
+        {
+            outOfRange[fieldIndex] = std::to_string(field.range.min - 1);
+            failed |= !Registers::Schema::parse(AsciiMessage(join(outOfRange).c_str()), rejected, schema);
+        }
+    };
+    std::apply([&checkOutOfRange](const auto&... field) { (checkOutOfRange(field), ...); }, schema);
+
+    if (failed) { std::cout << name << " did not round trip: " << formatted.c_str() << std::endl; }
+    return failed;
+}
+
+void testEveryRegisterSchemaRoundTrips()
+{
+    bool failed = false;
+    failed |= roundTrip<Registers::Attitude::YawPitchRoll>(Registers::Attitude::yawPitchRollSchema, "YawPitchRoll");
+    failed |= roundTrip<Registers::Attitude::Quaternion>(Registers::Attitude::quaternionSchema, "Quaternion");
+    failed |= roundTrip<Registers::Attitude::QuatMagAccelRate>(Registers::Attitude::quatMagAccelRateSchema, "QuatMagAccelRate");
+    failed |= roundTrip<Registers::Attitude::MagGravRefVec>(Registers::Attitude::magGravRefVecSchema, "MagGravRefVec");
+    failed |= roundTrip<Registers::Attitude::YprMagAccelAngularRates>(Registers::Attitude::yprMagAccelAngularRatesSchema, "YprMagAccelAngularRates");
+    failed |= roundTrip<Registers::Attitude::VpeBasicControl>(Registers::Attitude::vpeBasicControlSchema, "VpeBasicControl");
+    failed |= roundTrip<Registers::Attitude::VpeMagBasicTuning>(Registers::Attitude::vpeMagBasicTuningSchema, "VpeMagBasicTuning");
+    failed |= roundTrip<Registers::Attitude::VpeAccelBasicTuning>(Registers::Attitude::vpeAccelBasicTuningSchema, "VpeAccelBasicTuning");
+    failed |= roundTrip<Registers::Attitude::YprLinearBodyAccelAngularRates>(Registers::Attitude::yprLinearBodyAccelAngularRatesSchema, "YprLinearBodyAccelAngularRates");
+    failed |= roundTrip<Registers::Attitude::YprLinearInertialAccelAngularRates>(Registers::Attitude::yprLinearInertialAccelAngularRatesSchema, "YprLinearInertialAccelAngularRates");
+    failed |= roundTrip<Registers::GNSS::GnssBasicConfig>(Registers::GNSS::gnssBasicConfigSchema, "GnssBasicConfig");
+    failed |= roundTrip<Registers::GNSS::GnssAOffset>(Registers::GNSS::gnssAOffsetSchema, "GnssAOffset");
+    failed |= roundTrip<Registers::GNSS::GnssSolLla>(Registers::GNSS::gnssSolLlaSchema, "GnssSolLla");
+    failed |= roundTrip<Registers::GNSS::GnssSolEcef>(Registers::GNSS::gnssSolEcefSchema, "GnssSolEcef");
+    failed |= roundTrip<Registers::GNSS::GnssSystemConfig>(Registers::GNSS::gnssSystemConfigSchema, "GnssSystemConfig");
+    failed |= roundTrip<Registers::GNSS::GnssSyncConfig>(Registers::GNSS::gnssSyncConfigSchema, "GnssSyncConfig");
+    failed |= roundTrip<Registers::GNSS::Gnss2SolLla>(Registers::GNSS::gnss2SolLlaSchema, "Gnss2SolLla");
+    failed |= roundTrip<Registers::GNSS::Gnss2SolEcef>(Registers::GNSS::gnss2SolEcefSchema, "Gnss2SolEcef");
+    failed |= roundTrip<Registers::GNSS::ExtGnssOffset>(Registers::GNSS::extGnssOffsetSchema, "ExtGnssOffset");
+    failed |= roundTrip<Registers::GNSSCompass::GnssCompassSignalHealthStatus>(Registers::GNSSCompass::gnssCompassSignalHealthStatusSchema, "GnssCompassSignalHealthStatus");
+    failed |= roundTrip<Registers::GNSSCompass::GnssCompassBaseline>(Registers::GNSSCompass::gnssCompassBaselineSchema, "GnssCompassBaseline");
+    failed |= roundTrip<Registers::GNSSCompass::GnssCompassEstBaseline>(Registers::GNSSCompass::gnssCompassEstBaselineSchema, "GnssCompassEstBaseline");
+    failed |= roundTrip<Registers::GNSSCompass::GnssCompassStartupStatus>(Registers::GNSSCompass::gnssCompassStartupStatusSchema, "GnssCompassStartupStatus");
+    failed |= roundTrip<Registers::HardSoftIronEstimator::RealTimeHsiControl>(Registers::HardSoftIronEstimator::realTimeHsiControlSchema, "RealTimeHsiControl");
+    failed |= roundTrip<Registers::HardSoftIronEstimator::EstMagCal>(Registers::HardSoftIronEstimator::estMagCalSchema, "EstMagCal");
+    failed |= roundTrip<Registers::Heave::HeaveOutputs>(Registers::Heave::heaveOutputsSchema, "HeaveOutputs");
+    failed |= roundTrip<Registers::Heave::HeaveBasicConfig>(Registers::Heave::heaveBasicConfigSchema, "HeaveBasicConfig");
+    failed |= roundTrip<Registers::IMU::Mag>(Registers::IMU::magSchema, "Mag");
+    failed |= roundTrip<Registers::IMU::Accel>(Registers::IMU::accelSchema, "Accel");
+    failed |= roundTrip<Registers::IMU::Gyro>(Registers::IMU::gyroSchema, "Gyro");
+    failed |= roundTrip<Registers::IMU::MagAccelGyro>(Registers::IMU::magAccelGyroSchema, "MagAccelGyro");
+    failed |= roundTrip<Registers::IMU::MagCal>(Registers::IMU::magCalSchema, "MagCal");
+    failed |= roundTrip<Registers::IMU::AccelCal>(Registers::IMU::accelCalSchema, "AccelCal");
+    failed |= roundTrip<Registers::IMU::RefFrameRot>(Registers::IMU::refFrameRotSchema, "RefFrameRot");
+    failed |= roundTrip<Registers::IMU::ImuMeas>(Registers::IMU::imuMeasSchema, "ImuMeas");
+    failed |= roundTrip<Registers::IMU::DeltaThetaVelocity>(Registers::IMU::deltaThetaVelocitySchema, "DeltaThetaVelocity");
+    failed |= roundTrip<Registers::IMU::DeltaThetaVelConfig>(Registers::IMU::deltaThetaVelConfigSchema, "DeltaThetaVelConfig");
+    failed |= roundTrip<Registers::IMU::GyroCal>(Registers::IMU::gyroCalSchema, "GyroCal");
+    failed |= roundTrip<Registers::IMU::ImuFilterControl>(Registers::IMU::imuFilterControlSchema, "ImuFilterControl");
+    failed |= roundTrip<Registers::INS::InsSolLla>(Registers::INS::insSolLlaSchema, "InsSolLla");
+    failed |= roundTrip<Registers::INS::InsSolEcef>(Registers::INS::insSolEcefSchema, "InsSolEcef");
+    failed |= roundTrip<Registers::INS::InsBasicConfig>(Registers::INS::insBasicConfigSchema, "InsBasicConfig");
+    failed |= roundTrip<Registers::INS::InsStateLla>(Registers::INS::insStateLlaSchema, "InsStateLla");
+    failed |= roundTrip<Registers::INS::InsStateEcef>(Registers::INS::insStateEcefSchema, "InsStateEcef");
+    failed |= roundTrip<Registers::INS::FilterStartupBias>(Registers::INS::filterStartupBiasSchema, "FilterStartupBias");
+    failed |= roundTrip<Registers::INS::InsRefOffset>(Registers::INS::insRefOffsetSchema, "InsRefOffset");
+    failed |= roundTrip<Registers::INS::InsGnssSelect>(Registers::INS::insGnssSelectSchema, "InsGnssSelect");
+    failed |= roundTrip<Registers::System::UserTag>(Registers::System::userTagSchema, "UserTag");
+    failed |= roundTrip<Registers::System::Model>(Registers::System::modelSchema, "Model");
+    failed |= roundTrip<Registers::System::HwVer>(Registers::System::hwVerSchema, "HwVer");
+    failed |= roundTrip<Registers::System::Serial>(Registers::System::serialSchema, "Serial");
+    failed |= roundTrip<Registers::System::FwVer>(Registers::System::fwVerSchema, "FwVer");
+    failed |= roundTrip<Registers::System::BaudRate>(Registers::System::baudRateSchema, "BaudRate");
+    failed |= roundTrip<Registers::System::AsyncOutputType>(Registers::System::asyncOutputTypeSchema, "AsyncOutputType");
+    failed |= roundTrip<Registers::System::AsyncOutputFreq>(Registers::System::asyncOutputFreqSchema, "AsyncOutputFreq");
+    failed |= roundTrip<Registers::System::ProtocolControl>(Registers::System::protocolControlSchema, "ProtocolControl");
+    failed |= roundTrip<Registers::System::SyncControl>(Registers::System::syncControlSchema, "SyncControl");
+    failed |= roundTrip<Registers::System::SyncStatus>(Registers::System::syncStatusSchema, "SyncStatus");
+    failed |= roundTrip<Registers::System::NmeaOutput1>(Registers::System::nmeaOutput1Schema, "NmeaOutput1");
+    failed |= roundTrip<Registers::System::NmeaOutput2>(Registers::System::nmeaOutput2Schema, "NmeaOutput2");
+    failed |= roundTrip<Registers::System::LegacyCompatibilitySettings>(Registers::System::legacyCompatibilitySettingsSchema, "LegacyCompatibilitySettings");
+    failed |= roundTrip<Registers::VelocityAiding::VelAidingMeas>(Registers::VelocityAiding::velAidingMeasSchema, "VelAidingMeas");
+    failed |= roundTrip<Registers::VelocityAiding::VelAidingControl>(Registers::VelocityAiding::velAidingControlSchema, "VelAidingControl");
+    failed |= roundTrip<Registers::WorldMagGravityModel::RefModelConfig>(Registers::WorldMagGravityModel::refModelConfigSchema, "RefModelConfig");
+    VN_CHECK(!failed);
+}
+
+void testEnumRange()
+{
+    Registers::Attitude::VpeBasicControl vpeBasicControl;
+    VN_CHECK(!vpeBasicControl.fromString(AsciiMessage("0,2,1,1")));
+    VN_CHECK(vpeBasicControl.headingMode == Registers::Attitude::VpeBasicControl::HeadingMode::Indoor);
+    VN_CHECK(vpeBasicControl.fromString(AsciiMessage("0,3,1,1")));
+
+    Registers::System::BaudRate baudRate;
+    VN_CHECK(!baudRate.fromString(AsciiMessage("921600")));
+    VN_CHECK(baudRate.fromString(AsciiMessage("4800")));
+}
+
+struct ScaledRegister
+{
+    float angle = 0;  // Radians, sent in degrees
+    double distance = 0;
+};
+
+void testScale()
+{
+    constexpr double degreesToRadians = 3.14159265358979323846 / 180.0;
+    constexpr auto schema = std::make_tuple(Registers::Schema::scaled<float>(&ScaledRegister::angle, degreesToRadians),
+                                            Registers::Schema::scaled<double>(&ScaledRegister::distance, 1000.0));
+    ScaledRegister reg;
+    VN_CHECK(!Registers::Schema::parse(AsciiMessage("90.000000,2.500000"), reg, schema));
+    VN_CHECK(std::fabs(reg.angle - 1.5707963f) < 1e-6f);
+    VN_CHECK(reg.distance == 2500.0);
+    VN_CHECK(std::strcmp(Registers::Schema::format(reg, schema).c_str(), "90.000000,2.500000") == 0);
+}
+
+int main()
+{
+    testEveryRegisterSchemaRoundTrips();
+    testEnumRange();
+    testScale();
+    return Test::result("RegisterSchemaTest");
+}
@@ -0,0 +1,176 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include "Config.hpp"
+#include "Interface/Registers.hpp"
+#include "Interface/Sensor.hpp"
+#include "plugins/LogReplay/SerialReplay.hpp"
+#include "plugins/SimpleLogger/CompactLog.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+using namespace std::chrono_literals;
+
+// Fewer packets than the measurement queue holds, so none are dropped however the listening thread is scheduled
+constexpr int numPackets = Config::PacketDispatchers::compositeDataQueueCapacity - 3;
+
+/// @brief Common group packets with TimeStartup counting up from 1000, with a few corrupt bytes between two of them that must be skipped.
+std::vector<uint8_t> makeStream()
+{
+    std::vector<uint8_t> stream;
+    for (int i = 0; i < numPackets; ++i)
+    {
+        Test::appendCommonPacket(stream, 1000 + i, true, static_cast<float>(i));
+        if (i == numPackets / 2) { stream.insert(stream.end(), {0xFA, 0x01, 0x55}); }
+    }
+    return stream;
+}
+
+std::filesystem::path writeLog(const char* name, const std::vector<uint8_t>& bytes)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    return path;
+}
+
+/// @brief Moves replayed bytes through the pipeline, as the listening thread does when threaded.
+void pump(Sensor& sensor)
+{
+#if (THREADING_ENABLE)
+    (void)sensor;
+    std::this_thread::sleep_for(1ms);
+#else
+    sensor.loadMainBufferFromSerial();
+    while (!sensor.processNextPacket()) {}
+#endif
+}
+
+/// @brief Replays until every packet has been received or the deadline passes, checking each measurement is the next in the log.
+int receiveAll(Sensor& sensor, const SerialReplay& replay, const std::chrono::seconds timeout)
+{
+    int numReceived = 0;
+    for (const auto deadline = now() + timeout; (numReceived < numPackets || !replay.isFinished()) && now() < deadline;)
+    {
+        pump(sensor);
+        sensor.drainMeasurements(
+            [&numReceived](const CompositeData& measurement)
+            {
+                VN_CHECK(measurement.time.timeStartup.has_value() && measurement.time.timeStartup->nanoseconds() == static_cast<uint64_t>(1000 + numReceived));
+                VN_CHECK(measurement.timestamp != time_point{});
+                ++numReceived;
+            });
+    }
+    return numReceived;
+}
+
+void testUnpacedReplay()
+{
+    const std::vector<uint8_t> stream = makeStream();
+
+    // A compact log is decoded on open, so replays the same bytes as the raw log it was made from
+    CompactLogEncoder encoder;
+    std::vector<uint8_t> compact = encoder.consume(stream.data(), stream.size());
+    const auto& tail = encoder.finish();
+    compact.insert(compact.end(), tail.begin(), tail.end());
+
+    for (const auto& [name, bytes] : {std::make_pair("SerialReplayTest.bin", stream), std::make_pair("SerialReplayTest.vnc", compact)})
+    {
+        const std::filesystem::path logPath = writeLog(name, bytes);
+        Sensor sensor;
+        SerialReplay* replay = sensor.useSerial<SerialReplay>(Filesystem::FilePath(logPath.string().c_str()), SerialReplay::Pacing::Unpaced);
+        VN_CHECK(replay != nullptr);
+        if (!replay) { continue; }
+        VN_CHECK(sensor.connect("Replay", Sensor::BaudRate::Baud921600) == Error::None);
+        VN_CHECK(sensor.useSerial<SerialReplay>(Filesystem::FilePath(logPath.string().c_str())) == nullptr);  // Not while connected
+
+        VN_CHECK(receiveAll(sensor, *replay, 2s) == numPackets);
+        VN_CHECK(replay->isFinished());
+        VN_CHECK(replay->numBytesReplayed() == stream.size());
+        sensor.disconnect();
+        std::filesystem::remove(logPath);
+    }
+}
+
+void testBaudRatePacing()
+{
+    const std::vector<uint8_t> stream = makeStream();
+    const std::filesystem::path logPath = writeLog("SerialReplayPacedTest.bin", stream);
+    Sensor sensor;
+    SerialReplay* replay = sensor.useSerial<SerialReplay>(Filesystem::FilePath(logPath.string().c_str()), SerialReplay::Pacing::BaudRate);
+    VN_CHECK(replay != nullptr);
+    if (!replay) { return; }
+
+    // At 9600 baud, 960 bytes a second
+    const auto startTime = now();
+    VN_CHECK(sensor.connect("Replay", Sensor::BaudRate::Baud9600) == Error::None);
+    VN_CHECK(receiveAll(sensor, *replay, 5s) == numPackets);
+    const double expectedSeconds = stream.size() / 960.0;
+    const double elapsedSeconds = std::chrono::duration<double>(now() - startTime).count();
+    VN_CHECK(elapsedSeconds > 0.9 * expectedSeconds);
+    sensor.disconnect();
+    std::filesystem::remove(logPath);
+}
+
+void testCannedResponses()
+{
+    const std::filesystem::path logPath = writeLog("SerialReplayResponseTest.bin", makeStream());
+    Sensor sensor;
+    SerialReplay* replay = sensor.useSerial<SerialReplay>(Filesystem::FilePath(logPath.string().c_str()), SerialReplay::Pacing::Unpaced);
+    VN_CHECK(replay != nullptr);
+    if (!replay) { return; }
+    replay->addResponse("RRG,01", "VNRRG,01,VN-100 Replay");
+    VN_CHECK(sensor.connect("Replay", Sensor::BaudRate::Baud921600) == Error::None);
+
+    Registers::System::Model model;
+    VN_CHECK(sensor.readRegister(&model) == Error::None);
+    VN_CHECK(model.model == "VN-100 Replay");
+    sensor.disconnect();
+    std::filesystem::remove(logPath);
+}
+
+void testMissingLog()
+{
+    Sensor sensor;
+    sensor.useSerial<SerialReplay>(Filesystem::FilePath((std::filesystem::temp_directory_path() / "SerialReplayMissing.bin").string().c_str()));
+    VN_CHECK(sensor.connect("Replay", Sensor::BaudRate::Baud921600) == Error::InvalidPortName);
+    VN_CHECK(!sensor.connectedPortName().has_value());
+}
+
+int main()
+{
+    testUnpacedReplay();
+    testBaudRatePacing();
+    testCannedResponses();
+    testMissingLog();
+    return Test::result("SerialReplayTest");
+}
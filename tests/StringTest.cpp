@@ -0,0 +1,134 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+#include "TemplateLibrary/String.hpp"
+#include "Implementation/BinaryHeader.hpp"
+#include "Interface/Commands.hpp"
+#include "Interface/Registers.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace VN;
+
+void testLengthTracking()
+{
+    String<16> string("abc");
+    VN_CHECK(string.length() == 3);
+    VN_CHECK(!string.push_back('d') && string.length() == 4);
+    VN_CHECK(!string.append("ef", 2) && string.length() == 6);
+    VN_CHECK(string.append("0123456789abcdef", 16) && string.length() == 16);  // Truncated to fit
+    VN_CHECK(std::strlen(string.c_str()) == 16);
+    string.pop_back();
+    VN_CHECK(string.length() == 15);
+    VN_CHECK(!string.assign("xy", 5) && string.length() == 2);
+    string.clear();
+    VN_CHECK(string.empty() && string.length() == 0);
+
+    // Written through the pointer, then counted once
+    std::snprintf(string.begin(), string.capacity(), "%d", 12345);
+    VN_CHECK(string.length() == 5);
+    std::snprintf(string.data(), string.capacity(), "%s", "hi");
+    VN_CHECK(string.length() == 2);
+    VN_CHECK(!string.setLength(1) && string.length() == 1 && string == String<16>("h"));
+    VN_CHECK(string.setLength(17));
+}
+
+void testFormatting()
+{
+    // Each of these appends field by field, so a stale length would drop all but the last field
+    BinaryHeader header;
+    header.outputGroups.push_back(0x01);
+    header.outputGroups.push_back(0x02);
+    header.outputTypes.push_back(0x0001);
+    header.outputTypes.push_back(0x8030);
+    const auto headerString = binaryHeaderToString<64>(header);
+    VN_CHECK(headerString == String<64>(",01,02,0001,8030"));
+    VN_CHECK(headerString.length() == 16);
+
+    Registers::System::BinaryOutput1 binaryOutput;
+    binaryOutput.asyncMode = 3;
+    binaryOutput.rateDivisor = 40;
+    binaryOutput.common.timeStartup = true;
+    binaryOutput.common.ypr = true;
+    const AsciiMessage registerString = binaryOutput.toString();
+    VN_CHECK(registerString == AsciiMessage("3,40,01,0009"));
+    VN_CHECK(registerString.length() == std::strlen(registerString.c_str()));
+
+    SetInitialHeading setInitialHeading(Ypr{1.0f, -2.0f, 3.0f});
+    const AsciiMessage commandString = setInitialHeading.getCommandString();
+    VN_CHECK(commandString == AsciiMessage("SIH,+001.000,-002.000,+003.000"));
+    VN_CHECK(commandString.length() == std::strlen(commandString.c_str()));
+}
+
+template <class T>
+bool matchesStrtod(const char* text)
+{
+    const auto parsed = StringUtils::fromString<T>(text, text + std::strlen(text));
+    const T expected = std::is_same_v<T, float> ? std::strtof(text, nullptr) : std::strtod(text, nullptr);
+    return parsed.has_value() && *parsed == expected;
+}
+
+void testNumericConversions()
+{
+    // Fields as the sensor prints them, plus long mantissas that need the library fallback
+    const char* const fields[] = {"+010.123", "-000.001", "+1.234567E+02", "0", "-0.5", "123456789", "1.00000005960464477539",
+                                  "0.100000001490116119384765625", "16777217", "3.4028235E+38", "1.4E-45", "+0123.45678901234"};
+    for (const char* field : fields)
+    {
+        VN_CHECK(matchesStrtod<float>(field));
+        VN_CHECK(matchesStrtod<double>(field));
+    }
+
+    std::mt19937_64 generator(1);
+    char text[64];
+    for (int i = 0; i < 200000; ++i)
+    {
+        uint64_t modulus = 1;
+        for (int numDigits = 1 + static_cast<int>(generator() % 17); numDigits > 0; --numDigits) { modulus *= 10; }
+        const int exponent = static_cast<int>(generator() % 41) - 20;
+        std::snprintf(text, sizeof(text), "%c%llue%d", (generator() & 1) ? '-' : '+', static_cast<unsigned long long>(generator() % modulus), exponent);
+        if (!matchesStrtod<float>(text) || !matchesStrtod<double>(text))
+        {
+            VN_CHECK(matchesStrtod<float>(text) && matchesStrtod<double>(text));
+            std::printf("mismatch: %s\n", text);
+            break;
+        }
+    }
+
+    const char* const invalid[] = {"", "+", "1.2.3", "1e", "abc", "1,5"};
+    for (const char* field : invalid) { VN_CHECK(!StringUtils::fromString<float>(field, field + std::strlen(field)).has_value()); }
+}
+
+int main()
+{
+    testLengthTracking();
+    testFormatting();
+    testNumericConversions();
+    return Test::result("StringTest");
+}
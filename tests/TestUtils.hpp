@@ -0,0 +1,83 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.19.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef TESTS_TESTUTILS_HPP
+#define TESTS_TESTUTILS_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "Implementation/CoreUtils.hpp"
+
+namespace VN
+{
+namespace Test
+{
+
+inline int& numFailures() noexcept
+{
+    static int numFailures = 0;
+    return numFailures;
+}
+
+/// @brief The exit code for a test's main: nonzero if any check failed.
+inline int result(const char* testName) noexcept
+{
+    std::cout << testName << ": " << (numFailures() == 0 ? "passed" : "FAILED") << std::endl;
+    return numFailures() == 0 ? 0 : 1;
+}
+
+/// @brief Appends an FA packet of Common group measurements to stream: TimeStartup, then Ypr of (yaw, 1.5, -2.25) if withYpr.
+inline void appendCommonPacket(std::vector<uint8_t>& stream, const uint64_t timeStartup, const bool withYpr, const float yaw = 0)
+{
+    const size_t packetIndex = stream.size();
+    const uint16_t types = withYpr ? 0x0009 : 0x0001;
+    stream.insert(stream.end(), {0xFA, 0x01, static_cast<uint8_t>(types), static_cast<uint8_t>(types >> 8)});
+    for (int i = 0; i < 8; ++i) { stream.push_back(static_cast<uint8_t>(timeStartup >> (8 * i))); }
+    if (withYpr)
+    {
+        const float ypr[3] = {yaw, 1.5f, -2.25f};
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(ypr);
+        stream.insert(stream.end(), bytes, bytes + sizeof(ypr));
+    }
+    const uint16_t crc = CalculateCRC(stream.data() + packetIndex + 1, stream.size() - packetIndex - 1);
+    stream.push_back(static_cast<uint8_t>(crc >> 8));
+    stream.push_back(static_cast<uint8_t>(crc));
+}
+
+}  // namespace Test
+}  // namespace VN
+
+/// @brief Records a failure, with its location, if condition is false, and carries on with the rest of the test.
+#define VN_CHECK(condition)                                                                              \
+    do {                                                                                                 \
+        if (!(condition))                                                                                \
+        {                                                                                                \
+            ++VN::Test::numFailures();                                                                   \
+            std::cout << __FILE__ << ":" << __LINE__ << ": check failed: " << #condition << std::endl;   \
+        }                                                                                                \
+    } while (0)
+
+#endif  // TESTS_TESTUTILS_HPP